@@ -21,6 +21,13 @@
 #define __MAIN_H
 
 /* Includes ------------------------------------------------------------------*/
+#include "core_bench.h"
+#include "core_clock.h"
+#include "core_lock.h"
+#include "core_notify.h"
+#include "core_protocol.h"
+#include "core_rpc.h"
+#include "core_snapshot.h"
 #include "cores_communication.h"
 #include "stm32h747i_discovery.h"
 #include "stm32h7xx_hal.h"
@@ -31,13 +31,26 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
-#define HSEM_ID_0 (0U) /* HW semaphore 0*/
+/* Period of the snapshot publishing */
+#define PUBLISH_PERIOD_MS (100U)
+
+/* LPTIM1 counts LSI (32 kHz) divided by 32, i.e. about 1 kHz */
+#define PUBLISH_TIMER_HZ (32000U / 32U)
+#define PUBLISH_TIMER_PRESC (5U) /* divide by 2^5 */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Heater state applied by the last request from M7 */
+static int32_t heater_state;
+/* Faults of the last snapshot, M7 is notified when they change */
+static uint32_t published_faults = CORE_FAULT_NONE;
+
 /* Private function prototypes -----------------------------------------------*/
 
 /* Private functions ---------------------------------------------------------*/
 static void CoreCommunication(void);
+static void PublishTimer_Init(void);
+static uint8_t PublishSnapshot(void);
 
 /**
  * @brief  Main program
@@ -50,7 +63,7 @@ int main(void)
    __HAL_RCC_HSEM_CLK_ENABLE();
 
    /* Activate HSEM notification for Cortex-M4*/
-   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_BOOT));
 
    /*
      Domain D2 goes to STOP mode (Cortex-M4 in deep-sleep) waiting for Cortex-M7
@@ -62,7 +75,7 @@ int main(void)
                            PWR_D2_DOMAIN);
 
    /* Clear HSEM flag */
-   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_BOOT));
 
    /* STM32H7xx HAL library initialization:
          - Systick timer is configured by default as source of time base, but
@@ -75,36 +88,121 @@ int main(void)
        */
    HAL_Init();
 
+   /* Shared memory is created by M7 before it wakes up M4 */
+   core_lock_init();
+   core_notify_init();
+   PublishTimer_Init();
+
+   /* M7 configures its Leds on the same port at the same time */
+   core_lock_take(CORE_LOCK_GPIO);
    BSP_LED_Init(LED1);
    BSP_LED_Init(LED2);
+   core_lock_release(CORE_LOCK_GPIO);
 
-   /* Create share memory */
-   core_share_init();
+#ifdef CORE_BENCH
+   /* Echo inter-core benchmark messages until M7 is done */
+   core_bench_run_m4();
+#endif
 
    /* Infinite loop */
    while (1) {
 
+      /* Sleep until M7 posts a message or the publish period elapses */
+      core_wait_m7_or(&LPTIM1->ISR, LPTIM_ISR_ARRM);
       CoreCommunication();
-      BSP_LED_On(LED1);
-      HAL_Delay(1000);
-      CoreCommunication();
-      BSP_LED_Off(LED1);
-      HAL_Delay(1000);
+
+      if (LPTIM1->ISR & LPTIM_ISR_ARRM) {
+         LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+         if (PublishSnapshot())
+            core_notify_m7();
+      }
+   }
+}
+
+/**
+ * @brief Start LPTIM1 with the publish period. It runs from LSI also while D2
+ * is in STOP mode, its wakeup line is an event of M4, so core_wait_m7_or()
+ * returns once per period even without any message.
+ */
+static void PublishTimer_Init(void)
+{
+   /* RCC is configured by both cores */
+   core_lock_take(CORE_LOCK_GPIO);
+   __HAL_RCC_LSI_ENABLE();
+   while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY) == 0U) {
    }
+   __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+   __HAL_RCC_C2_LPTIM1_CLK_ENABLE();
+   core_lock_release(CORE_LOCK_GPIO);
+
+   HAL_EXTI_D2_EventInputConfig(EXTI_LINE47, EXTI_MODE_EVT, ENABLE);
+
+   /* Interrupt enable and prescaler can be written only while disabled */
+   LPTIM1->CR = 0;
+   LPTIM1->CFGR = PUBLISH_TIMER_PRESC << LPTIM_CFGR_PRESC_Pos;
+   LPTIM1->IER = LPTIM_IER_ARRMIE;
+   LPTIM1->CR = LPTIM_CR_ENABLE;
+   LPTIM1->ARR = PUBLISH_PERIOD_MS * PUBLISH_TIMER_HZ / 1000U - 1U;
+   LPTIM1->CR = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
 }
 
 /**
- * @brief Turn the light on on M7 request
+ * @brief Publish the heater state to M7 as a snapshot. No temperature sensor
+ * is wired yet, so the temperature is marked as not measured and the sensor
+ * fault is set. The periodic publish does not wake M7 up, unless the faults
+ * changed.
+ *
+ * @return uint8_t 1 if the faults changed and M7 has to be notified
+ */
+static uint8_t PublishSnapshot(void)
+{
+   const core_snapshot_t snapshot = {
+       .heater = heater_state,
+       .temperature = CORE_SNAPSHOT_NO_TEMPERATURE,
+       .faults = CORE_FAULT_SENSOR,
+       .uptime_ms = (uint32_t)core_clock_ms()};
+   const uint8_t changed = snapshot.faults != published_faults;
+
+   core_snapshot_write(&snapshot);
+   published_faults = snapshot.faults;
+   return changed;
+}
+
+/**
+ * @brief Turn the light on on M7 heater request. All pending messages are
+ * drained in place, every heater request is applied and confirmed to M7.
+ * Without a message the light keeps its state. A changed state is published
+ * at once, otherwise it is published by the period. LED1 is toggled and M7 is
+ * notified on every received batch, after the publish, so M7 reads the new
+ * state with the confirmations.
  *
  */
 static void CoreCommunication(void)
 {
-   int buff[] = {0, 0};
-   unsigned int size = get_from_m7(&buff, 2);
-   if (buff[1] == 1)
-      BSP_LED_On(LED2);
-   else
-      BSP_LED_Off(LED2);
+   int state = -1;
+   int ret;
+   core_msg_t msg;
+
+   while ((ret = core_msg_receive_from_m7(&msg)) != -1) {
+      if (ret != 0 || msg.header.type != CORE_MSG_HEATER)
+         continue;
+      state = msg.payload.heater.on;
+      if (state == 1)
+         BSP_LED_On(LED2);
+      else
+         BSP_LED_Off(LED2);
+      core_rpc_reply_m7(&msg, 0);
+   }
+   if (state < 0)
+      return;
+   if (state != heater_state) {
+      heater_state = state;
+      PublishSnapshot();
+   }
+
+   /* Wake up M7 to process the confirmations */
+   core_notify_m7();
+   BSP_LED_Toggle(LED1);
 }
 
 #ifdef USE_FULL_ASSERT
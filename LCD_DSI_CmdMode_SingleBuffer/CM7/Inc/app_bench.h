@@ -0,0 +1,114 @@
+/*
+ * app_bench.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_BENCH_H_
+#define APP_BENCH_H_
+
+#include "app_scene.h"
+#include <stdint.h>
+
+#ifdef APP_FB_BENCH
+
+/* Frames of every scene rendered by APP_FbBench */
+#ifndef APP_FB_BENCH_FRAMES
+#define APP_FB_BENCH_FRAMES 100U
+#endif
+
+/* Rendering of one scene into the software frame buffer */
+typedef struct {
+   uint32_t full_us;           /* time to render whole frame */
+   uint32_t full_pixels;       /* pixels written by whole frame */
+   uint32_t frame_us;          /* time to render changed widgets of one frame */
+   uint32_t pixels;            /* pixels written by one frame */
+   uint32_t uncached_full_us;  /* full_us with I-cache and D-cache off */
+   uint32_t uncached_frame_us; /* frame_us with I-cache and D-cache off */
+   uint8_t *ppm;               /* image of the scene, APP_FB_PPM_SIZE bytes */
+} App_fb_scene_t;
+
+/* Result of the rendering benchmark */
+typedef struct {
+   uint32_t done;   /* 1 when results are valid */
+   uint32_t frames; /* frames rendered of every scene */
+   uint32_t fps;    /* frames per second of all scenes, changes only */
+   App_fb_scene_t scene[SCENE_COUNT];
+} App_fb_bench_t;
+
+/**
+ * @brief Render every scene into the software frame buffer, without LTDC, DSI
+ *        and DMA2D
+ */
+void APP_FbBench(void);
+
+/**
+ * @brief Get results of the benchmark
+ * @return const App_fb_bench_t*
+ */
+const App_fb_bench_t *APP_FbBenchResults(void);
+
+#endif /* APP_FB_BENCH */
+
+#ifdef APP_GLYPH_BENCH
+
+/* Screens of text drawn by APP_GlyphBench with every font */
+#ifndef APP_GLYPH_BENCH_SCREENS
+#define APP_GLYPH_BENCH_SCREENS 10U
+#endif
+
+/* Fonts of the scenes measured by APP_GlyphBench */
+#define APP_GLYPH_BENCH_FONTS 3U
+
+/* Glyphs per second of one font */
+typedef struct {
+   uint32_t glyphs;       /* drawn by each way */
+   uint32_t rows_per_s;   /* drawn by the LCD utility row by row */
+   uint32_t cached_per_s; /* blended from the glyph cache */
+} App_glyph_font_t;
+
+/* Result of the text drawing benchmark */
+typedef struct {
+   uint32_t done; /* 1 when results are valid */
+   App_glyph_font_t font[APP_GLYPH_BENCH_FONTS];
+} App_glyph_bench_t;
+
+/**
+ * @brief Draw text with every font of the scenes, row by row by the LCD
+ *        utility and from the glyph cache
+ */
+void APP_GlyphBench(void);
+
+/**
+ * @brief Get results of the benchmark
+ * @return const App_glyph_bench_t*
+ */
+const App_glyph_bench_t *APP_GlyphBenchResults(void);
+
+#endif /* APP_GLYPH_BENCH */
+
+#endif /* APP_BENCH_H_ */
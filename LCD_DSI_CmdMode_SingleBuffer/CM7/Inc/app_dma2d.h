@@ -0,0 +1,156 @@
+/*
+ * app_dma2d.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_DMA2D_H_
+#define APP_DMA2D_H_
+
+#include <stdint.h>
+
+/*
+ * Queue of DMA2D operations. Operations are appended to a ring and the next
+ * one is started from the transfer complete interrupt, so the CPU does not
+ * wait for every rectangle. It waits only in app_dma2d_flush, before the
+ * drawn pixels are used. Operations run in the order they were queued.
+ *
+ * Source pixels owned by the caller may be gone before the operation runs,
+ * they are copied into memory from app_dma2d_stage first.
+ *
+ * APP_DMA2D_SOFT replaces the hardware by a software engine, which runs the
+ * operation on app_dma2d_irq, so the queue can be used on host.
+ */
+
+/* Operations in the ring, power of 2 */
+#define APP_DMA2D_QUEUE (64U)
+/* Staging memory for source pixels in bytes */
+#define APP_DMA2D_STAGE_SIZE (0x8000U)
+
+/* Pixel formats of the blend source */
+#define APP_DMA2D_ARGB8888 (0U)
+#define APP_DMA2D_A8 (9U)
+#define APP_DMA2D_A4 (10U) /* width + offset even, left pixel in low nibble */
+
+typedef struct {
+   uint32_t ops;    /* operations done */
+   uint32_t errors; /* transfer errors */
+   uint32_t waits;  /* queue or staging memory was full */
+} app_dma2d_stats_t;
+
+/**
+ * @brief Reset the queue, DMA2D clock and interrupt are enabled by the caller
+ */
+void app_dma2d_init(void);
+
+/**
+ * @brief Queue filling of the rectangle by the color
+ * @param dst first pixel, ARGB8888
+ * @param dst_offset pixels skipped between lines
+ * @param width
+ * @param height
+ * @param color ARGB8888
+ */
+void app_dma2d_fill(uint32_t *dst, uint32_t dst_offset, uint32_t width,
+                    uint32_t height, uint32_t color);
+
+/**
+ * @brief Queue copy of the rectangle, ARGB8888
+ * @param dst
+ * @param dst_offset pixels skipped between lines
+ * @param src
+ * @param src_offset pixels skipped between lines
+ * @param width
+ * @param height
+ */
+void app_dma2d_copy(uint32_t *dst, uint32_t dst_offset, const uint32_t *src,
+                    uint32_t src_offset, uint32_t width, uint32_t height);
+
+/**
+ * @brief Queue blending of the source over the rectangle
+ * @param dst ARGB8888
+ * @param dst_offset pixels skipped between lines
+ * @param src
+ * @param src_offset pixels skipped between lines
+ * @param width
+ * @param height
+ * @param format APP_DMA2D_ARGB8888, APP_DMA2D_A8 or APP_DMA2D_A4
+ * @param color color of APP_DMA2D_A8 and APP_DMA2D_A4 source
+ */
+void app_dma2d_blend(uint32_t *dst, uint32_t dst_offset, const void *src,
+                     uint32_t src_offset, uint32_t width, uint32_t height,
+                     uint32_t format, uint32_t color);
+
+/**
+ * @brief Queue blending of the source over the back color into the rectangle,
+ *        the destination is not read. One operation draws an opaque glyph.
+ * @param dst ARGB8888
+ * @param dst_offset pixels skipped between lines
+ * @param src
+ * @param src_offset pixels skipped between lines
+ * @param width
+ * @param height
+ * @param format APP_DMA2D_ARGB8888, APP_DMA2D_A8 or APP_DMA2D_A4
+ * @param color color of APP_DMA2D_A8 and APP_DMA2D_A4 source
+ * @param back ARGB8888 background
+ */
+void app_dma2d_blend_color(uint32_t *dst, uint32_t dst_offset, const void *src,
+                           uint32_t src_offset, uint32_t width,
+                           uint32_t height, uint32_t format, uint32_t color,
+                           uint32_t back);
+
+/**
+ * @brief Get staging memory for source pixels of the next queued operation,
+ *        it is released when the operation is done
+ * @param size in bytes
+ * @return void* NULL if size is over APP_DMA2D_STAGE_SIZE
+ */
+void *app_dma2d_stage(uint32_t size);
+
+/**
+ * @brief Wait until all queued operations are done
+ */
+void app_dma2d_flush(void);
+
+/**
+ * @brief Get count of queued operations
+ * @return uint32_t
+ */
+uint32_t app_dma2d_pending(void);
+
+/**
+ * @brief DMA2D interrupt, starts the next operation
+ */
+void app_dma2d_irq(void);
+
+/**
+ * @brief Get statistics of the queue
+ * @return const app_dma2d_stats_t*
+ */
+const app_dma2d_stats_t *app_dma2d_stats(void);
+
+#endif /* APP_DMA2D_H_ */
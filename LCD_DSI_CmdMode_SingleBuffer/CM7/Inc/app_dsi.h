@@ -0,0 +1,72 @@
+/*
+ * app_dsi.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_DSI_H_
+#define APP_DSI_H_
+
+#include "app_rect.h"
+#include <stdint.h>
+
+/*
+ * DSI panel in adapted command mode. LTDC sends the frame only on the refresh
+ * of a region, the end of the refresh calls LCD_RefreshDone.
+ */
+
+/**
+ * @brief Initializes the DSI, LTDC and the OTM8009A display
+ * @return uint8_t BSP status
+ */
+uint8_t LCD_Init(void);
+
+/**
+ * @brief Initializes LTDC timing of the whole display
+ */
+void LTDC_Init(void);
+
+/**
+ * @brief Initializes the LCD layer
+ * @param LayerIndex
+ * @param Address frame buffer
+ */
+void LCD_LayertInit(uint16_t LayerIndex, uint32_t Address);
+
+/**
+ * @brief Enable the clocks and interrupts of LTDC, DMA2D and DSI
+ */
+void LCD_MspInit(void);
+
+/**
+ * @brief Refresh only the region of the front buffer
+ * @param buffer address of the front buffer
+ * @param rect region of the display
+ */
+void LCD_RefreshRegion(uint32_t buffer, const app_rect_t *rect);
+
+#endif /* APP_DSI_H_ */
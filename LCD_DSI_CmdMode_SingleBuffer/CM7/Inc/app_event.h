@@ -0,0 +1,91 @@
+/*
+ * app_event.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_EVENT_H_
+#define APP_EVENT_H_
+
+#include <stdint.h>
+
+/* Event sources waking up the M7 main loop, they are posted from interrupts */
+#define APP_EVENT_TOUCH (1U << 0)   /* touch controller EXTI */
+#define APP_EVENT_TIMER (1U << 1)   /* deadline armed by app_event_deadline */
+#define APP_EVENT_REFRESH (1U << 2) /* DSI end of refresh */
+#define APP_EVENT_CORE (1U << 3)    /* message from M4 */
+#define APP_EVENT_ALARM (1U << 4)   /* RTC alarm of the schedule */
+#define APP_EVENT_ALL                                                          \
+   (APP_EVENT_TOUCH | APP_EVENT_TIMER | APP_EVENT_REFRESH | APP_EVENT_CORE |   \
+    APP_EVENT_ALARM)
+
+/**
+ * @brief Post events, safe to call from interrupt
+ * @param events mask of APP_EVENT_* flags
+ */
+void app_event_post(uint32_t events);
+
+/**
+ * @brief Arm one shot deadline, APP_EVENT_TIMER is posted once the core clock
+ *        reaches it. The previous deadline is replaced. The core is woken up
+ *        by TIM2 compare, there is no periodic tick.
+ * @param deadline core clock in ms
+ */
+void app_event_deadline(uint32_t deadline);
+
+/**
+ * @brief Disarm the deadline
+ */
+void app_event_deadline_cancel(void);
+
+/**
+ * @brief Get the armed deadline
+ * @param deadline core clock in ms
+ * @return 0 if a deadline is armed, -1 otherwise
+ */
+int app_event_deadline_get(uint32_t *const deadline);
+
+/**
+ * @brief Check the deadline, called by TIM2 compare interrupt or by simulator
+ * @param now core clock in ms
+ */
+void app_event_tick(uint32_t now);
+
+/**
+ * @brief Sleep until any event is posted
+ * @return mask of posted events, they are cleared
+ */
+uint32_t app_event_wait(void);
+
+/**
+ * @brief Sleep until an interrupt, called by app_event_wait while no event is
+ *        posted. SysTick is suspended while sleeping. Weak, the simulator
+ *        overrides it to feed recorded events.
+ */
+void app_event_idle(void);
+
+#endif /* APP_EVENT_H_ */
@@ -0,0 +1,81 @@
+/*
+ * app_fb.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_FB_H_
+#define APP_FB_H_
+
+#include "stm32_lcd.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Software frame buffer behind the LCD utility driver. The scenes can be
+ * rendered into memory without LTDC, DSI and DMA2D, so rendering can be
+ * measured alone and the frames can be dumped as PPM images. The module
+ * depends only on the LCD utility types, so it builds for the host as well.
+ */
+
+#define APP_FB_WIDTH (800U)
+#define APP_FB_HEIGHT (480U)
+/* ARGB8888 */
+#define APP_FB_SIZE (APP_FB_WIDTH * APP_FB_HEIGHT * 4U)
+/* "P6\n800 480\n255\n" header and RGB888 pixels */
+#define APP_FB_PPM_SIZE (15U + APP_FB_WIDTH * APP_FB_HEIGHT * 3U)
+
+/* Driver for UTIL_LCD_SetFuncDriver */
+extern const LCD_UTILS_Drv_t app_fb_driver;
+
+/**
+ * @brief Use the buffer for drawing, the buffer is not cleared
+ * @param pixels APP_FB_SIZE bytes, ARGB8888
+ */
+void app_fb_init(uint32_t *pixels);
+
+/**
+ * @brief Get the buffer
+ * @return uint32_t* ARGB8888 pixels, row by row
+ */
+uint32_t *app_fb_pixels(void);
+
+/**
+ * @brief Get count of pixels written since the last call
+ * @return uint32_t
+ */
+uint32_t app_fb_written(void);
+
+/**
+ * @brief Store the buffer as binary PPM image, alpha is dropped
+ * @param out APP_FB_PPM_SIZE bytes
+ * @param size
+ * @return size_t bytes written, 0 if out is too small
+ */
+size_t app_fb_ppm(uint8_t *out, size_t size);
+
+#endif /* APP_FB_H_ */
@@ -0,0 +1,101 @@
+/*
+ * app_font.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_FONT_H_
+#define APP_FONT_H_
+
+#include "stm32_lcd.h"
+#include <stdint.h>
+
+/*
+ * Anti-aliased fonts compiled by Tools/fontc.py. Glyphs are 4 bpp alpha masks
+ * of their bounding box only, the left pixel is in the low nibble, as DMA2D
+ * reads A4. Every box lies inside the cell of the glyph, its advance by the
+ * line height, so glyphs are drawn without clipping and without overlaps.
+ *
+ * app_font_t starts with sFONT, so the LCD utility takes it for line
+ * positions. The table of sFONT holds the A4 masks, the font must not be
+ * drawn by the utility.
+ */
+
+typedef struct {
+   uint32_t offset; /* first byte of the mask in the table */
+   uint8_t width;   /* box, width is even */
+   uint8_t height;
+   uint8_t left; /* box position in the cell */
+   uint8_t top;
+   uint8_t advance; /* width of the cell */
+} app_font_glyph_t;
+
+typedef struct {
+   sFONT base;                    /* Width is the widest advance */
+   const app_font_glyph_t *glyph; /* count glyphs from first */
+   uint8_t first;
+   uint8_t count;
+} app_font_t;
+
+extern app_font_t FontLato20;
+
+/**
+ * @brief Get the glyph of the character, missing ones are drawn as the first
+ * @param font
+ * @param ascii
+ * @return const app_font_glyph_t*
+ */
+const app_font_glyph_t *app_font_glyph(const app_font_t *font, uint8_t ascii);
+
+/**
+ * @brief Get width of the text, only whole glyphs up to max_width are counted
+ * @param font
+ * @param text
+ * @param max_width
+ * @return uint32_t pixels
+ */
+uint32_t app_font_width(const app_font_t *font, const uint8_t *text,
+                        uint32_t max_width);
+
+/**
+ * @brief Queue drawing of the text line by DMA2D. The line is filled by the
+ *        back color, each glyph is blended in the text color by one
+ *        operation.
+ * @param dst top left pixel of the line, ARGB8888
+ * @param pitch pixels of the frame buffer line
+ * @param max_width glyphs over it are not drawn
+ * @param font
+ * @param text
+ * @param color text color
+ * @param back back color
+ * @return uint32_t drawn width, the line height is font->base.Height
+ */
+uint32_t app_font_draw(uint32_t *dst, uint32_t pitch, uint32_t max_width,
+                       const app_font_t *font, const uint8_t *text,
+                       uint32_t color, uint32_t back);
+
+#endif /* APP_FONT_H_ */
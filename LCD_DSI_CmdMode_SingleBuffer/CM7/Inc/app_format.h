@@ -0,0 +1,122 @@
+/*
+ * app_format.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_FORMAT_H_
+#define APP_FORMAT_H_
+
+#include <stdint.h>
+
+/*
+ * Text formatting into caller buffers without the heap and without the libc
+ * formatter. Functions write no terminating zero and return the end of the
+ * written text, so fields can be chained. Widths are constants at the call
+ * sites, so the inlined loops are specialized by the compiler.
+ */
+
+/* Longest text of app_format_uint without padding */
+#define APP_FORMAT_UINT_MAX (10U)
+/* "HH:MM:SS", hours can be longer */
+#define APP_FORMAT_HMS_MAX (APP_FORMAT_UINT_MAX + 6U)
+
+/**
+ * @brief Write decimal value right aligned to the width, wider values are
+ *        written whole
+ * @param out
+ * @param value
+ * @param width minimal count of characters
+ * @param pad '0' or ' '
+ * @return char* end of the text
+ */
+static inline char *app_format_uint(char *out, uint32_t value,
+                                    const uint32_t width, const char pad)
+{
+   uint32_t digits = 1;
+
+   for (uint32_t rest = value / 10U; rest != 0; rest /= 10U)
+      digits++;
+   const uint32_t len = digits > width ? digits : width;
+
+   char *p = out + len;
+   do {
+      *--p = (char)('0' + value % 10U);
+      value /= 10U;
+   } while (value != 0);
+   while (p > out)
+      *--p = pad;
+   return out + len;
+}
+
+/**
+ * @brief Copy the string without its terminating zero
+ * @param out
+ * @param str
+ * @return char* end of the text
+ */
+char *app_format_str(char *out, const char *str);
+
+/**
+ * @brief Write time as HH:MM:SS
+ * @param out APP_FORMAT_HMS_MAX characters
+ * @param seconds
+ * @return char* end of the text
+ */
+char *app_format_hms(char *out, uint32_t seconds);
+
+#ifdef APP_FORMAT_BENCH
+
+/* Calls measured of every formatter */
+#ifndef APP_FORMAT_BENCH_COUNT
+#define APP_FORMAT_BENCH_COUNT (1000U)
+#endif
+
+/* Costs are in CPU cycles for one text */
+typedef struct {
+   uint32_t done;        /* 1 when results are valid */
+   uint32_t status_libc; /* "  Start in %ld min" by sprintf */
+   uint32_t status;      /* the same by app_format */
+   uint32_t hms_libc;    /* "%02ld:%02ld:%02ld" by sprintf */
+   uint32_t hms;         /* the same by app_format */
+   uint32_t mismatches;  /* texts that differ */
+} app_format_bench_t;
+
+/**
+ * @brief Compare the formatter with sprintf on the texts of the scenes
+ */
+void app_format_bench_run(void);
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_format_bench_t*
+ */
+const app_format_bench_t *app_format_bench_results(void);
+
+#endif /* APP_FORMAT_BENCH */
+
+#endif /* APP_FORMAT_H_ */
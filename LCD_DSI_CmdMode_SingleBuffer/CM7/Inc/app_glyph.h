@@ -0,0 +1,81 @@
+/*
+ * app_glyph.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_GLYPH_H_
+#define APP_GLYPH_H_
+
+#include "stm32_lcd.h"
+#include <stdint.h>
+
+/*
+ * Cache of glyph masks. The fonts are 1 bit per pixel, rows padded to bytes.
+ * On the first use a glyph is expanded into an A8 mask, 0 or 255 per pixel,
+ * in the pool given to app_glyph_init. The mask is drawn by one DMA2D blend
+ * in the text color, instead of one rectangle per glyph row. Masks are never
+ * evicted, printable ASCII of the used fonts fits the pool. The module has no
+ * hardware dependency.
+ */
+
+/* Printable ASCII, as in the font tables */
+#define APP_GLYPH_FIRST (' ')
+#define APP_GLYPH_COUNT (95U)
+/* Fonts in the cache */
+#define APP_GLYPH_FONTS (4U)
+
+typedef struct {
+   uint32_t hits;   /* mask was in the cache */
+   uint32_t misses; /* mask was expanded */
+   uint32_t used;   /* bytes of the pool */
+   uint32_t full;   /* mask did not fit the pool or the font table */
+} app_glyph_stats_t;
+
+/**
+ * @brief Drop all masks and set the pool
+ * @param pool memory readable by DMA2D
+ * @param size in bytes
+ */
+void app_glyph_init(void *pool, uint32_t size);
+
+/**
+ * @brief Get A8 mask of the character, expand it on the first use
+ * @param font
+ * @param ascii
+ * @return const uint8_t* Width * Height bytes, NULL if the character is not
+ *         in the font or the mask does not fit the pool
+ */
+const uint8_t *app_glyph_get(const sFONT *font, uint8_t ascii);
+
+/**
+ * @brief Get statistics of the cache
+ * @return const app_glyph_stats_t*
+ */
+const app_glyph_stats_t *app_glyph_stats(void);
+
+#endif /* APP_GLYPH_H_ */
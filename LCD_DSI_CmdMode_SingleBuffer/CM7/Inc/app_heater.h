@@ -0,0 +1,57 @@
+/*
+ * app_heater.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_HEATER_H_
+#define APP_HEATER_H_
+
+#include "app_scene.h"
+#include <stdint.h>
+
+/*
+ * Heater glue of the M7 side. The heater is on in TURNON_SCENE, the request
+ * is sent to M4 by RPC and its confirmation and the state reported by M4 are
+ * read back into App_t. Messages from M4 post APP_EVENT_CORE. When M4 does
+ * not confirm a state APP_HEATER_TRIES times in a row, the state is not sent
+ * anymore and app->heater_lost is set, until the scene asks for the other
+ * state or a request is confirmed.
+ */
+
+/* Requests of the same state M4 may leave unconfirmed */
+#define APP_HEATER_TRIES (3U)
+
+/**
+ * @brief Send the heater state of the scene to M4 when it changes and read
+ *        the state reported back
+ * @param app
+ * @return uint32_t ms until it has to run again, 0 if nothing waits
+ */
+uint32_t APP_TurnPeripheries(App_t *app);
+
+#endif /* APP_HEATER_H_ */
@@ -0,0 +1,142 @@
+/*
+ * app_lcd.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_LCD_H_
+#define APP_LCD_H_
+
+#include "app_rect.h"
+#include "stm32_lcd.h"
+#include <stdint.h>
+
+/*
+ * Drawing of the LCD utility into the frame buffers. Drawing is queued to
+ * DMA2D, text is blended from the glyph cache and widgets can be copied from
+ * the sprite cache. Drawn areas are collected, the drawn back buffer is
+ * presented by refreshing only them, region by region by LCD_RefreshRegion.
+ */
+
+/* Size of the display */
+#define HACT 800
+#define VACT 480
+
+/* Driver of the LCD utility, written areas are collected for the refresh */
+extern const LCD_UTILS_Drv_t LCD_UTIL_Driver;
+
+/**
+ * @brief Set up the frame buffers, the DMA2D queue and the caches of glyphs
+ *        and sprites
+ */
+void LCD_DrawInit(void);
+
+/**
+ * @brief Draw text from the glyph cache by DMA2D or row by row by the LCD
+ *        utility
+ * @param enable 1 for the glyph cache
+ */
+void LCD_SetGlyphs(uint8_t enable);
+
+/**
+ * @brief Gets the LCD X size
+ */
+int32_t LCD_GetXSize(uint32_t Instance, uint32_t *XSize);
+
+/**
+ * @brief Gets the LCD Y size
+ */
+int32_t LCD_GetYSize(uint32_t Instance, uint32_t *YSize);
+
+/**
+ * @brief Get address of the pixel in the drawn buffer or sprite
+ */
+uint32_t *LCD_DrawAddress(uint32_t Xpos, uint32_t Ypos);
+
+/**
+ * @brief Get pixels per line of the drawn buffer or sprite
+ */
+uint32_t LCD_DrawPitch(void);
+
+/**
+ * @brief Begin drawing of the area from the sprite cache
+ * @param key hash of the drawn content, placement is not part of it
+ * @return uint32_t 1 if the area has to be drawn and ended by LCD_EndSprite
+ */
+uint32_t LCD_BeginSprite(uint64_t key, uint32_t Xpos, uint32_t Ypos,
+                         uint32_t Width, uint32_t Height);
+
+/**
+ * @brief End drawing of the area begun by LCD_BeginSprite
+ */
+void LCD_EndSprite(void);
+
+/**
+ * @brief Get the sprite key of a text
+ */
+uint64_t LCD_TextKey(const char *text, const sFONT *font, uint32_t color,
+                     uint32_t back);
+
+/**
+ * @brief Set the font of the LCD utility or its anti-aliased substitute
+ */
+void LCD_SetFont(sFONT *font);
+
+/**
+ * @brief Displays character of the current font
+ */
+void LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii);
+
+/**
+ * @brief Displays the string at the line of the current font
+ */
+void LCD_DisplayStringAtLine(uint32_t Line, uint8_t *ptr);
+
+/**
+ * @brief Get address of the frame buffer
+ * @param Index 0 or 1
+ */
+uint32_t LCD_Buffer(uint32_t Index);
+
+/**
+ * @brief Start drawing into the back buffer
+ * @return int 0 on success, -1 if the back buffer waits for the refresh
+ */
+int LCD_BeginDraw(void);
+
+/**
+ * @brief Present the drawn back buffer
+ */
+void APP_RefreshDisplay(void);
+
+/**
+ * @brief End of the refresh of one region, called from the end of refresh
+ *        interrupt
+ */
+void LCD_RefreshDone(void);
+
+#endif /* APP_LCD_H_ */
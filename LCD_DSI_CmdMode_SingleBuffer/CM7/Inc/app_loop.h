@@ -0,0 +1,58 @@
+/*
+ * app_loop.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_LOOP_H_
+#define APP_LOOP_H_
+
+#include "app_scene.h"
+
+/* Touch screen instance read by the main loop */
+#define TS_INSTANCE 0
+
+/*
+ * Main loop of M7. It sleeps in app_event_wait() until an event, steps the
+ * scene logic, renders the scene and talks to M4. The board and the host
+ * build run the same loop, the host feeds the events by app_event_idle().
+ */
+
+/**
+ * @brief Clear the display, init the app and post all events to render the
+ *        first frame. LCD and touch have to be initialized.
+ * @param app
+ */
+void APP_Start(App_t *app);
+
+/**
+ * @brief Run one iteration of the main loop, it sleeps until an event
+ * @param app
+ */
+void APP_Loop(App_t *app);
+
+#endif /* APP_LOOP_H_ */
@@ -0,0 +1,90 @@
+/*
+ * app_present.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_PRESENT_H_
+#define APP_PRESENT_H_
+
+#include "app_rect.h"
+#include <stdint.h>
+
+/*
+ * Presentation of frames by the display refresh, without the hardware. With
+ * two buffers, the next frame is drawn into the back buffer while the front
+ * one is refreshed. A finished back buffer is fenced until the refresh ends,
+ * then the buffers are swapped and the refresh of the new front starts. The
+ * new back buffer misses what was drawn into the front, these areas are
+ * copied before drawing. With one buffer, drawing waits for the refresh.
+ *
+ * app_present_done is called from the end of refresh interrupt, the other
+ * calls have to be done with the interrupt masked.
+ */
+
+typedef struct {
+   uint32_t buffers;       /* 1 or 2 */
+   uint32_t back;          /* buffer for drawing */
+   uint32_t front;         /* buffer on the display */
+   uint32_t busy;          /* front is being refreshed */
+   uint32_t queued;        /* back is done, it waits for the refresh */
+   app_rect_set_t dirty;   /* drawn into back since the last queue */
+   app_rect_set_t stale;   /* areas of back older than front */
+   app_rect_set_t refresh; /* regions of the refresh of front */
+} app_present_t;
+
+/**
+ * @brief Reset the state, no refresh is running
+ * @param present
+ * @param buffers 1 or 2
+ */
+void app_present_init(app_present_t *present, uint32_t buffers);
+
+/**
+ * @brief Start drawing into the back buffer
+ * @param present
+ * @param copy areas to copy from front to back before drawing
+ * @return int 0 on success, -1 if drawing has to wait for the refresh
+ */
+int app_present_begin(app_present_t *present, app_rect_set_t *copy);
+
+/**
+ * @brief Queue the drawn back buffer for the refresh
+ * @param present
+ * @return uint32_t 1 if the refresh of present->refresh regions of the front
+ *         buffer has to be started now
+ */
+uint32_t app_present_queue(app_present_t *present);
+
+/**
+ * @brief End of the refresh of the front buffer
+ * @param present
+ * @return uint32_t 1 if the refresh of the queued buffer has to be started
+ */
+uint32_t app_present_done(app_present_t *present);
+
+#endif /* APP_PRESENT_H_ */
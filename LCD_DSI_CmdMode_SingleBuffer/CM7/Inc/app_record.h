@@ -0,0 +1,143 @@
+/*
+ * app_record.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_RECORD_H_
+#define APP_RECORD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Recorder of the main loop inputs. Every step of the scene logic is one
+ * entry: time since the previous entry and packed inputs (events, touch,
+ * scheduled starts) with the heater command as the output. Entries are kept
+ * in a ring of blocks, every block starts with a keyframe of the app state, so
+ * the replay can start from the oldest block. The ring is in AXI SRAM, which is
+ * not cleared by startup code, so it is kept over reset. Every boot starts a
+ * new session in a new block, the replay reloads the app state there. The
+ * recording is replayed by the host build (Host/Src/host_replay.c) from a dump
+ * of AXI SRAM.
+ */
+
+#define APP_RECORD_BLOCKS (16U)
+#define APP_RECORD_BLOCK_SIZE (256U)
+/* Max size of the keyframe */
+#define APP_RECORD_STATE_SIZE (512U)
+
+/* Packing of the entry input */
+#define APP_RECORD_EVENTS_Msk (0x1FU)       /* APP_EVENT_* flags */
+#define APP_RECORD_SAMPLED (1U << 5)        /* touch was read */
+#define APP_RECORD_TOUCHED (1U << 6)        /* touch was detected */
+#define APP_RECORD_X_Pos (7U)               /* 10 bits */
+#define APP_RECORD_Y_Pos (17U)              /* 10 bits */
+#define APP_RECORD_COORD_Msk (0x3FFU)
+#define APP_RECORD_ALARMS_Pos (27U)         /* scheduled starts, 3 bits */
+#define APP_RECORD_ALARMS_Msk (0x7U)
+#define APP_RECORD_HEATER (1U << 30)        /* output, heater is on */
+
+typedef struct {
+   uint32_t delta_us; /* time since the previous entry */
+   uint32_t input;    /* APP_RECORD_* fields */
+} app_record_entry_t;
+
+/* Position of the replay in the ring */
+typedef struct {
+   uint32_t block; /* blocks from the oldest one */
+   uint32_t entry;
+   uint64_t time_us; /* time of the last returned entry */
+} app_record_cursor_t;
+
+/**
+ * @brief Drop all entries and start a new recording
+ */
+void app_record_init(void);
+
+/**
+ * @brief Start a new session after boot. The recording from before reset is
+ *        kept, if it is valid, otherwise a new recording is started.
+ */
+void app_record_start(void);
+
+/**
+ * @brief Check whether the ring holds a recording, e.g. from before reset
+ * @return 1 if valid
+ */
+int app_record_valid(void);
+
+/**
+ * @brief Add entry, called before the step is processed. The state is stored
+ *        as a keyframe, when the entry opens a new block.
+ * @param time_us time of the step
+ * @param input APP_RECORD_* fields
+ * @param state app state before the step
+ * @param size size of the state, at most APP_RECORD_STATE_SIZE
+ */
+void app_record_put(uint64_t time_us, uint32_t input, const void *state,
+                    size_t size);
+
+/**
+ * @brief Add output of the step to the last entry and keep the state after
+ *        the step to check the replay
+ * @param output APP_RECORD_HEATER
+ * @param state app state after the step
+ * @param size
+ */
+void app_record_output(uint32_t output, const void *state, size_t size);
+
+/**
+ * @brief Start the replay at the oldest block, recording stops until
+ *        app_record_start()
+ * @param cursor
+ * @param state keyframe of the oldest block is copied here
+ * @param size
+ * @return 0 on success, -1 if there is no recording
+ */
+int app_record_first(app_record_cursor_t *cursor, void *state, size_t size);
+
+/**
+ * @brief Get next entry of the replay
+ * @param cursor
+ * @param entry
+ * @param state keyframe is copied here, if the entry starts a new session
+ * @param size
+ * @return 0 on success, 1 if the entry starts a new session, -1 at the end of
+ *         the recording
+ */
+int app_record_next(app_record_cursor_t *cursor, app_record_entry_t *entry,
+                    void *state, size_t size);
+
+/**
+ * @brief Get the state after the last recorded step
+ * @param state
+ * @param size
+ */
+void app_record_last_state(void *state, size_t size);
+
+#endif /* APP_RECORD_H_ */
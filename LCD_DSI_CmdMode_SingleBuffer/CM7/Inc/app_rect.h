@@ -0,0 +1,125 @@
+/*
+ * app_rect.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_RECT_H_
+#define APP_RECT_H_
+
+#include <stdint.h>
+
+/*
+ * Dirty rectangles of the frame buffer, coalesced into a few regions for the
+ * partial refresh of the display. Every region costs a fixed setup of the
+ * display window, so close rectangles are merged if the union wastes less
+ * than APP_RECT_SLACK pixels. When all slots are used, the new rectangle is
+ * merged with the region it grows the least. The module has no hardware
+ * dependency.
+ */
+
+/* Regions refreshed separately */
+#define APP_RECT_MAX (4U)
+/* Pixels worth the setup of one region, about 4 lines of the display */
+#define APP_RECT_SLACK (3200U)
+
+typedef struct {
+   uint16_t x0, y0; /* top left, inclusive */
+   uint16_t x1, y1; /* bottom right, exclusive */
+} app_rect_t;
+
+typedef struct {
+   uint32_t count;
+   app_rect_t rect[APP_RECT_MAX];
+} app_rect_set_t;
+
+/**
+ * @brief Drop all regions
+ * @param set
+ */
+static inline void app_rect_clear(app_rect_set_t *set) { set->count = 0; }
+
+/**
+ * @brief Add dirty rectangle, empty ones are ignored
+ * @param set
+ * @param x
+ * @param y
+ * @param width
+ * @param height
+ */
+void app_rect_add(app_rect_set_t *set, uint32_t x, uint32_t y, uint32_t width,
+                  uint32_t height);
+
+/**
+ * @brief Get pixels covered by the regions, overlaps are counted twice
+ * @param set
+ * @return uint32_t
+ */
+uint32_t app_rect_area(const app_rect_set_t *set);
+
+#ifdef APP_RECT_BENCH
+
+/* Repeats of every pattern */
+#ifndef APP_RECT_BENCH_COUNT
+#define APP_RECT_BENCH_COUNT (100U)
+#endif
+
+/* Update patterns of the toaster UI */
+typedef enum {
+   APP_RECT_PATTERN_PROGRESS,  /* progress bar moves */
+   APP_RECT_PATTERN_COUNTDOWN, /* status text and progress bar */
+   APP_RECT_PATTERN_DIAL,      /* timer dial text */
+   APP_RECT_PATTERN_SCENE,     /* all widgets of a new scene */
+   APP_RECT_PATTERN_COUNT
+} app_rect_pattern_t;
+
+typedef struct {
+   uint32_t adds;    /* rectangles added by one update */
+   uint32_t add_avg; /* CPU cycles of app_rect_add */
+   uint32_t regions; /* regions after coalescing */
+   uint32_t area;    /* pixels refreshed, full screen is 384000 */
+} app_rect_bench_pattern_t;
+
+typedef struct {
+   uint32_t done; /* 1 when results are valid */
+   app_rect_bench_pattern_t pattern[APP_RECT_PATTERN_COUNT];
+} app_rect_bench_t;
+
+/**
+ * @brief Measure the coalescing on the update patterns of the UI
+ */
+void app_rect_bench_run(void);
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_rect_bench_t*
+ */
+const app_rect_bench_t *app_rect_bench_results(void);
+
+#endif /* APP_RECT_BENCH */
+
+#endif /* APP_RECT_H_ */
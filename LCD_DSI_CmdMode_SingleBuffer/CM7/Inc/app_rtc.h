@@ -0,0 +1,121 @@
+/*
+ * app_rtc.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_RTC_H_
+#define APP_RTC_H_
+
+#include <stdint.h>
+
+/*
+ * RTC calendar of the schedule. The schedule is kept in the RTC backup
+ * registers over reset, its first entry is armed as RTC alarm A, which posts
+ * APP_EVENT_ALARM.
+ */
+
+/**
+ * @brief Init RTC, the calendar keeps running over reset
+ */
+void RTC_Init(void);
+
+/**
+ * @brief Read the RTC calendar
+ * @return uint32_t seconds since 2000-01-01 00:00:00
+ */
+uint32_t APP_RtcNow(void);
+
+/**
+ * @brief Set the calendar to the seed if it is behind it, the schedule is not
+ *        touched
+ * @param seed seconds since 2000-01-01 00:00:00, 0 for none
+ * @return 1 if the calendar was set
+ */
+uint8_t APP_RtcSeed(uint32_t seed);
+
+/**
+ * @brief Set the calendar, weekly entries of the schedule keep their time of
+ *        the week, one shot entries keep their delay
+ * @param time seconds since 2000-01-01 00:00:00
+ */
+void APP_RtcSet(uint32_t time);
+
+/**
+ * @brief Detach the schedule from the RTC while the recording is replayed
+ * @param replaying 1 during the replay
+ */
+void APP_RtcReplay(uint8_t replaying);
+
+/**
+ * @brief Set the recorded count of scheduled starts, APP_ScheduleDue() takes
+ * it while replaying
+ * @param count
+ */
+void APP_RtcReplayDue(uint32_t count);
+
+/**
+ * @brief Load the schedule from the RTC backup registers, on the first boot
+ *        the weekly starts are added
+ * @param now current time
+ */
+void APP_ScheduleRestore(uint32_t now);
+
+/**
+ * @brief Add a weekly start, it is kept over reset
+ * @param weekday APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ * @param hours
+ * @param minutes
+ * @return id of the entry, 0 if the schedule is full or the time is invalid
+ */
+uint16_t APP_ScheduleAddWeekly(uint8_t weekday, uint8_t hours,
+                               uint8_t minutes);
+
+/**
+ * @brief Remove an entry of the schedule, e.g. a weekly start
+ * @param id
+ * @return 0 on success, -1 if there is no such entry
+ */
+int APP_ScheduleRemove(uint16_t id);
+
+/**
+ * @brief Save the schedule into the RTC backup registers
+ */
+void APP_ScheduleStore(void);
+
+/**
+ * @brief Set RTC alarm A to the first entry of the schedule
+ */
+void APP_ScheduleArm(void);
+
+/**
+ * @brief Take all due entries of the schedule and arm the alarm for the next
+ * @return uint32_t count of scheduled starts to dispatch
+ */
+uint32_t APP_ScheduleDue(void);
+
+#endif /* APP_RTC_H_ */
@@ -0,0 +1,204 @@
+/*
+ * app_scene.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_SCENE_H_
+#define APP_SCENE_H_
+
+#include "app_schedule.h"
+#include "app_timer.h"
+#include "core_snapshot.h"
+#include "stm32_lcd.h"
+#include "stm32h747i_discovery_ts.h"
+#include <stdint.h>
+
+/*
+ * Scene logic of the toaster. Touch, timer expiry and scheduled starts are
+ * events, the next scene is looked up in the transition table and its entry
+ * action is called. A step depends only on its inputs and on app->now, so the
+ * recorded steps can be replayed.
+ */
+
+#define SECOND 1000
+
+#define APP_COLOR_BACKGROUND UTIL_LCD_COLOR_CUSTOM_Stone
+#define APP_COLOR_RED UTIL_LCD_COLOR_RED
+#define APP_COLOR_BLUE UTIL_LCD_COLOR_CUSTOM_Blue
+#define APP_COLOR_TEXT UTIL_LCD_COLOR_WHITE
+#define APP_COLOR_GREEN UTIL_LCD_COLOR_DARKGREEN
+#define APP_COLOR_YELLOW UTIL_LCD_COLOR_CUSTOM_Yellow
+#define APP_COLOR_STONE UTIL_LCD_COLOR_BLACK
+
+typedef enum {
+   FRONT_SCREEN,
+   TURNON_SCENE,
+   TIMER_CONFIG_SCENE,
+   WAITING_SCENE,
+   SCENE_COUNT,
+   SCENE_NONE = SCENE_COUNT /* no transition */
+} Scene_t;
+typedef enum { PUSH_BUTTON, TIMER_BUTTON, NONE } Button_type_t;
+typedef enum {
+   EVENT_LEFT_BUTTON,
+   EVENT_RIGHT_BUTTON,
+   EVENT_TIMER_EXPIRED,
+   EVENT_SCHEDULED_START,
+   EVENT_COUNT
+} Event_t;
+
+typedef struct {
+   Scene_t scene;
+   uint64_t now_us; /* time of the current step by the core clock */
+   uint32_t now;    /* the same in ms */
+   uint8_t _delay;
+   uint32_t delay_start;
+   char status_message[50];
+   uint32_t status_minutes; /* shown in WAITING_SCENE, UINT32_MAX none */
+   uint32_t status_version; /* changed with status_message */
+   char title[50];
+   uint32_t status_color;
+   uint16_t progress_bar;
+   uint32_t timer;
+   uint32_t config_timer;
+   uint32_t timer_left;
+   uint64_t timer_start_time; /* core clock in us */
+   app_timer_t timer_expiry;
+   uint16_t delayed_start; /* schedule entry of WAITING_SCENE */
+   uint32_t button_left_color;
+   Button_type_t button_left_type;
+   uint32_t button_right_color;
+   Button_type_t button_right_type;
+   core_snapshot_t heater;       /* last consistent state reported by M4 */
+   uint32_t heater_read_errors;  /* snapshot reads kept the previous state */
+   uint8_t heater_confirmed; /* M4 applied the state of the scene */
+   uint8_t heater_lost;      /* M4 did not confirm APP_HEATER_TRIES requests */
+   uint8_t touch_held; /* touch detected by the previous read */
+} App_t;
+
+/* App state stored by the recorder, timer wheel and schedule included */
+typedef struct {
+   App_t app;
+   uint32_t timer_active;
+   uint32_t timer_expires;
+   uint32_t schedule_count;
+   app_schedule_entry_t schedule[APP_SCHEDULE_SIZE];
+} App_keyframe_t;
+
+/**
+ * @brief Set up the front scene and the timer wheel
+ * @param app
+ */
+void APP_Init(App_t *app);
+
+/**
+ * @brief Get titles under the buttons of the scene
+ * @param scene
+ * @return const char* titles
+ */
+const char *APP_ButtonTitles(Scene_t scene);
+
+/**
+ * @brief Check that the touch is inside of the area, the bounds are excluded
+ * @param s touch read from the touch screen
+ * @param x_max
+ * @param x_min
+ * @param y_max
+ * @param y_min
+ * @return uint8_t 1 if inside
+ */
+uint8_t APP_HandleTouch_IsInInterval(TS_State_t *s, uint32_t x_max,
+                                     uint32_t x_min, uint32_t y_max,
+                                     uint32_t y_min);
+
+/**
+ * @brief Dispatch the event by the transition table
+ * @param app
+ * @param event
+ */
+void APP_Dispatch(App_t *app, Event_t event);
+
+/**
+ * @brief Set the scene and its look, the entry action is not called
+ * @param app
+ * @param scene
+ */
+void APP_SceneLook(App_t *app, Scene_t scene);
+
+/**
+ * @brief Format the countdown into the status message
+ * @param app
+ * @param minutes
+ */
+void APP_FormatStatus(App_t *app, uint32_t minutes);
+
+/**
+ * @brief Remove the delayed start of the waiting scene from the schedule
+ * @param app
+ */
+void APP_CancelDelayedStart(App_t *app);
+
+/**
+ * @brief Handle the touch read in this step, only a press counts
+ * @param TS_State
+ * @param app
+ */
+void APP_HandleTouch(TS_State_t *TS_State, App_t *app);
+
+/**
+ * @brief One step of the scene logic
+ * @param app
+ * @param input APP_RECORD_* fields
+ * @param TS_State touch read in this step
+ */
+void APP_Step(App_t *app, uint32_t input, TS_State_t *TS_State);
+
+/**
+ * @brief Do the step and record its inputs and the heater state after it
+ * @param app
+ * @param input APP_RECORD_* fields
+ * @param TS_State touch read in this step
+ */
+void APP_RecordStep(App_t *app, uint32_t input, TS_State_t *TS_State);
+
+/**
+ * @brief Store the state of the scene logic
+ * @param app
+ * @param keyframe
+ */
+void APP_KeyframeSave(App_t *app, App_keyframe_t *keyframe);
+
+/**
+ * @brief Restore the state of the scene logic with the timer wheel and the
+ *        schedule
+ * @param app
+ * @param keyframe
+ */
+void APP_KeyframeRestore(App_t *app, const App_keyframe_t *keyframe);
+
+#endif /* APP_SCENE_H_ */
@@ -0,0 +1,154 @@
+/*
+ * app_schedule.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_SCHEDULE_H_
+#define APP_SCHEDULE_H_
+
+#include <stdint.h>
+
+/*
+ * Wall clock schedule of the toaster starts. Entries are kept in a min-heap
+ * keyed by the next fire time, so the RTC alarm is always set to the top.
+ * Weekly entries are put back one week later when they fire, one shot entries
+ * are dropped. Time is in seconds since 2000-01-01 00:00:00, the RTC epoch.
+ * The module has no HW dependency, the clock is always passed by the caller.
+ */
+
+#define APP_SCHEDULE_SIZE (8U)
+
+#define APP_SCHEDULE_DAY (24UL * 60UL * 60UL)
+#define APP_SCHEDULE_WEEK (7UL * APP_SCHEDULE_DAY)
+
+/* Days of the week, same numbering as RTC_WEEKDAY_* */
+#define APP_SCHEDULE_MONDAY (1U)
+#define APP_SCHEDULE_SUNDAY (7U)
+
+typedef struct {
+   uint32_t fire;   /* next fire time */
+   uint16_t id;     /* given by app_schedule_add, never 0 */
+   uint16_t weekly; /* 1 entry repeats every week */
+} app_schedule_entry_t;
+
+/**
+ * @brief Drop all entries
+ */
+void app_schedule_init(void);
+
+/**
+ * @brief Add an entry
+ * @param fire fire time
+ * @param weekly 1 entry repeats every week
+ * @return id of the entry, 0 if the schedule is full
+ */
+uint16_t app_schedule_add(uint32_t fire, uint16_t weekly);
+
+/**
+ * @brief Add an entry repeated every week on the day at the time
+ * @param now current time
+ * @param weekday APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ * @param hours
+ * @param minutes
+ * @return id of the entry, 0 if the schedule is full
+ */
+uint16_t app_schedule_add_weekly(uint32_t now, uint8_t weekday, uint8_t hours,
+                                 uint8_t minutes);
+
+/**
+ * @brief Remove the entry
+ * @param id
+ * @return 0 on success, -1 if there is no such entry
+ */
+int app_schedule_remove(uint16_t id);
+
+/**
+ * @brief Get the entry to fire first
+ * @param entry
+ * @return 0 on success, -1 if the schedule is empty
+ */
+int app_schedule_peek(app_schedule_entry_t *entry);
+
+/**
+ * @brief Take the first entry if its time has come, a weekly entry is put back
+ *        to its next week. Call it until it returns -1.
+ * @param now current time
+ * @param entry
+ * @return 0 on success, -1 if there is no entry to fire
+ */
+int app_schedule_pop(uint32_t now, app_schedule_entry_t *entry);
+
+/**
+ * @brief Copy all entries, e.g. to keep them over reset
+ * @param entries array of APP_SCHEDULE_SIZE entries
+ * @return count of entries
+ */
+unsigned int app_schedule_save(app_schedule_entry_t *entries);
+
+/**
+ * @brief Restore saved entries. Weekly entries missed in the meantime are
+ *        moved to their next week, missed one shot entries are dropped.
+ * @param entries
+ * @param count
+ * @param now current time
+ */
+void app_schedule_load(const app_schedule_entry_t *entries, unsigned int count,
+                       uint32_t now);
+
+/**
+ * @brief Convert calendar to time
+ * @param year 0 .. 99, years since 2000
+ * @param month 1 .. 12
+ * @param day 1 .. 31
+ * @param hours
+ * @param minutes
+ * @param seconds
+ * @return uint32_t time
+ */
+uint32_t app_schedule_time(uint8_t year, uint8_t month, uint8_t day,
+                           uint8_t hours, uint8_t minutes, uint8_t seconds);
+
+/**
+ * @brief Convert time to calendar date, the time of the day is the rest of
+ *        APP_SCHEDULE_DAY
+ * @param time
+ * @param year 0 .. 99, years since 2000
+ * @param month 1 .. 12
+ * @param day 1 .. 31
+ */
+void app_schedule_date(uint32_t time, uint8_t *year, uint8_t *month,
+                       uint8_t *day);
+
+/**
+ * @brief Get the day of the week of the time
+ * @param time
+ * @return APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ */
+uint8_t app_schedule_weekday(uint32_t time);
+
+#endif /* APP_SCHEDULE_H_ */
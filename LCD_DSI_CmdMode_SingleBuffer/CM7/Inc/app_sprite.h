@@ -0,0 +1,91 @@
+/*
+ * app_sprite.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_SPRITE_H_
+#define APP_SPRITE_H_
+
+#include <stdint.h>
+
+/*
+ * Cache of pre-rendered ARGB8888 sprites. A sprite is found by a key, the
+ * hash of what is drawn in it (text, font and colors, or shape, size and
+ * colors), and by its size. On a miss the pixels are allocated in the pool
+ * and the caller draws the sprite, later draws copy it by one DMA2D
+ * operation. The pool is a fixed budget, least recently used sprites are
+ * evicted until the new one fits. The module has no hardware dependency.
+ */
+
+/* Sprites in the cache */
+#define APP_SPRITE_MAX (16U)
+/* Start of app_sprite_hash, FNV-1a offset basis */
+#define APP_SPRITE_SEED (14695981039346656037ULL)
+
+typedef struct {
+   uint32_t hits;      /* sprite was in the cache */
+   uint32_t misses;    /* sprite was allocated and has to be drawn */
+   uint32_t evictions; /* sprites dropped for a new one */
+   uint32_t too_big;   /* sprite did not fit the empty pool */
+   uint32_t used;      /* bytes of the pool */
+} app_sprite_stats_t;
+
+/**
+ * @brief Drop all sprites and set the pool
+ * @param pool memory readable and writable by DMA2D
+ * @param size in bytes
+ */
+void app_sprite_init(void *pool, uint32_t size);
+
+/**
+ * @brief Add data to the key, FNV-1a
+ * @param hash APP_SPRITE_SEED or previous hash
+ * @param data
+ * @param size in bytes
+ * @return uint64_t
+ */
+uint64_t app_sprite_hash(uint64_t hash, const void *data, uint32_t size);
+
+/**
+ * @brief Find the sprite, allocate it on a miss
+ * @param key
+ * @param width
+ * @param height
+ * @param created set to 1 if the sprite was allocated and has to be drawn
+ * @return uint32_t* width * height pixels, NULL if it does not fit the pool
+ */
+uint32_t *app_sprite_get(uint64_t key, uint32_t width, uint32_t height,
+                         uint32_t *created);
+
+/**
+ * @brief Get statistics of the cache
+ * @return const app_sprite_stats_t*
+ */
+const app_sprite_stats_t *app_sprite_stats(void);
+
+#endif /* APP_SPRITE_H_ */
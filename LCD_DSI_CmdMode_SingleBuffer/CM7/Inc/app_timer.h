@@ -0,0 +1,146 @@
+/*
+ * app_timer.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_TIMER_H_
+#define APP_TIMER_H_
+
+#include <stdint.h>
+
+/*
+ * Hierarchical timer wheel driven by the ms tick. Level 0 has one slot per
+ * tick, every next level has one slot per whole previous level. Start, cancel
+ * and expire are O(1), timers are moved one level down when the wheel reaches
+ * their slot. Callbacks run from app_timer_run in the main loop context.
+ */
+
+/* Slots of one level are 1 << APP_TIMER_BITS */
+#define APP_TIMER_BITS (6U)
+#define APP_TIMER_SLOTS (1U << APP_TIMER_BITS)
+/* 5 levels cover 2^30 ms (12 days), longer timers wait at the last level */
+#define APP_TIMER_LEVELS (5U)
+
+typedef struct app_timer app_timer_t;
+typedef void (*app_timer_cb_t)(app_timer_t *timer, void *arg);
+
+/* Timer node, owned by the caller and linked into the wheel while active */
+struct app_timer {
+   app_timer_t *next;
+   app_timer_t **pprev; /* NULL while not active */
+   uint32_t expires;    /* tick of expiry */
+   app_timer_cb_t callback;
+   void *arg;
+};
+
+/**
+ * @brief Reset the wheel, all timers are dropped
+ * @param now current tick in ms
+ */
+void app_timer_init(uint32_t now);
+
+/**
+ * @brief Start the timer, an active timer is restarted. Expiry in the past
+ *        fires on the next app_timer_run.
+ * @param timer
+ * @param expires tick of expiry in ms
+ * @param callback called from app_timer_run, the timer may be started again
+ * @param arg passed to the callback
+ */
+void app_timer_start(app_timer_t *timer, uint32_t expires,
+                     app_timer_cb_t callback, void *arg);
+
+/**
+ * @brief Stop the timer, nothing happens if it is not active
+ * @param timer
+ */
+void app_timer_cancel(app_timer_t *timer);
+
+/**
+ * @brief Check whether the timer waits for expiry
+ * @param timer
+ * @return 1 if active
+ */
+int app_timer_active(const app_timer_t *timer);
+
+/**
+ * @brief Advance the wheel up to now and call callbacks of expired timers.
+ *        Ticks without any work are skipped.
+ * @param now current tick in ms
+ */
+void app_timer_run(uint32_t now);
+
+/**
+ * @brief Get the next tick when app_timer_run has some work, it is an expiry
+ *        or a move of timers to lower level
+ * @param next tick in ms
+ * @return 0 on success, -1 if there is no active timer
+ */
+int app_timer_next(uint32_t *next);
+
+#ifdef APP_TIMER_BENCH
+
+/* Timers armed during the benchmark */
+#ifndef APP_TIMER_BENCH_COUNT
+#define APP_TIMER_BENCH_COUNT (10000U)
+#endif
+
+/* Ticks measured during the benchmark */
+#ifndef APP_TIMER_BENCH_TICKS
+#define APP_TIMER_BENCH_TICKS (100000U)
+#endif
+
+/* Costs are measured by core_clock_us() */
+typedef struct {
+   uint32_t done;        /* 1 when results are valid */
+   uint32_t timers;      /* active timers during the measurement */
+   uint32_t expired;     /* callbacks called */
+   uint32_t start_ns;    /* average app_timer_start */
+   uint32_t cancel_ns;   /* average app_timer_cancel */
+   uint32_t tick_ns;     /* average app_timer_run for one tick */
+   uint32_t tick_max_us; /* slowest tick, a cascade of the upper levels */
+} app_timer_bench_t;
+
+/**
+ * @brief Measure the wheel with timers restarted on expiry. Costs are
+ *        averaged over the whole loops, since one operation is shorter than
+ *        the microsecond of the clock. The wheel is reset afterwards.
+ * @param timers storage of the timers, owned by the caller
+ * @param count of the timers
+ */
+void app_timer_bench_run(app_timer_t *timers, uint32_t count);
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_timer_bench_t*
+ */
+const app_timer_bench_t *app_timer_bench_results(void);
+
+#endif /* APP_TIMER_BENCH */
+
+#endif /* APP_TIMER_H_ */
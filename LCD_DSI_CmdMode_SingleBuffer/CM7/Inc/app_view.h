@@ -0,0 +1,87 @@
+/*
+ * app_view.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef APP_VIEW_H_
+#define APP_VIEW_H_
+
+#include "app_scene.h"
+#include <stdint.h>
+
+/*
+ * Retained widgets of the scenes. A widget is drawn only when the part of
+ * App_t it shows changes, the drawn frame is presented by the partial
+ * refresh.
+ */
+
+#ifdef APP_RENDER_STATS
+/* CPU time of drawing the frames on the LCD, LCD_DMA2D_QUEUE 0 and 1 are
+ compared by it */
+typedef struct {
+   uint32_t frames;    /* drawn frames */
+   uint64_t render_us; /* drawing, BSP includes waiting for each DMA2D op */
+   uint64_t flush_us;  /* waiting for the queued DMA2D operations */
+   uint32_t frame_us;  /* CPU busy per frame, drawing and waiting */
+} App_render_stats_t;
+#endif
+
+/**
+ * @brief Draw the changed widgets into the back buffer and present it, it is
+ *        deferred while the back buffer waits for the refresh
+ * @param app
+ */
+void APP_UpdateScene(App_t *app);
+
+/**
+ * @brief Draw the widgets that show changed part of the app struct
+ * @param app
+ * @return uint32_t count of drawn widgets
+ */
+uint32_t APP_RenderScene(App_t *app);
+
+/**
+ * @brief Mark all widgets as not drawn, the frame buffer was cleared
+ */
+void APP_InvalidateScene(void);
+
+/**
+ * @brief Check that drawing of the scene waits for the end of the refresh
+ * @return uint8_t 1 if APP_UpdateScene has to be called on APP_EVENT_REFRESH
+ */
+uint8_t APP_RenderDeferred(void);
+
+#ifdef APP_RENDER_STATS
+/**
+ * @brief Get the CPU time of the frames drawn by APP_UpdateScene
+ * @return const App_render_stats_t*
+ */
+const App_render_stats_t *APP_RenderStats(void);
+#endif
+
+#endif /* APP_VIEW_H_ */
@@ -23,6 +23,34 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal.h"
 
+#include "app_bench.h"
+#include "app_dma2d.h"
+#include "app_dsi.h"
+#include "app_event.h"
+#include "app_fb.h"
+#include "app_font.h"
+#include "app_format.h"
+#include "app_glyph.h"
+#include "app_heater.h"
+#include "app_lcd.h"
+#include "app_loop.h"
+#include "app_present.h"
+#include "app_record.h"
+#include "app_rect.h"
+#include "app_rtc.h"
+#include "app_scene.h"
+#include "app_schedule.h"
+#include "app_sprite.h"
+#include "app_timer.h"
+#include "app_view.h"
+#include "core_bench.h"
+#include "core_clock.h"
+#include "core_cache.h"
+#include "core_lock.h"
+#include "core_notify.h"
+#include "core_protocol.h"
+#include "core_rpc.h"
+#include "core_snapshot.h"
 #include "cores_communication.h"
 #include "stm32_lcd.h"
 #include "stm32h747i_discovery.h"
@@ -32,8 +60,40 @@
 #include "stm32h747i_discovery_ts.h"
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+/* SDRAM, the host build maps it elsewhere */
+#ifndef LCD_FRAME_BUFFER
 #define LCD_FRAME_BUFFER 0xD0000000
+#endif
+#define LCD_FRAME_BUFFER_SIZE (800 * 480 * 4)
+/* Frame buffers in SDRAM, 2 for drawing during the refresh */
+#ifndef LCD_BUFFERS
+#define LCD_BUFFERS 2
+#endif
+/* Drawing by queued DMA2D operations, 0 for BSP drawing waiting for each */
+#ifndef LCD_DMA2D_QUEUE
+#define LCD_DMA2D_QUEUE 1
+#endif
+/* Text drawn by DMA2D, 0 for drawing glyphs row by row by the utility */
+#ifndef LCD_GLYPH_CACHE
+#define LCD_GLYPH_CACHE 1
+#endif
+/* Anti-aliased substitutes of the 1 bpp fonts, drawn by DMA2D */
+#ifndef LCD_ALPHA_FONTS
+#define LCD_ALPHA_FONTS 1
+#endif
+/* SDRAM of the glyph masks, above the frame buffer benchmark images */
+#define LCD_GLYPH_POOL (LCD_FRAME_BUFFER + 0x01000000)
+#define LCD_GLYPH_POOL_SIZE (0x20000)
+/* Title, captions and buttons copied from pre-rendered sprites, needs the
+ queued DMA2D drawing */
+#ifndef LCD_SPRITE_CACHE
+#define LCD_SPRITE_CACHE LCD_DMA2D_QUEUE
+#endif
+/* SDRAM of the sprites, above the glyph masks */
+#define LCD_SPRITE_POOL (LCD_FRAME_BUFFER + 0x01100000)
+#define LCD_SPRITE_POOL_SIZE (0x100000)
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
+void Error_Handler(void);
 
 #endif /* __MAIN_H */
@@ -72,7 +72,7 @@
 /* #define HAL_RAMECC_MODULE_ENABLED */    
 #define HAL_RCC_MODULE_ENABLED
 /* #define HAL_RNG_MODULE_ENABLED */   
-/* #define HAL_RTC_MODULE_ENABLED */
+#define HAL_RTC_MODULE_ENABLED
 /* #define HAL_SAI_MODULE_ENABLED */
 /* #define HAL_SD_MODULE_ENABLED  */ 
 #define HAL_SDRAM_MODULE_ENABLED
@@ -40,6 +40,11 @@ void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
 void DSI_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
+void HSEM1_IRQHandler(void);
+void TIM2_IRQHandler(void);
+void RTC_Alarm_IRQHandler(void);
+void DMA2D_IRQHandler(void);
 
 #ifdef __cplusplus
 }
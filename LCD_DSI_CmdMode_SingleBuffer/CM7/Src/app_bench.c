@@ -0,0 +1,205 @@
+/*
+ * app_bench.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_bench.h"
+#include "main.h"
+#include <string.h>
+
+#ifdef APP_FB_BENCH
+
+static App_fb_bench_t fb_bench_result;
+
+/**
+ * @brief Render the scene APP_FB_BENCH_FRAMES times as whole frames, then with
+ * the countdown running, where only changed widgets are drawn
+ *
+ * @param app
+ * @param look scene to render
+ * @param result times and pixels, the image is left alone
+ */
+static void fb_bench_scene(App_t *app, const Scene_t look,
+                           App_fb_scene_t *const result)
+{
+   APP_SceneLook(app, look);
+   app->timer_left = app->timer / 2;
+   UTIL_LCD_Clear(APP_COLOR_BACKGROUND);
+   app_fb_written();
+
+   uint64_t start = core_clock_us();
+   for (uint32_t frame = 0; frame < APP_FB_BENCH_FRAMES; frame++) {
+      APP_InvalidateScene();
+      APP_RenderScene(app);
+   }
+   uint64_t elapsed = core_clock_us() - start;
+   result->full_us = (uint32_t)(elapsed / APP_FB_BENCH_FRAMES);
+   result->full_pixels = app_fb_written() / APP_FB_BENCH_FRAMES;
+
+   start = core_clock_us();
+   for (uint32_t frame = 0; frame < APP_FB_BENCH_FRAMES; frame++) {
+      app->timer_left -= SECOND;
+      APP_RenderScene(app);
+   }
+   elapsed = core_clock_us() - start;
+   result->frame_us = (uint32_t)(elapsed / APP_FB_BENCH_FRAMES);
+   result->pixels = app_fb_written() / APP_FB_BENCH_FRAMES;
+}
+
+/**
+ * @brief Render every scene APP_FB_BENCH_FRAMES times into the software frame
+ * buffer, without LTDC, DSI and DMA2D. Whole frames are measured first, then
+ * frames with the countdown running, where only changed widgets are drawn.
+ * On M7 every scene is rendered also with I-cache and D-cache off, as before
+ * they were enabled. The buffer and the PPM images are placed in SDRAM after
+ * the LCD frame buffer, the images can be dumped by debugger. Results are in
+ * APP_FbBenchResults().
+ *
+ */
+void APP_FbBench(void)
+{
+   uint8_t *const base = (uint8_t *)LCD_FRAME_BUFFER;
+   static App_t app;
+   uint64_t total_us = 0;
+
+   app_fb_init((uint32_t *)(base + APP_FB_SIZE));
+   UTIL_LCD_SetFuncDriver(&app_fb_driver);
+
+   strcpy(app.title, "            ~ TOASTER CONTROLLER ~");
+   app.config_timer = 10 * 60 * SECOND;
+   app.timer = app.config_timer;
+
+   for (uint32_t i = 0; i < SCENE_COUNT; i++) {
+      App_fb_scene_t *const scene = &fb_bench_result.scene[i];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+      App_fb_scene_t uncached;
+
+      SCB_DisableDCache();
+      SCB_DisableICache();
+      fb_bench_scene(&app, (Scene_t)i, &uncached);
+      SCB_EnableICache();
+      SCB_EnableDCache();
+      scene->uncached_full_us = uncached.full_us;
+      scene->uncached_frame_us = uncached.frame_us;
+#endif
+
+      fb_bench_scene(&app, (Scene_t)i, scene);
+      total_us += (uint64_t)scene->frame_us * APP_FB_BENCH_FRAMES;
+      scene->ppm = base + 2U * APP_FB_SIZE + i * APP_FB_PPM_SIZE;
+      app_fb_ppm(scene->ppm, APP_FB_PPM_SIZE);
+   }
+
+   fb_bench_result.frames = APP_FB_BENCH_FRAMES;
+   if (total_us != 0)
+      fb_bench_result.fps =
+          (uint32_t)((uint64_t)SCENE_COUNT * APP_FB_BENCH_FRAMES * 1000000U /
+                     total_us);
+   fb_bench_result.done = 1;
+   APP_InvalidateScene();
+}
+
+/**
+ * @brief Get results of the benchmark
+ *
+ * @return const App_fb_bench_t*
+ */
+const App_fb_bench_t *APP_FbBenchResults(void) { return &fb_bench_result; }
+#endif
+
+#ifdef APP_GLYPH_BENCH
+
+static App_glyph_bench_t glyph_bench_result;
+
+/**
+ * @brief Draw APP_GLYPH_BENCH_SCREENS screens of text with every font used by
+ * the scenes, row by row by the LCD utility and from the glyph cache. Both
+ * ways draw into the LCD buffer, time includes waiting for DMA2D. Results are
+ * in APP_GlyphBenchResults().
+ *
+ */
+void APP_GlyphBench(void)
+{
+   static sFONT *const font[APP_GLYPH_BENCH_FONTS] = {
+       &Font16, &FontAvenirNext20, &FontMenlo32};
+   uint8_t text[APP_GLYPH_COUNT + 1];
+
+   for (uint32_t i = 0; i < APP_GLYPH_COUNT; i++)
+      text[i] = (uint8_t)(APP_GLYPH_FIRST + i);
+   text[APP_GLYPH_COUNT] = '\0';
+   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
+   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
+
+   for (uint32_t i = 0; i < APP_GLYPH_BENCH_FONTS; i++) {
+      App_glyph_font_t *const result = &glyph_bench_result.font[i];
+      const uint32_t lines = VACT / font[i]->Height;
+      uint32_t per_line = HACT / font[i]->Width;
+
+      if (per_line > APP_GLYPH_COUNT)
+         per_line = APP_GLYPH_COUNT;
+      result->glyphs = APP_GLYPH_BENCH_SCREENS * lines * per_line;
+      UTIL_LCD_SetFont(font[i]);
+
+      for (uint32_t cached = 0; cached < 2; cached++) {
+         LCD_SetGlyphs((uint8_t)cached);
+         /* Masks are expanded before the measurement */
+         LCD_DisplayStringAtLine(0, text);
+         app_dma2d_flush();
+
+         const uint64_t start = core_clock_us();
+         for (uint32_t screen = 0; screen < APP_GLYPH_BENCH_SCREENS; screen++)
+            for (uint32_t line = 0; line < lines; line++)
+               LCD_DisplayStringAtLine(line, text);
+         app_dma2d_flush();
+         const uint64_t elapsed = core_clock_us() - start;
+
+         const uint32_t per_s =
+             elapsed != 0
+                 ? (uint32_t)((uint64_t)result->glyphs * 1000000U / elapsed)
+                 : 0;
+         if (cached)
+            result->cached_per_s = per_s;
+         else
+            result->rows_per_s = per_s;
+      }
+   }
+
+   LCD_SetGlyphs(LCD_GLYPH_CACHE);
+   glyph_bench_result.done = 1;
+}
+
+/**
+ * @brief Get results of the benchmark
+ *
+ * @return const App_glyph_bench_t*
+ */
+const App_glyph_bench_t *APP_GlyphBenchResults(void)
+{
+   return &glyph_bench_result;
+}
+#endif
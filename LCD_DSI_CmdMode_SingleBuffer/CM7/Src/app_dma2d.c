@@ -0,0 +1,468 @@
+/*
+ * app_dma2d.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_dma2d.h"
+#include "core_cache.h"
+#include <stddef.h>
+
+#ifndef APP_DMA2D_SOFT
+#include "stm32h7xx_hal.h"
+#elif !defined(CORE_CM7)
+/* Host build, the software engine runs in the caller */
+#define __disable_irq()
+#define __enable_irq()
+#endif
+
+/* Staging allocations take whole D-cache lines */
+#define STAGE_ALIGN (32U)
+
+typedef enum {
+   DMA2D_OP_FILL,
+   DMA2D_OP_COPY,
+   DMA2D_OP_BLEND,       /* source over the destination */
+   DMA2D_OP_BLEND_COLOR, /* source over the back color */
+} dma2d_op_type_t;
+
+typedef struct {
+   dma2d_op_type_t type;
+   uint32_t *dst;
+   const void *src;
+   uint16_t width;
+   uint16_t height;
+   uint16_t dst_offset;
+   uint16_t src_offset;
+   uint32_t format; /* blend source */
+   uint32_t color;  /* fill, A8 blend source */
+   uint32_t back;   /* background of DMA2D_OP_BLEND_COLOR */
+   uint32_t stage;  /* staging bytes released with the operation */
+} dma2d_op_t;
+
+static dma2d_op_t queue[APP_DMA2D_QUEUE];
+static uint32_t queue_head; /* running operation, moved by the interrupt */
+static uint32_t queue_tail; /* next free slot */
+static volatile uint32_t queue_count;
+static volatile uint32_t running;
+
+/* Staging ring, allocated at stage_head, released in the queue order */
+#ifdef APP_DMA2D_SOFT
+static uint8_t stage_memory[APP_DMA2D_STAGE_SIZE];
+#define STAGE_BASE (stage_memory)
+#else
+/* DMA2D does not reach DTCM, AXI SRAM above the timer benchmark is free */
+#define STAGE_BASE ((uint8_t *)(D1_AXISRAM_BASE + 0x40000UL))
+#endif
+static uint32_t stage_head;
+static volatile uint32_t stage_used;
+static uint32_t stage_pending; /* reserved for the next queued operation */
+
+static app_dma2d_stats_t stats;
+
+/**
+ * @brief Bytes of the pixels of the blend source, A4 lines are whole bytes
+ */
+static uint32_t dma2d_bytes(const uint32_t format, const uint32_t pixels)
+{
+   if (format == APP_DMA2D_A4)
+      return pixels / 2U;
+   return format == APP_DMA2D_A8 ? pixels : 4U * pixels;
+}
+
+#ifndef APP_DMA2D_SOFT
+
+/**
+ * @brief Program the registers and start the operation
+ */
+static void engine_start(const dma2d_op_t *const op)
+{
+   uint32_t mode;
+
+   DMA2D->OPFCCR = DMA2D_OUTPUT_ARGB8888;
+   DMA2D->OMAR = (uint32_t)op->dst;
+   DMA2D->OOR = op->dst_offset;
+   DMA2D->NLR = (uint32_t)op->width << DMA2D_NLR_PL_Pos | op->height;
+
+   switch (op->type) {
+   case DMA2D_OP_FILL:
+      mode = DMA2D_R2M;
+      DMA2D->OCOLR = op->color;
+      break;
+   case DMA2D_OP_COPY:
+      mode = DMA2D_M2M;
+      DMA2D->FGMAR = (uint32_t)op->src;
+      DMA2D->FGOR = op->src_offset;
+      DMA2D->FGPFCCR = DMA2D_INPUT_ARGB8888;
+      break;
+   case DMA2D_OP_BLEND:
+   case DMA2D_OP_BLEND_COLOR:
+   default:
+      DMA2D->FGMAR = (uint32_t)op->src;
+      DMA2D->FGOR = op->src_offset;
+      if (op->format == APP_DMA2D_A8 || op->format == APP_DMA2D_A4) {
+         /* Alpha of the color multiplies alpha of the mask */
+         DMA2D->FGPFCCR = op->format | (op->color & 0xFF000000U) |
+                          DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos;
+         DMA2D->FGCOLR = op->color & 0xFFFFFFU;
+      } else {
+         DMA2D->FGPFCCR = op->format;
+      }
+      if (op->type == DMA2D_OP_BLEND_COLOR) {
+         mode = DMA2D_M2M_BLEND_BG;
+         DMA2D->BGCOLR = op->back & 0xFFFFFFU;
+         DMA2D->BGPFCCR = DMA2D_INPUT_ARGB8888 | (op->back & 0xFF000000U) |
+                          DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos;
+      } else {
+         mode = DMA2D_M2M_BLEND;
+         DMA2D->BGMAR = (uint32_t)op->dst;
+         DMA2D->BGOR = op->dst_offset;
+         DMA2D->BGPFCCR = DMA2D_INPUT_ARGB8888;
+      }
+      break;
+   }
+   DMA2D->CR = mode | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_START;
+}
+
+/**
+ * @brief Check and clear the end of the operation
+ * @return uint32_t 1 if the running operation ended
+ */
+static uint32_t engine_done(void)
+{
+   const uint32_t isr = DMA2D->ISR;
+
+   if (isr & DMA2D_ISR_TEIF) {
+      stats.errors++;
+   } else if (!(isr & DMA2D_ISR_TCIF)) {
+      return 0;
+   }
+   DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF;
+   return 1;
+}
+
+/**
+ * @brief Sleep until the interrupt of the running operation
+ */
+static void engine_wait(void)
+{
+   /* Pending interrupt wakes up WFI even when it is masked */
+   __disable_irq();
+   if (running)
+      __WFI();
+   __enable_irq();
+}
+
+#else
+
+static void engine_start(const dma2d_op_t *const op) { (void)op; }
+
+/**
+ * @brief Blend channel of the source over the destination
+ */
+static uint32_t soft_mix(const uint32_t fg, const uint32_t bg,
+                         const uint32_t alpha, const uint32_t shift)
+{
+   const uint32_t f = (fg >> shift) & 0xFFU;
+   const uint32_t b = (bg >> shift) & 0xFFU;
+
+   return ((f * alpha + b * (255U - alpha)) / 255U) << shift;
+}
+
+/**
+ * @brief Run the operation in software
+ */
+static uint32_t engine_done(void)
+{
+   const dma2d_op_t *const op = &queue[queue_head];
+   uint32_t *dst = op->dst;
+   const uint8_t *src = op->src;
+
+   for (uint32_t y = 0; y < op->height; y++) {
+      for (uint32_t x = 0; x < op->width; x++) {
+         uint32_t fg;
+         uint32_t alpha;
+         uint32_t bg;
+
+         switch (op->type) {
+         case DMA2D_OP_FILL:
+            dst[x] = op->color;
+            break;
+         case DMA2D_OP_COPY:
+            dst[x] = ((const uint32_t *)src)[x];
+            break;
+         case DMA2D_OP_BLEND:
+         case DMA2D_OP_BLEND_COLOR:
+         default:
+            if (op->format == APP_DMA2D_A8) {
+               alpha = src[x] * (op->color >> 24) / 255U;
+               fg = op->color;
+            } else if (op->format == APP_DMA2D_A4) {
+               /* Left pixel is in the low nibble */
+               alpha = ((src[x / 2U] >> (4U * (x & 1U))) & 0xFU) * 17U *
+                       (op->color >> 24) / 255U;
+               fg = op->color;
+            } else {
+               fg = ((const uint32_t *)src)[x];
+               alpha = fg >> 24;
+            }
+            bg = op->type == DMA2D_OP_BLEND_COLOR ? op->back : dst[x];
+            dst[x] = (alpha + (bg >> 24) - alpha * (bg >> 24) / 255U) << 24 |
+                     soft_mix(fg, bg, alpha, 16) | soft_mix(fg, bg, alpha, 8) |
+                     soft_mix(fg, bg, alpha, 0);
+            break;
+         }
+      }
+      dst += op->width + op->dst_offset;
+      if (op->type == DMA2D_OP_COPY)
+         src += 4U * (op->width + op->src_offset);
+      else if (op->type != DMA2D_OP_FILL)
+         src += dma2d_bytes(op->format, op->width + op->src_offset);
+   }
+   return 1;
+}
+
+/* Operations run when the caller waits */
+static void engine_wait(void) { app_dma2d_irq(); }
+
+#endif /* APP_DMA2D_SOFT */
+
+/**
+ * @brief Append the operation, start it if the engine is idle
+ */
+static void dma2d_push(const dma2d_op_t *const op)
+{
+   while (queue_count == APP_DMA2D_QUEUE) {
+      stats.waits++;
+      while (queue_count == APP_DMA2D_QUEUE)
+         engine_wait();
+   }
+
+   dma2d_op_t *const slot = &queue[queue_tail];
+   *slot = *op;
+   slot->stage = stage_pending;
+   stage_pending = 0;
+   queue_tail = (queue_tail + 1U) & (APP_DMA2D_QUEUE - 1U);
+
+   __disable_irq();
+   queue_count++;
+   if (!running) {
+      running = 1;
+      engine_start(slot);
+   }
+   __enable_irq();
+}
+
+/**
+ * @brief Source in the staging memory is written by CPU, DMA2D reads memory
+ */
+static void dma2d_clean_source(const void *const src, const uint32_t size)
+{
+   const uint8_t *const p = src;
+
+   if (p >= STAGE_BASE && p < STAGE_BASE + APP_DMA2D_STAGE_SIZE)
+      cache_clean(src, size);
+}
+
+/**
+ * @brief Reset the queue, DMA2D clock and interrupt are enabled by the caller
+ */
+void app_dma2d_init(void)
+{
+   queue_head = 0;
+   queue_tail = 0;
+   queue_count = 0;
+   running = 0;
+   stage_head = 0;
+   stage_used = 0;
+   stage_pending = 0;
+#ifndef APP_DMA2D_SOFT
+   DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF;
+#endif
+}
+
+/**
+ * @brief Queue filling of the rectangle by the color
+ */
+void app_dma2d_fill(uint32_t *const dst, const uint32_t dst_offset,
+                    const uint32_t width, const uint32_t height,
+                    const uint32_t color)
+{
+   const dma2d_op_t op = {.type = DMA2D_OP_FILL,
+                          .dst = dst,
+                          .width = (uint16_t)width,
+                          .height = (uint16_t)height,
+                          .dst_offset = (uint16_t)dst_offset,
+                          .color = color};
+
+   if (width != 0 && height != 0)
+      dma2d_push(&op);
+}
+
+/**
+ * @brief Queue copy of the rectangle, ARGB8888
+ */
+void app_dma2d_copy(uint32_t *const dst, const uint32_t dst_offset,
+                    const uint32_t *const src, const uint32_t src_offset,
+                    const uint32_t width, const uint32_t height)
+{
+   const dma2d_op_t op = {.type = DMA2D_OP_COPY,
+                          .dst = dst,
+                          .src = src,
+                          .width = (uint16_t)width,
+                          .height = (uint16_t)height,
+                          .dst_offset = (uint16_t)dst_offset,
+                          .src_offset = (uint16_t)src_offset};
+
+   if (width == 0 || height == 0)
+      return;
+   dma2d_clean_source(src, 4U * (width + src_offset) * height);
+   dma2d_push(&op);
+}
+
+/**
+ * @brief Queue blending of the source over the rectangle
+ */
+void app_dma2d_blend(uint32_t *const dst, const uint32_t dst_offset,
+                     const void *const src, const uint32_t src_offset,
+                     const uint32_t width, const uint32_t height,
+                     const uint32_t format, const uint32_t color)
+{
+   const dma2d_op_t op = {.type = DMA2D_OP_BLEND,
+                          .dst = dst,
+                          .src = src,
+                          .width = (uint16_t)width,
+                          .height = (uint16_t)height,
+                          .dst_offset = (uint16_t)dst_offset,
+                          .src_offset = (uint16_t)src_offset,
+                          .format = format,
+                          .color = color};
+
+   if (width == 0 || height == 0)
+      return;
+   dma2d_clean_source(src,
+                      dma2d_bytes(format, (width + src_offset) * height));
+   dma2d_push(&op);
+}
+
+/**
+ * @brief Queue blending of the source over the back color into the rectangle,
+ *        the destination is not read
+ */
+void app_dma2d_blend_color(uint32_t *const dst, const uint32_t dst_offset,
+                           const void *const src, const uint32_t src_offset,
+                           const uint32_t width, const uint32_t height,
+                           const uint32_t format, const uint32_t color,
+                           const uint32_t back)
+{
+   const dma2d_op_t op = {.type = DMA2D_OP_BLEND_COLOR,
+                          .dst = dst,
+                          .src = src,
+                          .width = (uint16_t)width,
+                          .height = (uint16_t)height,
+                          .dst_offset = (uint16_t)dst_offset,
+                          .src_offset = (uint16_t)src_offset,
+                          .format = format,
+                          .color = color,
+                          .back = back};
+
+   if (width == 0 || height == 0)
+      return;
+   dma2d_clean_source(src,
+                      dma2d_bytes(format, (width + src_offset) * height));
+   dma2d_push(&op);
+}
+
+/**
+ * @brief Get staging memory for source pixels of the next queued operation
+ * @param size in bytes
+ * @return void* NULL if size is over APP_DMA2D_STAGE_SIZE
+ */
+void *app_dma2d_stage(uint32_t size)
+{
+   /* Whole cache lines, so cleaning does not touch other allocations */
+   size = (size + STAGE_ALIGN - 1U) & ~(STAGE_ALIGN - 1U);
+   if (size > APP_DMA2D_STAGE_SIZE)
+      return NULL;
+
+   /* Allocation does not wrap, the rest of the ring is skipped */
+   const uint32_t skip =
+       stage_head + size > APP_DMA2D_STAGE_SIZE ? APP_DMA2D_STAGE_SIZE -
+                                                      stage_head
+                                                : 0;
+   if (APP_DMA2D_STAGE_SIZE - stage_used < skip + size) {
+      stats.waits++;
+      while (APP_DMA2D_STAGE_SIZE - stage_used < skip + size)
+         engine_wait();
+   }
+
+   __disable_irq();
+   stage_used += skip + size;
+   __enable_irq();
+   stage_pending += skip + size;
+   stage_head = (stage_head + skip + size) % APP_DMA2D_STAGE_SIZE;
+   return STAGE_BASE + (stage_head + APP_DMA2D_STAGE_SIZE - size) %
+                           APP_DMA2D_STAGE_SIZE;
+}
+
+/**
+ * @brief Wait until all queued operations are done
+ */
+void app_dma2d_flush(void)
+{
+   while (queue_count != 0)
+      engine_wait();
+}
+
+/**
+ * @brief Get count of queued operations
+ * @return uint32_t
+ */
+uint32_t app_dma2d_pending(void) { return queue_count; }
+
+/**
+ * @brief DMA2D interrupt, starts the next operation
+ */
+void app_dma2d_irq(void)
+{
+   if (!running || !engine_done())
+      return;
+
+   stats.ops++;
+   stage_used -= queue[queue_head].stage;
+   queue_head = (queue_head + 1U) & (APP_DMA2D_QUEUE - 1U);
+   if (--queue_count != 0)
+      engine_start(&queue[queue_head]);
+   else
+      running = 0;
+}
+
+/**
+ * @brief Get statistics of the queue
+ * @return const app_dma2d_stats_t*
+ */
+const app_dma2d_stats_t *app_dma2d_stats(void) { return &stats; }
@@ -0,0 +1,134 @@
+/*
+ * app_event.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_event.h"
+#include "core_clock.h"
+#include "stm32h7xx_hal.h"
+#include <stdatomic.h>
+
+static atomic_uint pending;
+static volatile uint8_t deadline_armed;
+static volatile uint32_t deadline_tick;
+
+/**
+ * @brief Post events, safe to call from interrupt
+ * @param events mask of APP_EVENT_* flags
+ */
+void app_event_post(const uint32_t events)
+{
+   atomic_fetch_or(&pending, events);
+}
+
+/**
+ * @brief Arm one shot deadline, APP_EVENT_TIMER is posted once the core clock
+ *        reaches it. The previous deadline is replaced. The core is woken up
+ *        by TIM2 compare, there is no periodic tick.
+ * @param deadline core clock in ms
+ */
+void app_event_deadline(const uint32_t deadline)
+{
+   /* The alarm handler must not see the new flag with the old tick */
+   deadline_armed = 0;
+   deadline_tick = deadline;
+   deadline_armed = 1;
+
+   const uint64_t now = core_clock_ms();
+   const int32_t left = (int32_t)(deadline - (uint32_t)now);
+   core_clock_alarm((uint64_t)((int64_t)now + left) * 1000U);
+}
+
+/**
+ * @brief Disarm the deadline
+ */
+void app_event_deadline_cancel(void)
+{
+   deadline_armed = 0;
+   core_clock_alarm_cancel();
+}
+
+/**
+ * @brief Get the armed deadline
+ * @param deadline core clock in ms
+ * @return 0 if a deadline is armed, -1 otherwise
+ */
+int app_event_deadline_get(uint32_t *const deadline)
+{
+   if (!deadline_armed) {
+      return -1;
+   }
+   *deadline = deadline_tick;
+   return 0;
+}
+
+/**
+ * @brief Check the deadline, called by TIM2 compare interrupt or by simulator
+ * @param now core clock in ms
+ */
+void app_event_tick(const uint32_t now)
+{
+   if (deadline_armed && (int32_t)(now - deadline_tick) >= 0) {
+      deadline_armed = 0;
+      app_event_post(APP_EVENT_TIMER);
+   }
+}
+
+/**
+ * @brief Sleep until any event is posted
+ * @return mask of posted events, they are cleared
+ */
+uint32_t app_event_wait(void)
+{
+   uint32_t events;
+
+   while ((events = atomic_exchange(&pending, 0)) == 0) {
+      app_event_idle();
+   }
+   return events;
+}
+
+/**
+ * @brief Sleep until an interrupt, called by app_event_wait while no event is
+ *        posted. SysTick is suspended while sleeping. Weak, the simulator
+ *        overrides it to feed recorded events.
+ */
+__attribute__((weak)) void app_event_idle(void)
+{
+   /* With interrupts masked an event posted after the check still wakes up
+    the core from WFI, its handler runs right after they are enabled again */
+   __disable_irq();
+   if (atomic_load(&pending) == 0) {
+      /* The deadline is TIM2 compare, the 1 ms tick would only wake the core.
+       HAL_GetTick() stops meanwhile, it is used for timeouts of busy waits. */
+      HAL_SuspendTick();
+      __WFI();
+      HAL_ResumeTick();
+   }
+   __enable_irq();
+}
@@ -0,0 +1,225 @@
+/*
+ * app_fb.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_fb.h"
+#include "stm32h747i_discovery_errno.h"
+#include <string.h>
+
+static uint32_t *fb;
+static uint32_t written;
+
+/**
+ * @brief Clip the rectangle to the buffer
+ * @return uint32_t 0 if nothing is left to draw
+ */
+static uint32_t fb_clip(const uint32_t x, const uint32_t y,
+                        uint32_t *const width, uint32_t *const height)
+{
+   if (fb == NULL || x >= APP_FB_WIDTH || y >= APP_FB_HEIGHT)
+      return 0;
+   if (*width > APP_FB_WIDTH - x)
+      *width = APP_FB_WIDTH - x;
+   if (*height > APP_FB_HEIGHT - y)
+      *height = APP_FB_HEIGHT - y;
+   return *width != 0 && *height != 0;
+}
+
+/* Functions of LCD_UTILS_Drv_t, drawing is clipped to the buffer */
+
+static int32_t fb_fill_rect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint32_t Width, uint32_t Height, uint32_t Color)
+{
+   (void)Instance;
+   if (!fb_clip(Xpos, Ypos, &Width, &Height))
+      return BSP_ERROR_NONE;
+
+   for (uint32_t y = 0; y < Height; y++) {
+      uint32_t *line = &fb[(Ypos + y) * APP_FB_WIDTH + Xpos];
+      for (uint32_t x = 0; x < Width; x++)
+         line[x] = Color;
+   }
+   written += Width * Height;
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_fill_rgb_rect(uint32_t Instance, uint32_t Xpos,
+                                uint32_t Ypos, uint8_t *pData, uint32_t Width,
+                                uint32_t Height)
+{
+   const uint32_t stride = Width;
+
+   (void)Instance;
+   if (!fb_clip(Xpos, Ypos, &Width, &Height))
+      return BSP_ERROR_NONE;
+
+   /* Pixels are ARGB8888 little endian as in BSP_LCD_FillRGBRect */
+   for (uint32_t y = 0; y < Height; y++) {
+      uint32_t *line = &fb[(Ypos + y) * APP_FB_WIDTH + Xpos];
+      const uint8_t *src = &pData[y * stride * 4U];
+      for (uint32_t x = 0; x < Width; x++, src += 4)
+         line[x] = (uint32_t)src[0] | (uint32_t)src[1] << 8 |
+                   (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24;
+   }
+   written += Width * Height;
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_draw_hline(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color)
+{
+   return fb_fill_rect(Instance, Xpos, Ypos, Length, 1, Color);
+}
+
+static int32_t fb_draw_vline(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color)
+{
+   return fb_fill_rect(Instance, Xpos, Ypos, 1, Length, Color);
+}
+
+static int32_t fb_draw_bitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                              uint8_t *pBmp)
+{
+   /* Bitmaps are not used by the scenes */
+   (void)Instance;
+   (void)Xpos;
+   (void)Ypos;
+   (void)pBmp;
+   return BSP_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+static int32_t fb_get_pixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint32_t *Color)
+{
+   (void)Instance;
+   if (fb == NULL || Xpos >= APP_FB_WIDTH || Ypos >= APP_FB_HEIGHT)
+      return BSP_ERROR_WRONG_PARAM;
+   *Color = fb[Ypos * APP_FB_WIDTH + Xpos];
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_set_pixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint32_t Color)
+{
+   return fb_fill_rect(Instance, Xpos, Ypos, 1, 1, Color);
+}
+
+static int32_t fb_get_x_size(uint32_t Instance, uint32_t *XSize)
+{
+   (void)Instance;
+   *XSize = APP_FB_WIDTH;
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_get_y_size(uint32_t Instance, uint32_t *YSize)
+{
+   (void)Instance;
+   *YSize = APP_FB_HEIGHT;
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_set_layer(uint32_t Instance, uint32_t LayerIndex)
+{
+   (void)Instance;
+   (void)LayerIndex;
+   return BSP_ERROR_NONE;
+}
+
+static int32_t fb_get_format(uint32_t Instance, uint32_t *PixelFormat)
+{
+   (void)Instance;
+   *PixelFormat = LCD_PIXEL_FORMAT_ARGB8888;
+   return BSP_ERROR_NONE;
+}
+
+const LCD_UTILS_Drv_t app_fb_driver = {
+    fb_draw_bitmap, fb_fill_rgb_rect, fb_draw_hline, fb_draw_vline,
+    fb_fill_rect,   fb_get_pixel,     fb_set_pixel,  fb_get_x_size,
+    fb_get_y_size,  fb_set_layer,     fb_get_format};
+
+/**
+ * @brief Use the buffer for drawing
+ * @param pixels
+ */
+void app_fb_init(uint32_t *const pixels)
+{
+   fb = pixels;
+   written = 0;
+}
+
+/**
+ * @brief Get the buffer
+ * @return uint32_t*
+ */
+uint32_t *app_fb_pixels(void)
+{
+   return fb;
+}
+
+/**
+ * @brief Get count of pixels written since the last call
+ * @return uint32_t
+ */
+uint32_t app_fb_written(void)
+{
+   const uint32_t count = written;
+
+   written = 0;
+   return count;
+}
+
+/**
+ * @brief Store the buffer as binary PPM image
+ * @param out
+ * @param size
+ * @return size_t bytes written, 0 if out is too small
+ */
+size_t app_fb_ppm(uint8_t *const out, const size_t size)
+{
+   static const char header[] = "P6\n800 480\n255\n";
+   uint8_t *p = out;
+
+   _Static_assert(APP_FB_WIDTH == 800U && APP_FB_HEIGHT == 480U,
+                  "PPM header does not match the buffer");
+   _Static_assert(sizeof(header) - 1U + APP_FB_WIDTH * APP_FB_HEIGHT * 3U ==
+                      APP_FB_PPM_SIZE,
+                  "APP_FB_PPM_SIZE does not match the header");
+
+   if (fb == NULL || size < APP_FB_PPM_SIZE)
+      return 0;
+
+   memcpy(p, header, sizeof(header) - 1U);
+   p += sizeof(header) - 1U;
+   for (uint32_t i = 0; i < APP_FB_WIDTH * APP_FB_HEIGHT; i++) {
+      *p++ = (uint8_t)(fb[i] >> 16);
+      *p++ = (uint8_t)(fb[i] >> 8);
+      *p++ = (uint8_t)fb[i];
+   }
+   return APP_FB_PPM_SIZE;
+}
@@ -0,0 +1,87 @@
+/*
+ * app_font.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_font.h"
+#include "app_dma2d.h"
+
+/**
+ * @brief Get the glyph of the character, missing ones are drawn as the first
+ */
+const app_font_glyph_t *app_font_glyph(const app_font_t *const font,
+                                       const uint8_t ascii)
+{
+   const uint32_t index = (uint32_t)(ascii - font->first);
+
+   return &font->glyph[index < font->count ? index : 0];
+}
+
+/**
+ * @brief Get width of the text, only whole glyphs up to max_width are counted
+ */
+uint32_t app_font_width(const app_font_t *const font, const uint8_t *text,
+                        const uint32_t max_width)
+{
+   uint32_t width = 0;
+
+   for (; *text != 0; text++) {
+      const uint32_t advance = app_font_glyph(font, *text)->advance;
+      if (width + advance > max_width)
+         break;
+      width += advance;
+   }
+   return width;
+}
+
+/**
+ * @brief Queue drawing of the text line by DMA2D
+ */
+uint32_t app_font_draw(uint32_t *const dst, const uint32_t pitch,
+                       const uint32_t max_width, const app_font_t *const font,
+                       const uint8_t *text, const uint32_t color,
+                       const uint32_t back)
+{
+   const uint32_t width = app_font_width(font, text, max_width);
+   uint32_t pen = 0;
+
+   /* Line in the back color, glyph boxes are drawn over it */
+   app_dma2d_fill(dst, pitch - width, width, font->base.Height, back);
+
+   for (; pen < width; text++) {
+      const app_font_glyph_t *const glyph = app_font_glyph(font, *text);
+
+      /* Box is blended over the back color, the fill is not read */
+      app_dma2d_blend_color(dst + glyph->top * pitch + pen + glyph->left,
+                            pitch - glyph->width,
+                            &font->base.table[glyph->offset], 0, glyph->width,
+                            glyph->height, APP_DMA2D_A4, color, back);
+      pen += glyph->advance;
+   }
+   return width;
+}
@@ -0,0 +1,123 @@
+/*
+ * app_format.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_format.h"
+
+/**
+ * @brief Copy the string without its terminating zero
+ * @param out
+ * @param str
+ * @return char* end of the text
+ */
+char *app_format_str(char *out, const char *str)
+{
+   while (*str != '\0')
+      *out++ = *str++;
+   return out;
+}
+
+/**
+ * @brief Write time as HH:MM:SS
+ * @param out
+ * @param seconds
+ * @return char* end of the text
+ */
+char *app_format_hms(char *out, const uint32_t seconds)
+{
+   out = app_format_uint(out, seconds / 3600U, 2, '0');
+   *out++ = ':';
+   out = app_format_uint(out, seconds / 60U % 60U, 2, '0');
+   *out++ = ':';
+   return app_format_uint(out, seconds % 60U, 2, '0');
+}
+
+#ifdef APP_FORMAT_BENCH
+
+#include "stm32h7xx_hal.h"
+#include <stdio.h>
+#include <string.h>
+
+static app_format_bench_t bench;
+
+/**
+ * @brief Compare the formatter with sprintf on the texts of the scenes
+ */
+void app_format_bench_run(void)
+{
+   char libc[48];
+   char text[48];
+   uint32_t start;
+   uint64_t sum[4] = {0};
+
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+   bench.done = 0;
+   bench.mismatches = 0;
+   for (uint32_t i = 0; i < APP_FORMAT_BENCH_COUNT; i++) {
+      const uint32_t minutes = i % 600U;
+      const uint32_t seconds = i * 37U % 86400U;
+
+      start = DWT->CYCCNT;
+      sprintf(libc, "  Start in %ld min", (long)minutes);
+      sum[0] += DWT->CYCCNT - start;
+
+      start = DWT->CYCCNT;
+      char *end = app_format_str(text, "  Start in ");
+      end = app_format_uint(end, minutes, 1, ' ');
+      end = app_format_str(end, " min");
+      *end = '\0';
+      sum[1] += DWT->CYCCNT - start;
+      bench.mismatches += strcmp(libc, text) != 0;
+
+      start = DWT->CYCCNT;
+      sprintf(libc, "%02ld:%02ld:%02ld", (long)(seconds / 3600U),
+              (long)(seconds / 60U % 60U), (long)(seconds % 60U));
+      sum[2] += DWT->CYCCNT - start;
+
+      start = DWT->CYCCNT;
+      *app_format_hms(text, seconds) = '\0';
+      sum[3] += DWT->CYCCNT - start;
+      bench.mismatches += strcmp(libc, text) != 0;
+   }
+   bench.status_libc = (uint32_t)(sum[0] / APP_FORMAT_BENCH_COUNT);
+   bench.status = (uint32_t)(sum[1] / APP_FORMAT_BENCH_COUNT);
+   bench.hms_libc = (uint32_t)(sum[2] / APP_FORMAT_BENCH_COUNT);
+   bench.hms = (uint32_t)(sum[3] / APP_FORMAT_BENCH_COUNT);
+   bench.done = 1;
+}
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_format_bench_t*
+ */
+const app_format_bench_t *app_format_bench_results(void) { return &bench; }
+
+#endif /* APP_FORMAT_BENCH */
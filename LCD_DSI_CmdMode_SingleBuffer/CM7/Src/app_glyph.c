@@ -0,0 +1,128 @@
+/*
+ * app_glyph.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_glyph.h"
+#include "core_cache.h"
+#include <stddef.h>
+#include <string.h>
+
+typedef struct {
+   const sFONT *font;
+   uint8_t *mask[APP_GLYPH_COUNT];
+} glyph_font_t;
+
+static glyph_font_t fonts[APP_GLYPH_FONTS];
+static uint8_t *pool_base;
+static uint32_t pool_size;
+static app_glyph_stats_t stats;
+
+/**
+ * @brief Find the font in the cache, take a free slot for a new one
+ */
+static glyph_font_t *glyph_font(const sFONT *const font)
+{
+   for (uint32_t i = 0; i < APP_GLYPH_FONTS; i++) {
+      if (fonts[i].font == font)
+         return &fonts[i];
+      if (fonts[i].font == NULL) {
+         fonts[i].font = font;
+         return &fonts[i];
+      }
+   }
+   return NULL;
+}
+
+/**
+ * @brief Expand 1 bit rows of the font table into A8 mask
+ */
+static void glyph_expand(const sFONT *const font, const uint8_t ascii,
+                         uint8_t *mask)
+{
+   const uint32_t pitch = (font->Width + 7U) / 8U;
+   const uint8_t *row = &font->table[(ascii - APP_GLYPH_FIRST) * font->Height *
+                                     pitch];
+
+   for (uint32_t y = 0; y < font->Height; y++) {
+      /* Leftmost pixel is the MSB of the first byte */
+      for (uint32_t x = 0; x < font->Width; x++)
+         *mask++ = (row[x / 8U] & (0x80U >> (x % 8U))) ? 0xFFU : 0x00U;
+      row += pitch;
+   }
+}
+
+/**
+ * @brief Drop all masks and set the pool
+ */
+void app_glyph_init(void *const pool, const uint32_t size)
+{
+   memset(fonts, 0, sizeof(fonts));
+   pool_base = pool;
+   pool_size = size;
+   stats.used = 0;
+}
+
+/**
+ * @brief Get A8 mask of the character, expand it on the first use
+ */
+const uint8_t *app_glyph_get(const sFONT *const font, const uint8_t ascii)
+{
+   if (ascii < APP_GLYPH_FIRST || ascii >= APP_GLYPH_FIRST + APP_GLYPH_COUNT)
+      return NULL;
+
+   glyph_font_t *const cached = glyph_font(font);
+   if (cached == NULL) {
+      stats.full++;
+      return NULL;
+   }
+
+   uint8_t **const mask = &cached->mask[ascii - APP_GLYPH_FIRST];
+   if (*mask != NULL) {
+      stats.hits++;
+      return *mask;
+   }
+
+   const uint32_t size = (uint32_t)font->Width * font->Height;
+   if (pool_size - stats.used < size) {
+      stats.full++;
+      return NULL;
+   }
+   *mask = pool_base + stats.used;
+   stats.used += size;
+   glyph_expand(font, ascii, *mask);
+   /* DMA2D reads the mask from the memory */
+   cache_clean(*mask, size);
+   stats.misses++;
+   return *mask;
+}
+
+/**
+ * @brief Get statistics of the cache
+ */
+const app_glyph_stats_t *app_glyph_stats(void) { return &stats; }
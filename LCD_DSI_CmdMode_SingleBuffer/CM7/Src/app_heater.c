@@ -0,0 +1,125 @@
+/*
+ * app_heater.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_heater.h"
+#include "main.h"
+
+#define HEATER_RPC_TIMEOUT 100 /* ms to confirm heater request by M4 */
+#define HEATER_RETRY 5         /* ms to send heater request again if not sent */
+
+/**
+ * @brief On TURNON_SCENE turn on LED4 and send heater request trough shared
+ * memory to M4 CPU. The request is sent only when the state changes, M4 is
+ * woken up by HSEM notification. If M4 does not confirm the request in
+ * HEATER_RPC_TIMEOUT, it is sent again, up to APP_HEATER_TRIES times. Then
+ * the state is given up and app->heater_lost is set, it is cleared by the
+ * next confirmed request. If the request cannot be sent at all (no free call
+ * slot or the queue to M4 is full), it is tried again after HEATER_RETRY. The
+ * state reported back by M4 is read into app->heater, it is shown by the
+ * heater widget.
+ *
+ * @param app
+ * @return uint32_t ms until it has to run again, 0 if nothing waits
+ */
+uint32_t APP_TurnPeripheries(App_t *app)
+{
+   static int sent_state = -1;
+   static int call = -1;
+   static int given_up = -1; /* state M4 did not confirm */
+   static int retried = -1;  /* state of the counted failures */
+   static uint32_t failures;
+   const int state = (app->scene == TURNON_SCENE) ? 1 : 0;
+
+   if (state)
+      BSP_LED_On(LED4);
+   else
+      BSP_LED_Off(LED4);
+
+   /* Check confirmation of the request in flight */
+   core_rpc_process();
+   if (call >= 0) {
+      int32_t status;
+      const int ret = core_rpc_poll(call, &status);
+      if (ret != CORE_RPC_PENDING) {
+         call = -1;
+         if (ret == CORE_RPC_DONE && status == 0) {
+            app->heater_confirmed = (state == sent_state);
+            app->heater_lost = 0;
+            given_up = -1;
+            failures = 0;
+         } else if (++failures >= APP_HEATER_TRIES) {
+            given_up = sent_state;
+            sent_state = -1;
+            failures = 0;
+            app->heater_lost = 1;
+         } else {
+            sent_state = -1; /* Not confirmed, send it again */
+         }
+      }
+   }
+
+   if (call < 0 && state != sent_state && state != given_up) {
+      core_msg_t msg = {.header.type = CORE_MSG_HEATER,
+                        .payload.heater.on = state};
+      call = core_rpc_call_m4(&msg, HEATER_RPC_TIMEOUT);
+      if (call >= 0) {
+         if (state != retried) {
+            retried = state;
+            failures = 0;
+         }
+         sent_state = state;
+         app->heater_confirmed = 0;
+         core_notify_m4();
+      }
+   }
+
+   /* Latest state of the heater side, the previous one is kept if M4 was
+    updating it all the time */
+   if (core_snapshot_read(&app->heater) != 0)
+      app->heater_read_errors++;
+
+   if (call >= 0)
+      return HEATER_RPC_TIMEOUT;
+   return (state != sent_state && state != given_up) ? HEATER_RETRY : 0;
+}
+
+/**
+ * @brief  HSEM released callback, M4 posted a message. The notification is
+ *         disabled by the IRQ handler, so it is activated again.
+ * @param  SemMask mask of released semaphores
+ * @retval None
+ */
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+   if (SemMask & __HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7)) {
+      HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+      app_event_post(APP_EVENT_CORE);
+   }
+}
@@ -0,0 +1,536 @@
+/*
+ * app_lcd.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_lcd.h"
+#include "main.h"
+#include <string.h>
+
+/* Anti-aliased font with the same cell, drawn instead of the 1 bpp font */
+typedef struct {
+   const sFONT *font;
+   app_font_t *alpha;
+} Font_substitute_t;
+
+/* Frame buffers and drawn areas, regions of a refresh are refreshed one by
+ one */
+static app_present_t lcd_present;
+static uint32_t lcd_refresh_next;
+static uint8_t lcd_glyphs = 0; /* text is drawn by DMA2D */
+static app_font_t *lcd_font_alpha = NULL; /* substitute of the current font */
+static uint8_t lcd_sprites = 0; /* widgets are copied from the sprite cache */
+/* Sprite drawn instead of the frame buffer, the area it is copied to */
+static uint32_t *lcd_sprite = NULL;
+static app_rect_t lcd_sprite_rect;
+
+static void LCD_Dirty(uint32_t Xpos, uint32_t Ypos, uint32_t Width,
+                      uint32_t Height);
+static int32_t LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                              uint8_t *pBmp);
+static int32_t LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos,
+                               uint32_t Ypos, uint8_t *pData, uint32_t Width,
+                               uint32_t Height);
+static int32_t LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color);
+static int32_t LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color);
+static int32_t LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint32_t Width, uint32_t Height, uint32_t Color);
+static int32_t LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t *Color);
+static int32_t LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                              uint32_t Color);
+static void LCD_StartRefresh(void);
+
+#if LCD_ALPHA_FONTS
+static const Font_substitute_t font_substitutes[] = {
+    {&FontAvenirNext20, &FontLato20},
+};
+#endif
+
+/* BSP drawing, written areas are collected for the partial refresh */
+const LCD_UTILS_Drv_t LCD_UTIL_Driver = {
+    LCD_DrawBitmap,         LCD_FillRGBRect,       LCD_DrawHLine,
+    LCD_DrawVLine,          LCD_FillRect,          LCD_ReadPixel,
+    LCD_WritePixel,         LCD_GetXSize,          LCD_GetYSize,
+    BSP_LCD_SetActiveLayer, BSP_LCD_GetPixelFormat};
+
+/**
+ * @brief  Set up the frame buffers, the DMA2D queue and the caches of glyphs
+ * and sprites.
+ * @retval None
+ */
+void LCD_DrawInit(void)
+{
+   app_present_init(&lcd_present, LCD_BUFFERS);
+   app_dma2d_init();
+   app_glyph_init((void *)LCD_GLYPH_POOL, LCD_GLYPH_POOL_SIZE);
+   lcd_glyphs = LCD_GLYPH_CACHE;
+   app_sprite_init((void *)LCD_SPRITE_POOL, LCD_SPRITE_POOL_SIZE);
+   lcd_sprites = LCD_SPRITE_CACHE;
+}
+
+/**
+ * @brief  Draw text from the glyph cache by DMA2D or row by row by the LCD
+ * utility, used to compare both.
+ * @param  enable 1 for the glyph cache
+ * @retval None
+ */
+void LCD_SetGlyphs(uint8_t enable) { lcd_glyphs = enable; }
+
+/**
+ * @brief  Gets the LCD X size.
+ * @param  Instance  LCD Instance
+ * @param  XSize     LCD width
+ * @retval BSP status
+ */
+int32_t LCD_GetXSize(uint32_t Instance, uint32_t *XSize)
+{
+   *XSize = Lcd_Ctx[0].XSize;
+
+   return BSP_ERROR_NONE;
+}
+
+/**
+ * @brief  Gets the LCD Y size.
+ * @param  Instance  LCD Instance
+ * @param  YSize     LCD Height
+ * @retval BSP status
+ */
+int32_t LCD_GetYSize(uint32_t Instance, uint32_t *YSize)
+{
+   *YSize = Lcd_Ctx[0].YSize;
+
+   return BSP_ERROR_NONE;
+}
+
+/**
+ * @brief  Mark the area as drawn, it is clipped to the display. Drawing into
+ * a sprite is marked when the sprite is copied.
+ * @param  Xpos   X position
+ * @param  Ypos   Y position
+ * @param  Width  Rectangle width
+ * @param  Height Rectangle height
+ * @retval None
+ */
+static void LCD_Dirty(uint32_t Xpos, uint32_t Ypos, uint32_t Width,
+                      uint32_t Height)
+{
+   if (lcd_sprite != NULL || Xpos >= HACT || Ypos >= VACT)
+      return;
+   if (Width > HACT - Xpos)
+      Width = HACT - Xpos;
+   if (Height > VACT - Ypos)
+      Height = VACT - Ypos;
+   app_rect_add(&lcd_present.dirty, Xpos, Ypos, Width, Height);
+}
+
+/**
+ * @brief  Get address of the pixel in the drawn buffer, or in the drawn
+ * sprite placed at its display area.
+ * @param  Xpos   X position
+ * @param  Ypos   Y position
+ * @retval Pixel address
+ */
+uint32_t *LCD_DrawAddress(uint32_t Xpos, uint32_t Ypos)
+{
+   if (lcd_sprite != NULL)
+      return lcd_sprite + (Ypos - lcd_sprite_rect.y0) * LCD_DrawPitch() +
+             (Xpos - lcd_sprite_rect.x0);
+   return (uint32_t *)(uintptr_t)hlcd_ltdc.LayerCfg[Lcd_Ctx[0].ActiveLayer]
+              .FBStartAdress +
+          Ypos * HACT + Xpos;
+}
+
+/**
+ * @brief  Get pixels per line of the drawn buffer or sprite.
+ * @retval Pitch
+ */
+uint32_t LCD_DrawPitch(void)
+{
+   return lcd_sprite != NULL ? lcd_sprite_rect.x1 - lcd_sprite_rect.x0 : HACT;
+}
+
+/**
+ * @brief  Begin drawing of the area from the sprite cache. On a hit the
+ * sprite is copied by one DMA2D operation. On a miss the drawing is
+ * redirected into the new sprite until LCD_EndSprite, which copies it. Only
+ * the queued DMA2D drawing is redirected, so the cache is not used without
+ * it.
+ * @param  key    Hash of the drawn content, placement is not part of it
+ * @param  Xpos   X position
+ * @param  Ypos   Y position
+ * @param  Width  Rectangle width
+ * @param  Height Rectangle height
+ * @retval 1 if the area has to be drawn
+ */
+uint32_t LCD_BeginSprite(uint64_t key, uint32_t Xpos, uint32_t Ypos,
+                                uint32_t Width, uint32_t Height)
+{
+   uint32_t created = 0;
+   uint32_t *const pixels =
+       lcd_sprites ? app_sprite_get(key, Width, Height, &created) : NULL;
+
+   lcd_sprite_rect.x0 = Xpos;
+   lcd_sprite_rect.y0 = Ypos;
+   lcd_sprite_rect.x1 = Xpos + Width;
+   lcd_sprite_rect.y1 = Ypos + Height;
+   if (pixels == NULL)
+      return 1;
+   if (created) {
+      lcd_sprite = pixels;
+      return 1;
+   }
+   LCD_Dirty(Xpos, Ypos, Width, Height);
+   app_dma2d_copy(LCD_DrawAddress(Xpos, Ypos), HACT - Width, pixels, 0, Width,
+                  Height);
+   return 0;
+}
+
+/**
+ * @brief  End drawing of the area begun by LCD_BeginSprite, a new sprite is
+ * copied to the frame buffer.
+ * @retval None
+ */
+void LCD_EndSprite(void)
+{
+   uint32_t *const pixels = lcd_sprite;
+   const uint32_t width = lcd_sprite_rect.x1 - lcd_sprite_rect.x0;
+   const uint32_t height = lcd_sprite_rect.y1 - lcd_sprite_rect.y0;
+
+   if (pixels == NULL)
+      return;
+   lcd_sprite = NULL;
+   LCD_Dirty(lcd_sprite_rect.x0, lcd_sprite_rect.y0, width, height);
+   app_dma2d_copy(LCD_DrawAddress(lcd_sprite_rect.x0, lcd_sprite_rect.y0),
+                  HACT - width, pixels, 0, width, height);
+}
+
+/**
+ * @brief  Get the sprite key of a text.
+ * @param  text
+ * @param  font  Font set by LCD_SetFont
+ * @param  color Text color
+ * @param  back  Back color
+ * @retval Key
+ */
+uint64_t LCD_TextKey(const char *text, const sFONT *font,
+                            uint32_t color, uint32_t back)
+{
+   /* The substitute font depends on the text drawing */
+   const uint32_t style[4] = {(uint32_t)(uintptr_t)font, color, back,
+                              lcd_glyphs};
+
+   return app_sprite_hash(app_sprite_hash(APP_SPRITE_SEED, text, strlen(text)),
+                          style, sizeof(style));
+}
+
+/**
+ * @brief  Draws a bitmap, the rest of the display from its position is marked
+ * as drawn. BSP uses DMA2D, queued operations are finished first.
+ */
+static int32_t LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                              uint8_t *pBmp)
+{
+   LCD_Dirty(Xpos, Ypos, HACT, VACT);
+   app_dma2d_flush();
+   return BSP_LCD_DrawBitmap(Instance, Xpos, Ypos, pBmp);
+}
+
+/**
+ * @brief  Draws RGB rectangle. The data is staged, the caller reuses it.
+ */
+static int32_t LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos,
+                               uint32_t Ypos, uint8_t *pData, uint32_t Width,
+                               uint32_t Height)
+{
+   LCD_Dirty(Xpos, Ypos, Width, Height);
+#if LCD_DMA2D_QUEUE
+   uint32_t *const stage = app_dma2d_stage(4U * Width * Height);
+   if (stage != NULL) {
+      memcpy(stage, pData, 4U * Width * Height);
+      app_dma2d_copy(LCD_DrawAddress(Xpos, Ypos), LCD_DrawPitch() - Width,
+                     stage, 0, Width, Height);
+      return BSP_ERROR_NONE;
+   }
+   app_dma2d_flush();
+#endif
+   return BSP_LCD_FillRGBRect(Instance, Xpos, Ypos, pData, Width, Height);
+}
+
+/**
+ * @brief  Draws horizontal line.
+ */
+static int32_t LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color)
+{
+   LCD_Dirty(Xpos, Ypos, Length, 1);
+#if LCD_DMA2D_QUEUE
+   app_dma2d_fill(LCD_DrawAddress(Xpos, Ypos), LCD_DrawPitch() - Length,
+                  Length, 1, Color);
+   return BSP_ERROR_NONE;
+#else
+   return BSP_LCD_DrawHLine(Instance, Xpos, Ypos, Length, Color);
+#endif
+}
+
+/**
+ * @brief  Draws vertical line.
+ */
+static int32_t LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t Length, uint32_t Color)
+{
+   LCD_Dirty(Xpos, Ypos, 1, Length);
+#if LCD_DMA2D_QUEUE
+   app_dma2d_fill(LCD_DrawAddress(Xpos, Ypos), LCD_DrawPitch() - 1, 1,
+                  Length, Color);
+   return BSP_ERROR_NONE;
+#else
+   return BSP_LCD_DrawVLine(Instance, Xpos, Ypos, Length, Color);
+#endif
+}
+
+/**
+ * @brief  Draws full rectangle.
+ */
+static int32_t LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint32_t Width, uint32_t Height, uint32_t Color)
+{
+   LCD_Dirty(Xpos, Ypos, Width, Height);
+#if LCD_DMA2D_QUEUE
+   app_dma2d_fill(LCD_DrawAddress(Xpos, Ypos), LCD_DrawPitch() - Width,
+                  Width, Height, Color);
+   return BSP_ERROR_NONE;
+#else
+   return BSP_LCD_FillRect(Instance, Xpos, Ypos, Width, Height, Color);
+#endif
+}
+
+/**
+ * @brief  Reads pixel, queued operations are finished first.
+ */
+static int32_t LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                             uint32_t *Color)
+{
+   app_dma2d_flush();
+   cache_invalidate(LCD_DrawAddress(Xpos, Ypos), 4U);
+   return BSP_LCD_ReadPixel(Instance, Xpos, Ypos, Color);
+}
+
+/**
+ * @brief  Draws pixel. It is queued as well, so it is not overwritten by
+ * a queued operation.
+ */
+static int32_t LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                              uint32_t Color)
+{
+   LCD_Dirty(Xpos, Ypos, 1, 1);
+#if LCD_DMA2D_QUEUE
+   app_dma2d_fill(LCD_DrawAddress(Xpos, Ypos), 0, 1, 1, Color);
+   return BSP_ERROR_NONE;
+#else
+   return BSP_LCD_WritePixel(Instance, Xpos, Ypos, Color);
+#endif
+}
+
+/**
+ * @brief  Set the font of the LCD utility. When text is drawn by DMA2D, the
+ * font is replaced by its anti-aliased substitute.
+ * @param  font
+ * @retval None
+ */
+void LCD_SetFont(sFONT *font)
+{
+   lcd_font_alpha = NULL;
+#if LCD_ALPHA_FONTS
+   const uint32_t count =
+       sizeof(font_substitutes) / sizeof(font_substitutes[0]);
+   for (uint32_t i = 0; lcd_glyphs && i < count; i++) {
+      if (font_substitutes[i].font == font) {
+         lcd_font_alpha = font_substitutes[i].alpha;
+         font = &lcd_font_alpha->base;
+         break;
+      }
+   }
+#endif
+   UTIL_LCD_SetFont(font);
+}
+
+/**
+ * @brief  Displays character of the current font. The glyph mask is blended
+ * in the text color over the back color by one DMA2D operation, the LCD
+ * utility draws it row by row.
+ * @param  Xpos  X position
+ * @param  Ypos  Y position
+ * @param  Ascii Character ascii code
+ * @retval None
+ */
+void LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
+{
+   const sFONT *const font = UTIL_LCD_GetFont();
+   const uint8_t *const mask = lcd_glyphs ? app_glyph_get(font, Ascii) : NULL;
+
+   if (mask == NULL) {
+      UTIL_LCD_DisplayChar(Xpos, Ypos, Ascii);
+      return;
+   }
+   LCD_Dirty(Xpos, Ypos, font->Width, font->Height);
+   app_dma2d_blend_color(LCD_DrawAddress(Xpos, Ypos),
+                         LCD_DrawPitch() - font->Width, mask, 0,
+                         font->Width, font->Height, APP_DMA2D_A8,
+                         UTIL_LCD_GetTextColor(), UTIL_LCD_GetBackColor());
+}
+
+/**
+ * @brief  Displays the string at the line of the current font, placed as by
+ * UTIL_LCD_DisplayStringAtLine, from column 1 while the glyph fits.
+ * @param  Line Line of the current font
+ * @param  ptr  Pointer to string
+ * @retval None
+ */
+void LCD_DisplayStringAtLine(uint32_t Line, uint8_t *ptr)
+{
+   const uint32_t width = UTIL_LCD_GetFont()->Width;
+   const uint32_t ypos = LINE(Line);
+
+   if (lcd_font_alpha != NULL && UTIL_LCD_GetFont() == &lcd_font_alpha->base) {
+      const uint32_t drawn = app_font_draw(
+          LCD_DrawAddress(1, ypos), LCD_DrawPitch(), HACT - 1, lcd_font_alpha,
+          ptr, UTIL_LCD_GetTextColor(), UTIL_LCD_GetBackColor());
+      LCD_Dirty(1, ypos, drawn, lcd_font_alpha->base.Height);
+      return;
+   }
+   for (uint32_t i = 0; ptr[i] != 0 && (i + 1U) * width <= HACT; i++)
+      LCD_DisplayChar(1U + i * width, ypos, ptr[i]);
+}
+
+/**
+ * @brief  Get address of the frame buffer.
+ * @param  Index 0 or 1
+ * @retval Address
+ */
+uint32_t LCD_Buffer(uint32_t Index)
+{
+   return LCD_FRAME_BUFFER + Index * LCD_FRAME_BUFFER_SIZE;
+}
+
+/**
+ * @brief  Start drawing into the back buffer. Areas missing in the back buffer
+ * are copied from the front one and BSP drawing is pointed to the back buffer.
+ * @retval 0 on success, -1 if the back buffer waits for the refresh
+ */
+int LCD_BeginDraw(void)
+{
+   app_rect_set_t copy;
+   int ret;
+
+   __disable_irq();
+   ret = app_present_begin(&lcd_present, &copy);
+   __enable_irq();
+   if (ret < 0)
+      return -1;
+
+   const uint32_t *front =
+       (const uint32_t *)(uintptr_t)LCD_Buffer(lcd_present.front);
+   uint32_t *back = (uint32_t *)(uintptr_t)LCD_Buffer(lcd_present.back);
+   for (uint32_t i = 0; i < copy.count; i++) {
+      const app_rect_t *rect = &copy.rect[i];
+      const uint32_t offset = rect->y0 * HACT + rect->x0;
+      const uint32_t width = rect->x1 - rect->x0;
+#if LCD_DMA2D_QUEUE
+      /* Queued before the drawing, so it is overwritten by it */
+      app_dma2d_copy(back + offset, HACT - width, front + offset,
+                     HACT - width, width, rect->y1 - rect->y0);
+#else
+      for (uint32_t y = 0; y < rect->y1 - rect->y0; y++)
+         memcpy(back + offset + y * HACT, front + offset + y * HACT,
+                4U * width);
+#endif
+   }
+
+   hlcd_ltdc.LayerCfg[Lcd_Ctx[0].ActiveLayer].FBStartAdress =
+       (uint32_t)(uintptr_t)back;
+   return 0;
+}
+
+/**
+ * @brief  Start the refresh of the regions of the front buffer.
+ * @retval None
+ */
+static void LCD_StartRefresh(void)
+{
+   /*Refresh the LCD display, all writes to the frame buffer have to be done*/
+   cache_sync();
+   lcd_refresh_next = 0;
+   LCD_RefreshRegion(LCD_Buffer(lcd_present.front),
+                     &lcd_present.refresh.rect[lcd_refresh_next++]);
+}
+
+/**
+ * @brief  End of the refresh of one region, called from the end of refresh
+ * interrupt. The next region is refreshed, after the last one the queued
+ * back buffer is swapped in and APP_EVENT_REFRESH is posted.
+ * @retval None
+ */
+void LCD_RefreshDone(void)
+{
+   if (lcd_present.busy) {
+      /* Continue by the next region of the refresh */
+      if (lcd_refresh_next < lcd_present.refresh.count) {
+         LCD_RefreshRegion(LCD_Buffer(lcd_present.front),
+                           &lcd_present.refresh.rect[lcd_refresh_next++]);
+         return;
+      }
+      /* Swap to the queued back buffer */
+      if (app_present_done(&lcd_present))
+         LCD_StartRefresh();
+   }
+   app_event_post(APP_EVENT_REFRESH);
+}
+
+/**
+ * @brief Present the drawn back buffer. If the previous refresh is still in
+ * progress, the buffer is swapped at its end, otherwise the refresh of the
+ * drawn regions starts now. Nothing is done if nothing was drawn.
+ *
+ */
+void APP_RefreshDisplay(void)
+{
+   uint32_t start;
+
+   /* Queued drawing has to be in the buffer before it is shown */
+   app_dma2d_flush();
+
+   __disable_irq();
+   start = app_present_queue(&lcd_present);
+   __enable_irq();
+
+   if (start)
+      LCD_StartRefresh();
+}
@@ -0,0 +1,152 @@
+/*
+ * app_loop.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_loop.h"
+#include "main.h"
+
+#define TOUCH_POLL 20      /* ms to read touch again while it is held */
+#define TIMER_PERIOD 500   /* ms to redraw the scene while timer runs */
+
+/* Last touch read */
+static TS_State_t TS_State;
+/* ms to check the heater request again, 0 if nothing waits */
+static uint32_t heater_check;
+
+/**
+ * @brief Arm the deadline of the main loop. It wakes up to read held touch, to
+ * redraw running timer, to run the timer wheel and to check the heater request
+ * timeout or send the request again. Without any of them the loop sleeps until
+ * touch or message from M4.
+ *
+ * @param app
+ * @param touched touch was detected by the last read
+ * @param heater ms to check the heater request again, 0 if nothing waits
+ */
+static void APP_ScheduleWakeup(App_t *app, uint8_t touched, uint32_t heater)
+{
+   const uint32_t now = app->now;
+   uint32_t delay = UINT32_MAX;
+   uint32_t next;
+
+   if (touched)
+      delay = TOUCH_POLL;
+   if (heater != 0 && heater < delay)
+      delay = heater;
+   if (app->timer != 0 && TIMER_PERIOD < delay)
+      delay = TIMER_PERIOD;
+   if (app_timer_next(&next) == 0) {
+      const uint32_t left = (int32_t)(next - now) > 0 ? next - now : 0;
+      if (left < delay)
+         delay = left;
+   }
+
+   if (delay == UINT32_MAX)
+      app_event_deadline_cancel();
+   else
+      app_event_deadline(now + delay);
+}
+
+/**
+ * @brief Clear the display, init the app and post all events to render the
+ *        first frame. LCD and touch have to be initialized.
+ * @param app
+ */
+void APP_Start(App_t *app)
+{
+   /* Clear display, the second buffer gets it by the first copy */
+   LCD_BeginDraw();
+   UTIL_LCD_Clear(APP_COLOR_BACKGROUND);
+   APP_InvalidateScene();
+
+   /*Refresh the LCD display*/
+   APP_RefreshDisplay();
+
+   APP_Init(app);
+
+   TS_State.TouchDetected = 0;
+   heater_check = 0;
+
+   /* Run all stages once to render the first frame */
+   app_event_post(APP_EVENT_ALL);
+}
+
+/**
+ * @brief Run one iteration of the main loop, it sleeps until an event
+ * @param app
+ */
+void APP_Loop(App_t *app)
+{
+   /* Sleep until touch, deadline, end of refresh or message from M4 */
+   const uint32_t events = app_event_wait();
+   uint32_t input = events & APP_RECORD_EVENTS_Msk;
+
+   app->now_us = core_clock_us();
+   app->now = (uint32_t)(app->now_us / 1000U);
+
+   /* Touch controller interrupts on a new touch only, a held touch is
+    read again by the deadline. It is kept in the app state, so a replay
+    restored from a keyframe reads touch as the board did. */
+   if ((events & APP_EVENT_TOUCH) || app->touch_held) {
+      BSP_TS_GetState(TS_INSTANCE, &TS_State);
+      input |= APP_RECORD_SAMPLED;
+      if (TS_State.TouchDetected)
+         input |= APP_RECORD_TOUCHED |
+                  (TS_State.TouchX & APP_RECORD_COORD_Msk)
+                      << APP_RECORD_X_Pos |
+                  (TS_State.TouchY & APP_RECORD_COORD_Msk)
+                      << APP_RECORD_Y_Pos;
+   }
+
+   /* Start toasting by the schedule */
+   if (events & APP_EVENT_ALARM) {
+      uint32_t alarms = APP_ScheduleDue();
+      if (alarms > APP_RECORD_ALARMS_Msk)
+         alarms = APP_RECORD_ALARMS_Msk;
+      input |= alarms << APP_RECORD_ALARMS_Pos;
+   }
+
+   /* Handel touch && Update app struct, the step is recorded */
+   APP_RecordStep(app, input, &TS_State);
+
+   /* Turn on toaster, in testing mode I used LED. The state reported by M4
+    is read before the scene is drawn. */
+   if (events & (APP_EVENT_TOUCH | APP_EVENT_TIMER | APP_EVENT_CORE |
+                 APP_EVENT_ALARM))
+      heater_check = APP_TurnPeripheries(app);
+
+   /* Render display by app struct, the heater widget changes by M4 */
+   if (events & (APP_EVENT_TOUCH | APP_EVENT_TIMER | APP_EVENT_ALARM |
+                 APP_EVENT_CORE))
+      APP_UpdateScene(app);
+   else if ((events & APP_EVENT_REFRESH) && APP_RenderDeferred())
+      APP_UpdateScene(app);
+
+   APP_ScheduleWakeup(app, app->touch_held, heater_check);
+}
@@ -0,0 +1,114 @@
+/*
+ * app_present.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_present.h"
+
+/**
+ * @brief Show the back buffer, the drawn areas are refreshed and the new back
+ *        buffer misses them
+ * @return uint32_t 1, the refresh has to be started
+ */
+static uint32_t present_swap(app_present_t *const present)
+{
+   present->front = present->back;
+   if (present->buffers == 2U) {
+      present->back ^= 1U;
+      present->stale = present->dirty;
+   }
+   present->refresh = present->dirty;
+   app_rect_clear(&present->dirty);
+   present->queued = 0;
+   present->busy = 1;
+   return 1;
+}
+
+/**
+ * @brief Reset the state, no refresh is running
+ * @param present
+ * @param buffers 1 or 2
+ */
+void app_present_init(app_present_t *const present, const uint32_t buffers)
+{
+   present->buffers = buffers == 2U ? 2U : 1U;
+   present->back = 0;
+   present->front = 0;
+   present->busy = 0;
+   present->queued = 0;
+   app_rect_clear(&present->dirty);
+   app_rect_clear(&present->stale);
+   app_rect_clear(&present->refresh);
+}
+
+/**
+ * @brief Start drawing into the back buffer
+ * @param present
+ * @param copy areas to copy from front to back before drawing
+ * @return int 0 on success, -1 if drawing has to wait for the refresh
+ */
+int app_present_begin(app_present_t *const present, app_rect_set_t *const copy)
+{
+   /* Queued buffer is fenced, a single buffer is refreshed */
+   if (present->queued || (present->buffers == 1U && present->busy))
+      return -1;
+
+   *copy = present->stale;
+   app_rect_clear(&present->stale);
+   return 0;
+}
+
+/**
+ * @brief Queue the drawn back buffer for the refresh
+ * @param present
+ * @return uint32_t 1 if the refresh has to be started now
+ */
+uint32_t app_present_queue(app_present_t *const present)
+{
+   if (present->queued || present->dirty.count == 0)
+      return 0;
+
+   present->queued = 1;
+   if (present->busy)
+      return 0;
+   return present_swap(present);
+}
+
+/**
+ * @brief End of the refresh of the front buffer
+ * @param present
+ * @return uint32_t 1 if the refresh of the queued buffer has to be started
+ */
+uint32_t app_present_done(app_present_t *const present)
+{
+   present->busy = 0;
+   app_rect_clear(&present->refresh);
+   if (!present->queued)
+      return 0;
+   return present_swap(present);
+}
@@ -0,0 +1,254 @@
+/*
+ * app_record.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_record.h"
+#include "stm32h7xx_hal.h"
+#include <string.h>
+
+#define RECORD_MAGIC (0x52454331UL)
+
+typedef struct {
+   uint64_t base_us; /* time of the entry before the first one */
+   uint32_t count;
+   uint32_t session; /* 1 block is the first one after boot */
+   uint8_t state[APP_RECORD_STATE_SIZE]; /* keyframe before the first entry */
+   app_record_entry_t entries[APP_RECORD_BLOCK_SIZE];
+} record_block_t;
+
+typedef struct {
+   uint32_t magic;
+   uint32_t head;   /* block being written */
+   uint32_t blocks; /* used blocks */
+   uint32_t session; /* next block starts a new session */
+   uint64_t last_us;
+   uint8_t last_state[APP_RECORD_STATE_SIZE];
+   record_block_t block[APP_RECORD_BLOCKS];
+} record_t;
+
+/* Ring is placed at the end of AXI SRAM, which is not used by the linker
+   script, so the startup code does not clear it */
+static record_t *const record =
+    (record_t *)(D1_AXISRAM_BASE + 0x80000UL - sizeof(record_t));
+
+/* Nothing is recorded while the ring is replayed */
+static uint8_t record_replaying = 0;
+
+/**
+ * @brief Drop all entries and start a new recording
+ */
+void app_record_init(void)
+{
+   record_replaying = 0;
+   record->head = 0;
+   record->blocks = 0;
+   record->session = 1;
+   record->last_us = 0;
+   record->magic = RECORD_MAGIC;
+}
+
+/**
+ * @brief Start a new session after boot. The recording from before reset is
+ *        kept, if it is valid, otherwise a new recording is started.
+ */
+void app_record_start(void)
+{
+   record_replaying = 0;
+   if (!app_record_valid()) {
+      app_record_init();
+      return;
+   }
+   record->session = 1;
+}
+
+/**
+ * @brief Check whether the ring holds a recording, e.g. from before reset
+ * @return 1 if valid
+ */
+int app_record_valid(void)
+{
+   return record->magic == RECORD_MAGIC && record->blocks != 0 &&
+          record->blocks <= APP_RECORD_BLOCKS &&
+          record->head < APP_RECORD_BLOCKS;
+}
+
+/**
+ * @brief Add one entry, the block is opened by the caller
+ * @param delta_us
+ * @param input
+ * @param state
+ * @param size
+ */
+static void record_add(const uint32_t delta_us, const uint32_t input,
+                       const void *const state, const size_t size)
+{
+   record_block_t *block = &record->block[record->head];
+
+   if (record->blocks == 0 || record->session ||
+       block->count == APP_RECORD_BLOCK_SIZE) {
+      /* Open the next block, the oldest one is overwritten */
+      if (record->blocks != 0) {
+         record->head = (record->head + 1U) % APP_RECORD_BLOCKS;
+         block = &record->block[record->head];
+      }
+      if (record->blocks < APP_RECORD_BLOCKS) {
+         record->blocks++;
+      }
+      block->base_us = record->last_us;
+      block->count = 0;
+      block->session = record->session;
+      record->session = 0;
+      memcpy(block->state, state, size);
+   }
+
+   block->entries[block->count].delta_us = delta_us;
+   block->entries[block->count].input = input;
+   block->count++;
+   record->last_us += delta_us;
+}
+
+/**
+ * @brief Add entry, called before the step is processed. The state is stored
+ *        as a keyframe, when the entry opens a new block.
+ * @param time_us time of the step
+ * @param input APP_RECORD_* fields
+ * @param state app state before the step
+ * @param size size of the state, at most APP_RECORD_STATE_SIZE
+ */
+void app_record_put(const uint64_t time_us, const uint32_t input,
+                    const void *const state, const size_t size)
+{
+   if (record_replaying) {
+      return;
+   }
+   if (record->blocks == 0 || record->session) {
+      /* Clock starts again after reset */
+      record->last_us = time_us;
+   }
+
+   /* Gap over the range of one entry is filled by entries without input */
+   uint64_t delta = time_us - record->last_us;
+   while (delta > UINT32_MAX) {
+      record_add(UINT32_MAX, 0, state, size);
+      delta -= UINT32_MAX;
+   }
+   record_add((uint32_t)delta, input, state, size);
+}
+
+/**
+ * @brief Add output of the step to the last entry and keep the state after
+ *        the step to check the replay
+ * @param output APP_RECORD_HEATER
+ * @param state app state after the step
+ * @param size
+ */
+void app_record_output(const uint32_t output, const void *const state,
+                       const size_t size)
+{
+   record_block_t *const block = &record->block[record->head];
+
+   if (record_replaying || record->blocks == 0 || block->count == 0) {
+      return;
+   }
+   block->entries[block->count - 1U].input |= output;
+   memcpy(record->last_state, state, size);
+}
+
+/**
+ * @brief Start the replay at the oldest block, recording stops until
+ *        app_record_start()
+ * @param cursor
+ * @param state keyframe of the oldest block is copied here
+ * @param size
+ * @return 0 on success, -1 if there is no recording
+ */
+int app_record_first(app_record_cursor_t *const cursor, void *const state,
+                     const size_t size)
+{
+   if (!app_record_valid()) {
+      return -1;
+   }
+
+   record_replaying = 1;
+   const uint32_t oldest =
+       (record->head + APP_RECORD_BLOCKS + 1U - record->blocks) %
+       APP_RECORD_BLOCKS;
+   cursor->block = 0;
+   cursor->entry = 0;
+   cursor->time_us = record->block[oldest].base_us;
+   memcpy(state, record->block[oldest].state, size);
+   return 0;
+}
+
+/**
+ * @brief Get next entry of the replay
+ * @param cursor
+ * @param entry
+ * @param state keyframe is copied here, if the entry starts a new session
+ * @param size
+ * @return 0 on success, 1 if the entry starts a new session, -1 at the end of
+ *         the recording
+ */
+int app_record_next(app_record_cursor_t *const cursor,
+                    app_record_entry_t *const entry, void *const state,
+                    const size_t size)
+{
+   while (cursor->block < record->blocks) {
+      const uint32_t index =
+          (record->head + APP_RECORD_BLOCKS + 1U - record->blocks +
+           cursor->block) %
+          APP_RECORD_BLOCKS;
+      const record_block_t *const block = &record->block[index];
+
+      if (cursor->entry < block->count) {
+         int ret = 0;
+         if (cursor->entry == 0 && cursor->block != 0 && block->session) {
+            memcpy(state, block->state, size);
+            cursor->time_us = block->base_us;
+            ret = 1;
+         }
+         *entry = block->entries[cursor->entry++];
+         cursor->time_us += entry->delta_us;
+         return ret;
+      }
+      cursor->block++;
+      cursor->entry = 0;
+   }
+   return -1;
+}
+
+/**
+ * @brief Get the state after the last recorded step
+ * @param state
+ * @param size
+ */
+void app_record_last_state(void *const state, const size_t size)
+{
+   memcpy(state, record->last_state, size);
+}
@@ -0,0 +1,261 @@
+/*
+ * app_rect.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_rect.h"
+
+static uint32_t rect_area(const app_rect_t *const r)
+{
+   return (uint32_t)(r->x1 - r->x0) * (uint32_t)(r->y1 - r->y0);
+}
+
+static app_rect_t rect_union(const app_rect_t *const a,
+                             const app_rect_t *const b)
+{
+   app_rect_t r;
+
+   r.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+   r.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+   r.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+   r.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+   return r;
+}
+
+/**
+ * @brief Pixels of the union that are in none of the rectangles, overlap is
+ *        counted as saved
+ */
+static int32_t rect_waste(const app_rect_t *const a,
+                          const app_rect_t *const b)
+{
+   const app_rect_t u = rect_union(a, b);
+
+   return (int32_t)rect_area(&u) - (int32_t)rect_area(a) -
+          (int32_t)rect_area(b);
+}
+
+static uint32_t rect_contains(const app_rect_t *const a,
+                              const app_rect_t *const b)
+{
+   return a->x0 <= b->x0 && a->y0 <= b->y0 && a->x1 >= b->x1 &&
+          a->y1 >= b->y1;
+}
+
+/**
+ * @brief Add dirty rectangle, empty ones are ignored
+ * @param set
+ * @param x
+ * @param y
+ * @param width
+ * @param height
+ */
+void app_rect_add(app_rect_set_t *const set, const uint32_t x,
+                  const uint32_t y, const uint32_t width,
+                  const uint32_t height)
+{
+   app_rect_t r;
+
+   if (width == 0 || height == 0)
+      return;
+   r.x0 = (uint16_t)x;
+   r.y0 = (uint16_t)y;
+   r.x1 = (uint16_t)(x + width);
+   r.y1 = (uint16_t)(y + height);
+
+   /* Most of the drawing is inside of an already dirty region */
+   for (uint32_t i = 0; i < set->count; i++) {
+      if (rect_contains(&set->rect[i], &r))
+         return;
+   }
+
+   for (;;) {
+      /* Merge with regions the union does not waste, the merged rectangle
+         may reach other regions, so the search starts again */
+      for (uint32_t i = 0; i < set->count;) {
+         if (rect_waste(&set->rect[i], &r) <= (int32_t)APP_RECT_SLACK) {
+            r = rect_union(&set->rect[i], &r);
+            set->rect[i] = set->rect[--set->count];
+            i = 0;
+         } else {
+            i++;
+         }
+      }
+      if (set->count < APP_RECT_MAX)
+         break;
+
+      /* No free slot, merge with the region that grows the least */
+      uint32_t best = 0;
+      int32_t best_waste = INT32_MAX;
+      for (uint32_t i = 0; i < set->count; i++) {
+         const int32_t waste = rect_waste(&set->rect[i], &r);
+         if (waste < best_waste) {
+            best_waste = waste;
+            best = i;
+         }
+      }
+      r = rect_union(&set->rect[best], &r);
+      set->rect[best] = set->rect[--set->count];
+   }
+   set->rect[set->count++] = r;
+}
+
+/**
+ * @brief Get pixels covered by the regions
+ * @param set
+ * @return uint32_t
+ */
+uint32_t app_rect_area(const app_rect_set_t *const set)
+{
+   uint32_t area = 0;
+
+   for (uint32_t i = 0; i < set->count; i++)
+      area += rect_area(&set->rect[i]);
+   return area;
+}
+
+#ifdef APP_RECT_BENCH
+
+#include "stm32h7xx_hal.h"
+
+static app_rect_bench_t bench;
+
+/**
+ * @brief Rectangles of text drawn by the LCD utility, one per line of a glyph
+ */
+static uint32_t bench_text(app_rect_set_t *const set, const uint32_t line,
+                           const uint32_t chars, const uint32_t width,
+                           const uint32_t height)
+{
+   for (uint32_t c = 0; c < chars; c++) {
+      for (uint32_t i = 0; i < height; i++)
+         app_rect_add(set, c * width, line * height + i, width, 1);
+   }
+   return chars * height;
+}
+
+/**
+ * @brief Rectangles of the filled circle, lines from the center to the edges
+ */
+static uint32_t bench_circle(app_rect_set_t *const set, const uint32_t x,
+                             const uint32_t y, const uint32_t radius)
+{
+   for (uint32_t i = 0; i <= radius; i++) {
+      uint32_t half = radius;
+      while (half * half + i * i > radius * radius)
+         half--;
+      app_rect_add(set, x - half, y + i, 2 * half, 1);
+      app_rect_add(set, x - half, y - i, 2 * half, 1);
+   }
+   return 2 * (radius + 1);
+}
+
+static uint32_t bench_progress(app_rect_set_t *const set,
+                               const uint32_t progress)
+{
+   app_rect_add(set, 0, 440, 800, 20);
+   app_rect_add(set, 19, 439, 762, 22);
+   app_rect_add(set, 20, 440, progress * 760 / 100, 20);
+   return 3;
+}
+
+/**
+ * @brief Add rectangles of one update of the pattern
+ * @return uint32_t count of added rectangles
+ */
+static uint32_t bench_pattern(app_rect_set_t *const set,
+                              const app_rect_pattern_t pattern,
+                              const uint32_t n)
+{
+   uint32_t adds = 0;
+
+   switch (pattern) {
+   case APP_RECT_PATTERN_PROGRESS:
+      adds += bench_progress(set, n % 101);
+      break;
+   case APP_RECT_PATTERN_COUNTDOWN:
+      adds += bench_text(set, 26, 45, 11, 16);
+      adds += bench_progress(set, n % 101);
+      break;
+   case APP_RECT_PATTERN_DIAL:
+      adds += bench_text(set, 4, 10, 20, 32);
+      adds += bench_text(set, 9, 10, 20, 32);
+      adds += bench_text(set, 11, 15, 17, 20);
+      break;
+   case APP_RECT_PATTERN_SCENE:
+   default:
+      adds += bench_text(set, 17, 47, 17, 20);
+      adds += bench_circle(set, 600, 220, 92);
+      adds += bench_circle(set, 600, 220, 90);
+      adds += bench_circle(set, 200, 220, 92);
+      adds += bench_circle(set, 200, 220, 90);
+      app_rect_add(set, 0, 0, 800, 75);
+      adds += 1 + bench_text(set, 1, 36, 17, 20);
+      adds += bench_text(set, 26, 45, 11, 16);
+      adds += bench_progress(set, n % 101);
+      break;
+   }
+   return adds;
+}
+
+/**
+ * @brief Measure the coalescing on the update patterns of the UI
+ */
+void app_rect_bench_run(void)
+{
+   app_rect_set_t set;
+
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+   bench.done = 0;
+   for (uint32_t p = 0; p < APP_RECT_PATTERN_COUNT; p++) {
+      app_rect_bench_pattern_t *const result = &bench.pattern[p];
+      uint64_t sum = 0;
+
+      for (uint32_t n = 0; n < APP_RECT_BENCH_COUNT; n++) {
+         app_rect_clear(&set);
+         const uint32_t start = DWT->CYCCNT;
+         result->adds = bench_pattern(&set, (app_rect_pattern_t)p, n);
+         sum += DWT->CYCCNT - start;
+      }
+      result->add_avg =
+          (uint32_t)(sum / ((uint64_t)APP_RECT_BENCH_COUNT * result->adds));
+      result->regions = set.count;
+      result->area = app_rect_area(&set);
+   }
+   bench.done = 1;
+}
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_rect_bench_t*
+ */
+const app_rect_bench_t *app_rect_bench_results(void) { return &bench; }
+
+#endif /* APP_RECT_BENCH */
@@ -0,0 +1,372 @@
+/*
+ * app_rtc.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_rtc.h"
+#include "main.h"
+
+/* Schedule kept in RTC backup registers: header, then 2 words per entry */
+#define SCHEDULE_BKP_MAGIC 0x5C4E0000UL
+#define SCHEDULE_BKP_HEADER 0U
+#define SCHEDULE_BKP_ENTRIES 1U
+
+/* Weekly starts added on the first boot, X(weekday, hours, minutes), e.g.
+   X(APP_SCHEDULE_MONDAY, 7, 0) */
+#define APP_WEEKLY_SLOTS(X)
+
+/* A calendar behind the seed has never been set, e.g. the backup domain lost
+   its power, and it starts at the seed. The build time by default, 0 leaves
+   the calendar as it is. */
+#ifndef APP_RTC_SEED
+#define APP_RTC_SEED (rtc_build_time())
+#endif
+
+RTC_HandleTypeDef hrtc;
+static uint8_t rtc_replaying = 0;
+static uint32_t rtc_replay_due = 0;
+
+/**
+ * @brief Time of the build from __DATE__ "Oct 17 2026" and __TIME__
+ * "12:34:56".
+ *
+ * @return uint32_t seconds since 2000-01-01 00:00:00
+ */
+static uint32_t rtc_build_time(void)
+{
+   static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+   const char *const date = __DATE__;
+   const char *const time = __TIME__;
+   uint8_t month = 1;
+
+   while (month < 12U && (months[3U * (month - 1U)] != date[0] ||
+                          months[3U * (month - 1U) + 1U] != date[1] ||
+                          months[3U * (month - 1U) + 2U] != date[2]))
+      month++;
+   const uint8_t day = (uint8_t)((date[4] == ' ' ? 0 : (date[4] - '0') * 10) +
+                                 (date[5] - '0'));
+   const uint8_t year = (uint8_t)((date[9] - '0') * 10 + (date[10] - '0'));
+   return app_schedule_time(year, month, day,
+                            (uint8_t)((time[0] - '0') * 10 + (time[1] - '0')),
+                            (uint8_t)((time[3] - '0') * 10 + (time[4] - '0')),
+                            (uint8_t)((time[6] - '0') * 10 + (time[7] - '0')));
+}
+
+/**
+ * @brief Write the calendar, the schedule is left alone.
+ *
+ * @param time seconds since 2000-01-01 00:00:00
+ */
+static void rtc_write(const uint32_t time)
+{
+   const uint32_t seconds = time % APP_SCHEDULE_DAY;
+   RTC_TimeTypeDef clock = {0};
+   RTC_DateTypeDef date = {0};
+
+   clock.Hours = (uint8_t)(seconds / 3600U);
+   clock.Minutes = (uint8_t)(seconds / 60U % 60U);
+   clock.Seconds = (uint8_t)(seconds % 60U);
+   clock.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+   clock.StoreOperation = RTC_STOREOPERATION_RESET;
+   app_schedule_date(time, &date.Year, &date.Month, &date.Date);
+   /* Alarm A matches the day of the week, it has to be right */
+   date.WeekDay = app_schedule_weekday(time);
+   if (HAL_RTC_SetTime(&hrtc, &clock, RTC_FORMAT_BIN) != HAL_OK ||
+       HAL_RTC_SetDate(&hrtc, &date, RTC_FORMAT_BIN) != HAL_OK) {
+      Error_Handler();
+   }
+}
+
+/**
+ * @brief Init RTC, the calendar keeps running over reset.
+ *
+ */
+void RTC_Init(void)
+{
+   hrtc.Instance = RTC;
+   hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
+   hrtc.Init.AsynchPrediv = 127; /* 32768 Hz LSE to 1 Hz */
+   hrtc.Init.SynchPrediv = 255;
+   hrtc.Init.OutPut = RTC_OUTPUT_DISABLE;
+   hrtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+   hrtc.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
+   hrtc.Init.OutPutRemap = RTC_OUTPUT_REMAP_NONE;
+   if (HAL_RTC_Init(&hrtc) != HAL_OK) {
+      Error_Handler();
+   }
+   APP_RtcSeed(APP_RTC_SEED);
+}
+
+/**
+ * @brief Set the calendar to the seed if it is behind it, the schedule is not
+ * restored yet.
+ *
+ * @param seed seconds since 2000-01-01 00:00:00, 0 for none
+ * @return 1 if the calendar was set
+ */
+uint8_t APP_RtcSeed(const uint32_t seed)
+{
+   if (rtc_replaying || APP_RtcNow() >= seed)
+      return 0;
+   rtc_write(seed);
+   return 1;
+}
+
+/**
+ * @brief Set the calendar. Weekly entries of the schedule keep their time of
+ * the week and are moved into the week ahead, one shot entries keep their
+ * delay from now.
+ *
+ * @param time seconds since 2000-01-01 00:00:00
+ */
+void APP_RtcSet(const uint32_t time)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   const uint32_t count = app_schedule_save(entries);
+   const uint32_t before = APP_RtcNow();
+
+   if (rtc_replaying)
+      return;
+
+   rtc_write(time);
+   for (uint32_t i = 0; i < count; i++) {
+      if (!entries[i].weekly) {
+         entries[i].fire += time - before;
+      } else if (entries[i].fire > time &&
+                 entries[i].fire - time > APP_SCHEDULE_WEEK) {
+         entries[i].fire -= (entries[i].fire - time - 1U) /
+                            APP_SCHEDULE_WEEK * APP_SCHEDULE_WEEK;
+      }
+   }
+   /* Weekly entries in the past are moved ahead by the load */
+   app_schedule_load(entries, count, time);
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+}
+
+/**
+ * @brief Read the RTC calendar.
+ *
+ * @return uint32_t seconds since 2000-01-01 00:00:00
+ */
+uint32_t APP_RtcNow(void)
+{
+   RTC_TimeTypeDef time;
+   RTC_DateTypeDef date;
+
+   /* Replay does not fire the schedule by time, the recorded starts are used */
+   if (rtc_replaying)
+      return 0;
+
+   /* Date has to be read after time, it unlocks the shadow registers */
+   HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+   HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);
+   return app_schedule_time(date.Year, date.Month, date.Date, time.Hours,
+                            time.Minutes, time.Seconds);
+}
+
+/**
+ * @brief Detach the schedule from the RTC while the recording is replayed.
+ * The time is 0 and the schedule is neither stored nor armed, the recorded
+ * starts are used instead.
+ *
+ * @param replaying 1 during the replay
+ */
+void APP_RtcReplay(uint8_t replaying) { rtc_replaying = replaying; }
+
+/**
+ * @brief Set the recorded count of scheduled starts, the next APP_ScheduleDue()
+ * takes as many first entries of the schedule while replaying.
+ *
+ * @param count
+ */
+void APP_RtcReplayDue(uint32_t count) { rtc_replay_due = count; }
+
+/**
+ * @brief Load the schedule from the RTC backup registers. On the first boot
+ * the weekly starts of APP_WEEKLY_SLOTS are added, more are added by
+ * APP_ScheduleAddWeekly().
+ *
+ * @param now current time
+ */
+void APP_ScheduleRestore(uint32_t now)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   const uint32_t header = HAL_RTCEx_BKUPRead(&hrtc, SCHEDULE_BKP_HEADER);
+   uint32_t count = header & 0xFFFFU;
+
+   if ((header & 0xFFFF0000UL) != SCHEDULE_BKP_MAGIC ||
+       count > APP_SCHEDULE_SIZE) {
+      app_schedule_init();
+#define APP_WEEKLY_SLOT_ADD(weekday, hours, minutes)                           \
+   app_schedule_add_weekly(now, weekday, hours, minutes);
+      APP_WEEKLY_SLOTS(APP_WEEKLY_SLOT_ADD)
+#undef APP_WEEKLY_SLOT_ADD
+   } else {
+      for (uint32_t i = 0; i < count; i++) {
+         const uint32_t reg = SCHEDULE_BKP_ENTRIES + 2U * i;
+         const uint32_t info = HAL_RTCEx_BKUPRead(&hrtc, reg + 1U);
+         entries[i].fire = HAL_RTCEx_BKUPRead(&hrtc, reg);
+         entries[i].id = (uint16_t)info;
+         entries[i].weekly = (uint16_t)(info >> 16);
+      }
+      app_schedule_load(entries, count, now);
+   }
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+}
+
+/**
+ * @brief Add a weekly start, it is kept over reset.
+ *
+ * @param weekday APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ * @param hours
+ * @param minutes
+ * @return id of the entry, 0 if the schedule is full or the time is invalid
+ */
+uint16_t APP_ScheduleAddWeekly(uint8_t weekday, uint8_t hours, uint8_t minutes)
+{
+   if (weekday < APP_SCHEDULE_MONDAY || weekday > APP_SCHEDULE_SUNDAY ||
+       hours > 23U || minutes > 59U)
+      return 0;
+
+   const uint16_t id =
+       app_schedule_add_weekly(APP_RtcNow(), weekday, hours, minutes);
+   if (id != 0) {
+      APP_ScheduleStore();
+      APP_ScheduleArm();
+   }
+   return id;
+}
+
+/**
+ * @brief Remove an entry of the schedule, e.g. a weekly start.
+ *
+ * @param id given by APP_ScheduleAddWeekly()
+ * @return 0 on success, -1 if there is no such entry
+ */
+int APP_ScheduleRemove(uint16_t id)
+{
+   if (app_schedule_remove(id) < 0)
+      return -1;
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+   return 0;
+}
+
+/**
+ * @brief Save the schedule into the RTC backup registers.
+ *
+ */
+void APP_ScheduleStore(void)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   const uint32_t count = app_schedule_save(entries);
+
+   if (rtc_replaying)
+      return;
+
+   for (uint32_t i = 0; i < count; i++) {
+      const uint32_t reg = SCHEDULE_BKP_ENTRIES + 2U * i;
+      HAL_RTCEx_BKUPWrite(&hrtc, reg, entries[i].fire);
+      HAL_RTCEx_BKUPWrite(&hrtc, reg + 1U,
+                          ((uint32_t)entries[i].weekly << 16) | entries[i].id);
+   }
+   HAL_RTCEx_BKUPWrite(&hrtc, SCHEDULE_BKP_HEADER, SCHEDULE_BKP_MAGIC | count);
+}
+
+/**
+ * @brief Set RTC alarm A to the first entry of the schedule. The alarm matches
+ * the day of the week, so an entry more than a week ahead wakes up the loop
+ * earlier and the alarm is just set again.
+ *
+ */
+void APP_ScheduleArm(void)
+{
+   app_schedule_entry_t entry;
+   RTC_AlarmTypeDef alarm = {0};
+
+   if (rtc_replaying)
+      return;
+   HAL_RTC_DeactivateAlarm(&hrtc, RTC_ALARM_A);
+   if (app_schedule_peek(&entry) < 0)
+      return;
+
+   const uint32_t seconds = entry.fire % APP_SCHEDULE_DAY;
+   alarm.AlarmTime.Hours = (uint8_t)(seconds / 3600U);
+   alarm.AlarmTime.Minutes = (uint8_t)(seconds / 60U % 60U);
+   alarm.AlarmTime.Seconds = (uint8_t)(seconds % 60U);
+   alarm.AlarmMask = RTC_ALARMMASK_NONE;
+   alarm.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_ALL;
+   alarm.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY;
+   alarm.AlarmDateWeekDay = app_schedule_weekday(entry.fire);
+   alarm.Alarm = RTC_ALARM_A;
+   HAL_RTC_SetAlarm_IT(&hrtc, &alarm, RTC_FORMAT_BIN);
+
+   /* The second of the entry may have begun before the alarm was set */
+   if (entry.fire <= APP_RtcNow())
+      app_event_post(APP_EVENT_ALARM);
+}
+
+/**
+ * @brief Take all due entries of the schedule and arm the alarm for the next
+ * one. The delayed start entry is cleared by the entry action of the scene.
+ *
+ * @return uint32_t count of scheduled starts to dispatch
+ */
+uint32_t APP_ScheduleDue(void)
+{
+   app_schedule_entry_t entry;
+   const uint32_t now = APP_RtcNow();
+   uint32_t count = 0;
+
+   if (rtc_replaying) {
+      /* The recorded starts are taken in the order of firing */
+      while (count < rtc_replay_due && app_schedule_peek(&entry) == 0 &&
+             app_schedule_pop(entry.fire, &entry) == 0)
+         count++;
+      rtc_replay_due = 0;
+      return count;
+   }
+
+   while (app_schedule_pop(now, &entry) == 0)
+      count++;
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+   return count;
+}
+
+/**
+ * @brief  RTC alarm A callback, an entry of the schedule is due.
+ * @param  hrtc RTC handle
+ * @retval None
+ */
+void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc)
+{
+   app_event_post(APP_EVENT_ALARM);
+}
@@ -0,0 +1,482 @@
+/*
+ * app_scene.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_scene.h"
+#include "main.h"
+#include <string.h>
+
+#define INPUT_LOCKOUT 800 /* ms to ignore touch after scene transition */
+
+/* Look of the scene and its entry action */
+typedef struct {
+   uint32_t button_left_color;
+   Button_type_t button_left_type;
+   uint32_t button_right_color;
+   Button_type_t button_right_type;
+   uint32_t status_color;
+   const char *status_message;
+   const char *button_titles;
+   void (*enter)(App_t *app);
+} Scene_desc_t;
+
+static uint8_t APP_InputLocked(App_t *app, uint32_t now);
+static void APP_StartTimer(App_t *app);
+static void APP_UpdateTimer(App_t *app);
+static void APP_TimerExpired(app_timer_t *timer, void *arg);
+
+static void TO_FRONT_SCENE(App_t *app);
+static void TO_TURNON_SCENE(App_t *app);
+static void TO_TIMER_CONFIG_SCENE(App_t *app);
+static void TO_WAITING_SCENE(App_t *app);
+
+/* Scene descriptors, indexed by Scene_t */
+static const Scene_desc_t scene_desc[SCENE_COUNT] = {
+    [FRONT_SCREEN] = {APP_COLOR_GREEN, PUSH_BUTTON, APP_COLOR_YELLOW,
+                      PUSH_BUTTON, APP_COLOR_RED,
+                      "  Toaster is stopped                         ",
+                      "     MANUALLY START          SETUP TIMER           ",
+                      TO_FRONT_SCENE},
+    [TURNON_SCENE] = {APP_COLOR_RED, PUSH_BUTTON, APP_COLOR_BACKGROUND, NONE,
+                      APP_COLOR_GREEN,
+                      "  Started manually                          ",
+                      "     MANUALLY STOP                                 ",
+                      TO_TURNON_SCENE},
+    [TIMER_CONFIG_SCENE] = {APP_COLOR_GREEN, TIMER_BUTTON, APP_COLOR_GREEN,
+                            PUSH_BUTTON, APP_COLOR_YELLOW,
+                            "  Delay configuration                       ",
+                            "                             START TIMER           ",
+                            TO_TIMER_CONFIG_SCENE},
+    [WAITING_SCENE] = {APP_COLOR_YELLOW, PUSH_BUTTON, APP_COLOR_GREEN,
+                       PUSH_BUTTON, APP_COLOR_YELLOW, "",
+                       "      STOP TIMER            MANUALLY START         ",
+                       TO_WAITING_SCENE},
+};
+
+/* Transition table, scene x event -> next scene */
+static const Scene_t scene_transitions[SCENE_COUNT][EVENT_COUNT] = {
+    /* MANUALLY START, SETUP TIMER, -, scheduled start */
+    [FRONT_SCREEN] = {TURNON_SCENE, TIMER_CONFIG_SCENE, FRONT_SCREEN,
+                      TURNON_SCENE},
+    /* MANUALLY STOP, -, heating is over, - */
+    [TURNON_SCENE] = {FRONT_SCREEN, SCENE_NONE, FRONT_SCREEN, SCENE_NONE},
+    /* -, START TIMER, -, scheduled start leaves the configuration */
+    [TIMER_CONFIG_SCENE] = {SCENE_NONE, WAITING_SCENE, FRONT_SCREEN,
+                            TURNON_SCENE},
+    /* STOP TIMER, MANUALLY START, delay is over, delay is over */
+    [WAITING_SCENE] = {FRONT_SCREEN, TURNON_SCENE, TURNON_SCENE,
+                       TURNON_SCENE},
+};
+
+_Static_assert(sizeof(App_keyframe_t) <= APP_RECORD_STATE_SIZE,
+               "App_keyframe_t does not fit the recorder keyframe");
+
+/**
+ * @brief Set up the front scene and the timer wheel.
+ *
+ * @param app
+ */
+void APP_Init(App_t *app)
+{
+   app->now_us = core_clock_us();
+   app->now = (uint32_t)(app->now_us / 1000U);
+   app->progress_bar = 100;
+   app->timer = 0;
+   app->scene = FRONT_SCREEN;
+   strcpy(app->status_message, "  Toaster is stopped                         ");
+   app->status_minutes = UINT32_MAX;
+   app->status_version = 0;
+   strcpy(app->title, "            ~ TOASTER CONTROLLER ~");
+   app->status_color = APP_COLOR_RED;
+   app->button_left_color = APP_COLOR_GREEN;
+   app->button_left_type = PUSH_BUTTON;
+   app->button_right_color = APP_COLOR_YELLOW;
+   app->button_right_type = PUSH_BUTTON;
+   app->_delay = 0;
+   app->delay_start = 0;
+   memset(&app->heater, 0, sizeof(app->heater));
+   app->heater_read_errors = 0;
+   memset(&app->timer_expiry, 0, sizeof(app->timer_expiry));
+   app->delayed_start = 0;
+   app->heater_confirmed = 0;
+   app->heater_lost = 0;
+   app->touch_held = 0;
+
+   app_timer_init(app->now);
+}
+
+/**
+ * @brief Get titles under the buttons of the scene.
+ *
+ * @param scene
+ * @return const char* titles
+ */
+const char *APP_ButtonTitles(Scene_t scene)
+{
+   return scene_desc[scene].button_titles;
+}
+
+/**
+ * @brief The util function to determine if the touch is in the area. The
+ * examined area is in the shape of a square.
+ *
+ * @param s (TS_State_t) The structure returned from touch screen
+ * @param x_max
+ * @param x_min
+ * @param y_max
+ * @param y_min
+ * @return uint8_t
+ */
+uint8_t APP_HandleTouch_IsInInterval(TS_State_t *s, uint32_t x_max,
+                                     uint32_t x_min, uint32_t y_max,
+                                     uint32_t y_min)
+{
+   if (s->TouchX < x_max && s->TouchX > x_min && s->TouchY < y_max &&
+       s->TouchY > y_min)
+      return 1;
+   else
+      return 0;
+}
+
+/**
+ * @brief Check the input lockout after scene transition. The lockout is
+ * released once INPUT_LOCKOUT elapsed since the transition, the main loop keeps
+ * running in the meantime.
+ *
+ * @param app
+ * @param now current tick
+ * @return uint8_t 1 if touch has to be ignored
+ */
+static uint8_t APP_InputLocked(App_t *app, uint32_t now)
+{
+   if (app->_delay && now - app->delay_start < INPUT_LOCKOUT)
+      return 1;
+   app->_delay = 0;
+   return 0;
+}
+
+/**
+ * @brief Start software timer on the timer wheel, the expiry is dispatched to
+ * the scene by APP_TimerExpired.
+ *
+ * @param app
+ */
+static void APP_StartTimer(App_t *app)
+{
+   app->timer_left = app->timer;
+   app->timer_start_time = app->now_us;
+   app_timer_start(&app->timer_expiry, app->now + app->timer,
+                   APP_TimerExpired, app);
+}
+
+/**
+ * @brief Update remaining time of software timer by the core clock, it does
+ * not wrap.
+ *
+ * @param app
+ */
+static void APP_UpdateTimer(App_t *app)
+{
+   if (app->timer != 0) {
+      const uint64_t elapsed =
+          (app->now_us - app->timer_start_time) / 1000U;
+      if (app->timer > elapsed)
+         app->timer_left = app->timer - (uint32_t)elapsed;
+      else
+         app->timer_left = 0;
+   }
+}
+
+/**
+ * @brief Expiry callback of software timer, called from app_timer_run.
+ *
+ * @param timer
+ * @param arg pointer to App_t
+ */
+static void APP_TimerExpired(app_timer_t *timer, void *arg)
+{
+   APP_Dispatch((App_t *)arg, EVENT_TIMER_EXPIRED);
+}
+
+/**
+ * @brief Dispatch the event by the transition table. The next scene look is
+ * set by its descriptor, then the entry action of the scene is called.
+ *
+ * @param app
+ * @param event
+ */
+void APP_Dispatch(App_t *app, Event_t event)
+{
+   const Scene_t next = scene_transitions[app->scene][event];
+   if (next == SCENE_NONE)
+      return;
+
+   app->_delay = 1;
+   app->delay_start = app->now;
+   APP_SceneLook(app, next);
+   scene_desc[next].enter(app);
+}
+
+/**
+ * @brief Set the scene and its look, the entry action is not called.
+ *
+ * @param app
+ * @param scene
+ */
+void APP_SceneLook(App_t *app, Scene_t scene)
+{
+   const Scene_desc_t *desc = &scene_desc[scene];
+
+   app->scene = scene;
+   app->button_left_color = desc->button_left_color;
+   app->button_left_type = desc->button_left_type;
+   app->button_right_color = desc->button_right_color;
+   app->button_right_type = desc->button_right_type;
+   app->status_color = desc->status_color;
+   strncpy(app->status_message, desc->status_message,
+           sizeof(app->status_message) - 1);
+   app->status_message[sizeof(app->status_message) - 1] = '\0';
+   app->status_minutes = UINT32_MAX;
+   app->status_version++;
+}
+
+/**
+ * @brief Format the countdown into the status message, nothing is done if the
+ * minutes are already there.
+ *
+ * @param app
+ * @param minutes
+ */
+void APP_FormatStatus(App_t *app, uint32_t minutes)
+{
+   if (minutes == app->status_minutes)
+      return;
+   app->status_minutes = minutes;
+   app->status_version++;
+
+   /* Trailing spaces clear the longer previous text */
+   char *end = app_format_str(app->status_message, "  Start in ");
+   end = app_format_uint(end, minutes, 1, ' ');
+   end = app_format_str(end, " min                          ");
+   *end = '\0';
+}
+
+/**
+ * @brief Entry action of the front page.
+ *
+ * @param app
+ */
+static void TO_FRONT_SCENE(App_t *app)
+{
+   app->timer = 0;
+   app_timer_cancel(&app->timer_expiry);
+   APP_CancelDelayedStart(app);
+}
+
+/**
+ * @brief Entry action of the manual page.
+ *
+ * @param app
+ */
+static void TO_TURNON_SCENE(App_t *app)
+{
+   APP_CancelDelayedStart(app);
+
+   /* Set up timer */
+   app->timer = 1 * 60 * SECOND; // 1 min
+   APP_StartTimer(app);
+}
+
+/**
+ * @brief Entry action of the config scene.
+ *
+ * @param app
+ */
+static void TO_TIMER_CONFIG_SCENE(App_t *app)
+{
+   app->config_timer =
+       17 * 60 * SECOND + 21 * SECOND; // default 17 min and 21 s
+}
+
+/**
+ * @brief Entry action of the waiting scene. The start is put into the RTC
+ * schedule, so it does not drift and it is kept over reset. The countdown only
+ * shows the progress. If the schedule is full, the countdown starts the heater.
+ *
+ * @param app
+ */
+static void TO_WAITING_SCENE(App_t *app)
+{
+   app->timer = app->config_timer;
+   APP_FormatStatus(app, app->timer / (60 * SECOND));
+
+   app->delayed_start =
+       app_schedule_add(APP_RtcNow() + app->config_timer / SECOND, 0);
+   if (app->delayed_start == 0) {
+      APP_StartTimer(app);
+      return;
+   }
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+
+   app->timer_left = app->timer;
+   app->timer_start_time = app->now_us;
+}
+
+/**
+ * @brief Remove the delayed start of the waiting scene from the schedule.
+ *
+ * @param app
+ */
+void APP_CancelDelayedStart(App_t *app)
+{
+   if (app->delayed_start == 0)
+      return;
+   app_schedule_remove(app->delayed_start);
+   app->delayed_start = 0;
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+}
+
+/**
+ * @brief One step of the scene logic. It depends only on the inputs and on
+ * app->now, so the recorded steps can be replayed.
+ *
+ * @param app
+ * @param input APP_RECORD_* fields
+ * @param TS_State touch read in this step
+ */
+void APP_Step(App_t *app, uint32_t input, TS_State_t *TS_State)
+{
+   if (input & APP_RECORD_SAMPLED)
+      APP_HandleTouch(TS_State, app);
+
+   /* Expire timers && Update timer */
+   if (input & APP_EVENT_TIMER) {
+      app_timer_run(app->now);
+      APP_UpdateTimer(app);
+   }
+
+   for (uint32_t alarms =
+            (input >> APP_RECORD_ALARMS_Pos) & APP_RECORD_ALARMS_Msk;
+        alarms > 0; alarms--)
+      APP_Dispatch(app, EVENT_SCHEDULED_START);
+}
+
+/**
+ * @brief Store the state of the scene logic.
+ *
+ * @param app
+ * @param keyframe
+ */
+void APP_KeyframeSave(App_t *app, App_keyframe_t *keyframe)
+{
+   keyframe->app = *app;
+   keyframe->timer_active = app_timer_active(&app->timer_expiry);
+   keyframe->timer_expires = app->timer_expiry.expires;
+   keyframe->schedule_count = app_schedule_save(keyframe->schedule);
+}
+
+/**
+ * @brief Restore the state of the scene logic, the timer wheel and the
+ * schedule are set up again.
+ *
+ * @param app
+ * @param keyframe
+ */
+void APP_KeyframeRestore(App_t *app, const App_keyframe_t *keyframe)
+{
+   *app = keyframe->app;
+   memset(&app->timer_expiry, 0, sizeof(app->timer_expiry));
+   app_timer_init(app->now);
+   if (keyframe->timer_active)
+      app_timer_start(&app->timer_expiry, keyframe->timer_expires,
+                      APP_TimerExpired, app);
+   app_schedule_load(keyframe->schedule, keyframe->schedule_count, 0);
+}
+
+/**
+ * @brief Do the step and record its inputs and the heater state after it.
+ * Steps without any input of the scene logic are not recorded.
+ *
+ * @param app
+ * @param input APP_RECORD_* fields
+ * @param TS_State touch read in this step
+ */
+void APP_RecordStep(App_t *app, uint32_t input, TS_State_t *TS_State)
+{
+   static App_keyframe_t keyframe;
+
+   if ((input & (APP_RECORD_SAMPLED | APP_EVENT_TIMER |
+                 APP_RECORD_ALARMS_Msk << APP_RECORD_ALARMS_Pos)) == 0) {
+      APP_Step(app, input, TS_State);
+      return;
+   }
+   APP_KeyframeSave(app, &keyframe);
+   app_record_put(app->now_us, input, &keyframe, sizeof(keyframe));
+   APP_Step(app, input, TS_State);
+   APP_KeyframeSave(app, &keyframe);
+   app_record_output(app->scene == TURNON_SCENE ? APP_RECORD_HEATER : 0,
+                     &keyframe, sizeof(keyframe));
+}
+
+/**
+ * @brief One of three main logic function thats handle touch screen.
+ *
+ * @param TS_State
+ * @param app
+ */
+void APP_HandleTouch(TS_State_t *TS_State, App_t *app)
+{
+   /* A held touch is read again every TOUCH_POLL, only the press counts */
+   const uint8_t pressed = TS_State->TouchDetected != 0U && !app->touch_held;
+   app->touch_held = TS_State->TouchDetected != 0U;
+
+   /* Ignore repeated taps right after scene transition */
+   if (APP_InputLocked(app, app->now))
+      return;
+
+   if (pressed) {
+
+      /* Handle config timer time */
+      if (app->scene == TIMER_CONFIG_SCENE) {
+         if (APP_HandleTouch_IsInInterval(TS_State, 450, 250, 300, 80))
+            app->config_timer += SECOND;
+         else if (APP_HandleTouch_IsInInterval(TS_State, 210, 20, 300, 80))
+            app->config_timer -= SECOND;
+      }
+
+      if (APP_HandleTouch_IsInInterval(TS_State, 320, 160, 283, 125))
+         /* Detect left button push */
+         APP_Dispatch(app, EVENT_LEFT_BUTTON);
+      else if (APP_HandleTouch_IsInInterval(TS_State, 320, 160, 670, 539))
+         /* Detect right button push */
+         APP_Dispatch(app, EVENT_RIGHT_BUTTON);
+   }
+}
@@ -0,0 +1,371 @@
+/*
+ * app_schedule.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_schedule.h"
+#include <stddef.h>
+
+/* 2000-01-01 was Saturday, days since the Monday before it */
+#define EPOCH_WEEKDAY_OFFSET (5UL)
+
+typedef struct {
+   app_schedule_entry_t heap[APP_SCHEDULE_SIZE];
+   unsigned int count;
+   uint16_t last_id;
+} schedule_t;
+
+static schedule_t schedule;
+
+/* Days before the month in a common year */
+static const uint16_t month_days[13] = {0,   31,  59,  90,  120, 151, 181,
+                                        212, 243, 273, 304, 334, 365};
+
+/**
+ * @brief Compare fire times of two heap items
+ * @param a
+ * @param b
+ * @return 1 if a fires before b
+ */
+static inline int schedule_before(const unsigned int a, const unsigned int b)
+{
+   return schedule.heap[a].fire < schedule.heap[b].fire;
+}
+
+/**
+ * @brief Swap two heap items
+ * @param a
+ * @param b
+ */
+static void schedule_swap(const unsigned int a, const unsigned int b)
+{
+   const app_schedule_entry_t tmp = schedule.heap[a];
+   schedule.heap[a] = schedule.heap[b];
+   schedule.heap[b] = tmp;
+}
+
+/**
+ * @brief Move the item up while it fires before its parent
+ * @param i
+ */
+static void schedule_up(unsigned int i)
+{
+   while (i > 0) {
+      const unsigned int parent = (i - 1U) / 2U;
+      if (!schedule_before(i, parent)) {
+         break;
+      }
+      schedule_swap(i, parent);
+      i = parent;
+   }
+}
+
+/**
+ * @brief Move the item down while any child fires before it
+ * @param i
+ */
+static void schedule_down(unsigned int i)
+{
+   for (;;) {
+      const unsigned int left = 2U * i + 1U;
+      const unsigned int right = left + 1U;
+      unsigned int first = i;
+
+      if (left < schedule.count && schedule_before(left, first)) {
+         first = left;
+      }
+      if (right < schedule.count && schedule_before(right, first)) {
+         first = right;
+      }
+      if (first == i) {
+         break;
+      }
+      schedule_swap(i, first);
+      i = first;
+   }
+}
+
+/**
+ * @brief Remove the heap item
+ * @param i
+ */
+static void schedule_remove_at(const unsigned int i)
+{
+   schedule.count--;
+   if (i == schedule.count) {
+      return;
+   }
+   schedule.heap[i] = schedule.heap[schedule.count];
+   schedule_up(i);
+   schedule_down(i);
+}
+
+/**
+ * @brief Insert entry into the heap, the id is kept
+ * @param entry
+ * @return 0 on success, -1 if the schedule is full
+ */
+static int schedule_insert(const app_schedule_entry_t *const entry)
+{
+   if (schedule.count == APP_SCHEDULE_SIZE) {
+      return -1;
+   }
+   schedule.heap[schedule.count] = *entry;
+   schedule_up(schedule.count++);
+   return 0;
+}
+
+/**
+ * @brief Drop all entries
+ */
+void app_schedule_init(void)
+{
+   schedule.count = 0;
+   schedule.last_id = 0;
+}
+
+/**
+ * @brief Add an entry
+ * @param fire fire time
+ * @param weekly 1 entry repeats every week
+ * @return id of the entry, 0 if the schedule is full
+ */
+uint16_t app_schedule_add(const uint32_t fire, const uint16_t weekly)
+{
+   app_schedule_entry_t entry = {.fire = fire, .weekly = weekly};
+
+   /* Next free id, 0 is reserved for no entry */
+   do {
+      entry.id = ++schedule.last_id;
+      for (unsigned int i = 0; i < schedule.count; i++) {
+         if (schedule.heap[i].id == entry.id) {
+            entry.id = 0;
+            break;
+         }
+      }
+   } while (entry.id == 0);
+
+   if (schedule_insert(&entry) < 0) {
+      return 0;
+   }
+   return entry.id;
+}
+
+/**
+ * @brief Add an entry repeated every week on the day at the time
+ * @param now current time
+ * @param weekday APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ * @param hours
+ * @param minutes
+ * @return id of the entry, 0 if the schedule is full
+ */
+uint16_t app_schedule_add_weekly(const uint32_t now, const uint8_t weekday,
+                                 const uint8_t hours, const uint8_t minutes)
+{
+   /* Both from Monday 00:00 of the current week, which is before the epoch
+      in the first days of 2000, a fresh RTC starts there */
+   const uint32_t since_monday =
+       (now + EPOCH_WEEKDAY_OFFSET * APP_SCHEDULE_DAY) % APP_SCHEDULE_WEEK;
+   const uint32_t day = (uint32_t)(weekday - APP_SCHEDULE_MONDAY);
+   const uint32_t at =
+       day * APP_SCHEDULE_DAY + hours * 3600UL + minutes * 60UL;
+   uint32_t ahead = (at + APP_SCHEDULE_WEEK - since_monday) % APP_SCHEDULE_WEEK;
+
+   if (ahead == 0) {
+      ahead = APP_SCHEDULE_WEEK;
+   }
+   return app_schedule_add(now + ahead, 1);
+}
+
+/**
+ * @brief Remove the entry
+ * @param id
+ * @return 0 on success, -1 if there is no such entry
+ */
+int app_schedule_remove(const uint16_t id)
+{
+   for (unsigned int i = 0; i < schedule.count; i++) {
+      if (schedule.heap[i].id == id) {
+         schedule_remove_at(i);
+         return 0;
+      }
+   }
+   return -1;
+}
+
+/**
+ * @brief Get the entry to fire first
+ * @param entry
+ * @return 0 on success, -1 if the schedule is empty
+ */
+int app_schedule_peek(app_schedule_entry_t *const entry)
+{
+   if (schedule.count == 0) {
+      return -1;
+   }
+   *entry = schedule.heap[0];
+   return 0;
+}
+
+/**
+ * @brief Take the first entry if its time has come, a weekly entry is put back
+ *        to its next week. Call it until it returns -1.
+ * @param now current time
+ * @param entry
+ * @return 0 on success, -1 if there is no entry to fire
+ */
+int app_schedule_pop(const uint32_t now, app_schedule_entry_t *const entry)
+{
+   if (schedule.count == 0 || schedule.heap[0].fire > now) {
+      return -1;
+   }
+   *entry = schedule.heap[0];
+
+   if (entry->weekly) {
+      /* Skip weeks, which were missed altogether */
+      do {
+         schedule.heap[0].fire += APP_SCHEDULE_WEEK;
+      } while (schedule.heap[0].fire <= now);
+      schedule_down(0);
+   } else {
+      schedule_remove_at(0);
+   }
+   return 0;
+}
+
+/**
+ * @brief Copy all entries, e.g. to keep them over reset
+ * @param entries array of APP_SCHEDULE_SIZE entries
+ * @return count of entries
+ */
+unsigned int app_schedule_save(app_schedule_entry_t *const entries)
+{
+   for (unsigned int i = 0; i < schedule.count; i++) {
+      entries[i] = schedule.heap[i];
+   }
+   return schedule.count;
+}
+
+/**
+ * @brief Restore saved entries. Weekly entries missed in the meantime are
+ *        moved to their next week, missed one shot entries are dropped.
+ * @param entries
+ * @param count
+ * @param now current time
+ */
+void app_schedule_load(const app_schedule_entry_t *const entries,
+                       const unsigned int count, const uint32_t now)
+{
+   app_schedule_init();
+
+   for (unsigned int i = 0; i < count; i++) {
+      app_schedule_entry_t entry = entries[i];
+      if (entry.id == 0) {
+         continue;
+      }
+      if (entry.fire <= now) {
+         if (!entry.weekly) {
+            continue;
+         }
+         entry.fire += ((now - entry.fire) / APP_SCHEDULE_WEEK + 1U) *
+                       APP_SCHEDULE_WEEK;
+      }
+      if (schedule_insert(&entry) < 0) {
+         break;
+      }
+      if (entry.id > schedule.last_id) {
+         schedule.last_id = entry.id;
+      }
+   }
+}
+
+/**
+ * @brief Convert calendar to time
+ * @param year 0 .. 99, years since 2000
+ * @param month 1 .. 12
+ * @param day 1 .. 31
+ * @param hours
+ * @param minutes
+ * @param seconds
+ * @return uint32_t time
+ */
+uint32_t app_schedule_time(const uint8_t year, const uint8_t month,
+                           const uint8_t day, const uint8_t hours,
+                           const uint8_t minutes, const uint8_t seconds)
+{
+   /* Every 4th year is leap in 2000 .. 2099, 2000 itself included */
+   uint32_t days = year * 365UL + (year + 3UL) / 4UL;
+   days += month_days[month - 1U] + day - 1U;
+   if (month > 2U && (year % 4U) == 0) {
+      days++;
+   }
+   return days * APP_SCHEDULE_DAY + hours * 3600UL + minutes * 60UL + seconds;
+}
+
+/**
+ * @brief Convert time to calendar date, the time of the day is the rest of
+ *        APP_SCHEDULE_DAY
+ * @param time
+ * @param year 0 .. 99, years since 2000
+ * @param month 1 .. 12
+ * @param day 1 .. 31
+ */
+void app_schedule_date(const uint32_t time, uint8_t *const year,
+                       uint8_t *const month, uint8_t *const day)
+{
+   uint32_t days = time / APP_SCHEDULE_DAY;
+   /* Whole 4 year cycles of 1461 days, each starts by a leap year */
+   uint32_t years = days / 1461UL * 4UL;
+   unsigned int m = 1;
+
+   days %= 1461UL;
+   if (days >= 366UL) {
+      years += 1UL + (days - 366UL) / 365UL;
+      days = (days - 366UL) % 365UL;
+   }
+   const uint32_t leap = (years % 4UL) == 0 ? 1UL : 0UL;
+   while (m < 12U && days >= month_days[m] + (m >= 2U ? leap : 0UL)) {
+      m++;
+   }
+   days -= month_days[m - 1U] + (m > 2U ? leap : 0UL);
+
+   *year = (uint8_t)years;
+   *month = (uint8_t)m;
+   *day = (uint8_t)(days + 1UL);
+}
+
+/**
+ * @brief Get the day of the week of the time
+ * @param time
+ * @return APP_SCHEDULE_MONDAY .. APP_SCHEDULE_SUNDAY
+ */
+uint8_t app_schedule_weekday(const uint32_t time)
+{
+   return (uint8_t)(APP_SCHEDULE_MONDAY +
+                    (time / APP_SCHEDULE_DAY + EPOCH_WEEKDAY_OFFSET) % 7U);
+}
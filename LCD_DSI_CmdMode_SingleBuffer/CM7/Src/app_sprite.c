@@ -0,0 +1,186 @@
+/*
+ * app_sprite.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_sprite.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Allocations take whole D-cache lines */
+#define SPRITE_ALIGN (32U)
+
+typedef struct {
+   uint64_t key;
+   uint32_t offset; /* in the pool */
+   uint32_t size;   /* bytes, 0 if the slot is free */
+   uint16_t width;
+   uint16_t height;
+   uint32_t used; /* use time, for LRU */
+} sprite_t;
+
+static sprite_t sprites[APP_SPRITE_MAX];
+static uint8_t *pool_base;
+static uint32_t pool_size;
+static uint32_t use_clock;
+static app_sprite_stats_t stats;
+
+/**
+ * @brief Find offset of the first gap of the size between the sprites
+ * @return uint32_t offset, pool_size if there is no gap
+ */
+static uint32_t sprite_fit(const uint32_t size)
+{
+   uint32_t start = 0;
+
+   /* Sprites are visited by offset, the cache is small */
+   for (;;) {
+      const sprite_t *next = NULL;
+      for (uint32_t i = 0; i < APP_SPRITE_MAX; i++) {
+         const sprite_t *const s = &sprites[i];
+         if (s->size != 0 && s->offset >= start &&
+             (next == NULL || s->offset < next->offset))
+            next = s;
+      }
+      const uint32_t end = next != NULL ? next->offset : pool_size;
+      if (end - start >= size)
+         return start;
+      if (next == NULL)
+         return pool_size;
+      start = next->offset + next->size;
+   }
+}
+
+/**
+ * @brief Get a free slot
+ * @return sprite_t* NULL if all slots are used
+ */
+static sprite_t *sprite_free_slot(void)
+{
+   for (uint32_t i = 0; i < APP_SPRITE_MAX; i++)
+      if (sprites[i].size == 0)
+         return &sprites[i];
+   return NULL;
+}
+
+/**
+ * @brief Drop the least recently used sprite
+ * @return uint32_t 0 if the cache is empty
+ */
+static uint32_t sprite_evict(void)
+{
+   sprite_t *lru = NULL;
+
+   for (uint32_t i = 0; i < APP_SPRITE_MAX; i++) {
+      sprite_t *const s = &sprites[i];
+      if (s->size != 0 && (lru == NULL || use_clock - s->used >
+                                              use_clock - lru->used))
+         lru = s;
+   }
+   if (lru == NULL)
+      return 0;
+   stats.used -= lru->size;
+   stats.evictions++;
+   lru->size = 0;
+   return 1;
+}
+
+/**
+ * @brief Drop all sprites and set the pool
+ */
+void app_sprite_init(void *const pool, const uint32_t size)
+{
+   memset(sprites, 0, sizeof(sprites));
+   pool_base = pool;
+   pool_size = size;
+   stats.used = 0;
+}
+
+/**
+ * @brief Add data to the key, FNV-1a
+ */
+uint64_t app_sprite_hash(uint64_t hash, const void *const data,
+                         const uint32_t size)
+{
+   const uint8_t *const bytes = data;
+
+   for (uint32_t i = 0; i < size; i++) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+/**
+ * @brief Find the sprite, allocate it on a miss
+ */
+uint32_t *app_sprite_get(const uint64_t key, const uint32_t width,
+                         const uint32_t height, uint32_t *const created)
+{
+   const uint32_t size =
+       (4U * width * height + SPRITE_ALIGN - 1U) & ~(SPRITE_ALIGN - 1U);
+   sprite_t *slot;
+   uint32_t offset;
+
+   *created = 0;
+   use_clock++;
+   for (uint32_t i = 0; i < APP_SPRITE_MAX; i++) {
+      sprite_t *const s = &sprites[i];
+      if (s->size != 0 && s->key == key && s->width == width &&
+          s->height == height) {
+         s->used = use_clock;
+         stats.hits++;
+         return (uint32_t *)(pool_base + s->offset);
+      }
+   }
+
+   if (size == 0 || size > pool_size) {
+      stats.too_big++;
+      return NULL;
+   }
+   /* Evict until a slot and a gap are free, the empty pool fits */
+   while ((slot = sprite_free_slot()) == NULL ||
+          (offset = sprite_fit(size)) == pool_size)
+      sprite_evict();
+
+   slot->key = key;
+   slot->offset = offset;
+   slot->size = size;
+   slot->width = (uint16_t)width;
+   slot->height = (uint16_t)height;
+   slot->used = use_clock;
+   stats.used += size;
+   stats.misses++;
+   *created = 1;
+   return (uint32_t *)(pool_base + offset);
+}
+
+/**
+ * @brief Get statistics of the cache
+ */
+const app_sprite_stats_t *app_sprite_stats(void) { return &stats; }
@@ -0,0 +1,375 @@
+/*
+ * app_timer.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_timer.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define SLOT_MASK (APP_TIMER_SLOTS - 1U)
+
+typedef struct {
+   uint32_t now; /* next tick to process */
+   uint64_t used[APP_TIMER_LEVELS]; /* bitmap of non empty slots */
+   app_timer_t *slot[APP_TIMER_LEVELS][APP_TIMER_SLOTS];
+} wheel_t;
+
+static wheel_t wheel;
+
+/**
+ * @brief Shift of the level, ticks of one slot are 1 << shift
+ * @param level
+ * @return unsigned int
+ */
+static inline unsigned int wheel_shift(const unsigned int level)
+{
+   return level * APP_TIMER_BITS;
+}
+
+/**
+ * @brief Link the timer into the wheel. The level is the lowest one, where the
+ *        expiry is in one of the next slots, never in the current slot, so
+ *        the timer is moved down right at the start of its slot.
+ * @param timer
+ */
+static void wheel_add(app_timer_t *const timer)
+{
+   uint32_t expires = timer->expires;
+   unsigned int level;
+   unsigned int index;
+
+   if ((int32_t)(expires - wheel.now) < 0) {
+      expires = wheel.now;
+   }
+
+   for (level = 0; level < APP_TIMER_LEVELS; level++) {
+      const unsigned int shift = wheel_shift(level);
+      const uint32_t diff =
+          ((expires >> shift) - (wheel.now >> shift)) & (UINT32_MAX >> shift);
+      if (diff < APP_TIMER_SLOTS) {
+         index = (expires >> shift) & SLOT_MASK;
+         break;
+      }
+   }
+   if (level == APP_TIMER_LEVELS) {
+      /* Out of range, wait in the farthest slot and go around again */
+      level = APP_TIMER_LEVELS - 1U;
+      index = ((wheel.now >> wheel_shift(level)) - 1U) & SLOT_MASK;
+   }
+
+   app_timer_t **const head = &wheel.slot[level][index];
+   timer->next = *head;
+   if (timer->next != NULL) {
+      timer->next->pprev = &timer->next;
+   }
+   timer->pprev = head;
+   *head = timer;
+   wheel.used[level] |= (uint64_t)1 << index;
+}
+
+/**
+ * @brief Unlink the timer from the wheel, the slot bitmap is not updated
+ * @param timer
+ */
+static void wheel_unlink(app_timer_t *const timer)
+{
+   *timer->pprev = timer->next;
+   if (timer->next != NULL) {
+      timer->next->pprev = timer->pprev;
+   }
+   timer->next = NULL;
+   timer->pprev = NULL;
+}
+
+/**
+ * @brief Detach all timers of the slot into the work list
+ * @param level
+ * @param index
+ * @param work head of the work list
+ */
+static void wheel_take(const unsigned int level, const unsigned int index,
+                       app_timer_t **const work)
+{
+   *work = wheel.slot[level][index];
+   wheel.slot[level][index] = NULL;
+   wheel.used[level] &= ~((uint64_t)1 << index);
+   if (*work != NULL) {
+      (*work)->pprev = work;
+   }
+}
+
+/**
+ * @brief Move timers of the current slot of the level one level down
+ * @param level
+ * @return index of the current slot
+ */
+static unsigned int wheel_cascade(const unsigned int level)
+{
+   const unsigned int index = (wheel.now >> wheel_shift(level)) & SLOT_MASK;
+   app_timer_t *work;
+   app_timer_t *timer;
+
+   wheel_take(level, index, &work);
+   while ((timer = work) != NULL) {
+      wheel_unlink(timer);
+      wheel_add(timer);
+   }
+   return index;
+}
+
+/**
+ * @brief Process the tick wheel.now, callbacks may start or cancel any timer
+ */
+static void wheel_step(void)
+{
+   app_timer_t *work;
+   app_timer_t *timer;
+
+   /* At the start of a slot of the level move its timers down */
+   for (unsigned int level = 1; level < APP_TIMER_LEVELS; level++) {
+      if ((wheel.now & ((1UL << wheel_shift(level)) - 1U)) != 0 ||
+          wheel_cascade(level) != 0) {
+         break;
+      }
+   }
+
+   wheel_take(0, wheel.now & SLOT_MASK, &work);
+   wheel.now++;
+   while ((timer = work) != NULL) {
+      wheel_unlink(timer);
+      timer->callback(timer, timer->arg);
+   }
+}
+
+/**
+ * @brief Reset the wheel, all timers are dropped
+ * @param now current tick in ms
+ */
+void app_timer_init(const uint32_t now)
+{
+   for (unsigned int level = 0; level < APP_TIMER_LEVELS; level++) {
+      for (unsigned int index = 0; index < APP_TIMER_SLOTS; index++) {
+         wheel.slot[level][index] = NULL;
+      }
+      wheel.used[level] = 0;
+   }
+   wheel.now = now;
+}
+
+/**
+ * @brief Start the timer, an active timer is restarted. Expiry in the past
+ *        fires on the next app_timer_run.
+ * @param timer
+ * @param expires tick of expiry in ms
+ * @param callback called from app_timer_run, the timer may be started again
+ * @param arg passed to the callback
+ */
+void app_timer_start(app_timer_t *const timer, const uint32_t expires,
+                     const app_timer_cb_t callback, void *const arg)
+{
+   app_timer_cancel(timer);
+   timer->expires = expires;
+   timer->callback = callback;
+   timer->arg = arg;
+   wheel_add(timer);
+}
+
+/**
+ * @brief Stop the timer, nothing happens if it is not active
+ * @param timer
+ */
+void app_timer_cancel(app_timer_t *const timer)
+{
+   if (timer->pprev == NULL) {
+      return;
+   }
+
+   /* The only timer linked directly from the slot, the slot gets empty */
+   const uintptr_t at = (uintptr_t)timer->pprev;
+   const uintptr_t first = (uintptr_t)&wheel.slot[0][0];
+   if (timer->next == NULL && at >= first && at < first + sizeof(wheel.slot)) {
+      const uint32_t slot = (uint32_t)((at - first) / sizeof(app_timer_t *));
+      wheel.used[slot / APP_TIMER_SLOTS] &=
+          ~((uint64_t)1 << (slot % APP_TIMER_SLOTS));
+   }
+   wheel_unlink(timer);
+}
+
+/**
+ * @brief Check whether the timer waits for expiry
+ * @param timer
+ * @return 1 if active
+ */
+int app_timer_active(const app_timer_t *const timer)
+{
+   return timer->pprev != NULL;
+}
+
+/**
+ * @brief Get the next tick when app_timer_run has some work, it is an expiry
+ *        or a move of timers to lower level
+ * @param next tick in ms
+ * @return 0 on success, -1 if there is no active timer
+ */
+int app_timer_next(uint32_t *const next)
+{
+   int found = -1;
+   uint32_t best = 0;
+
+   for (unsigned int level = 0; level < APP_TIMER_LEVELS; level++) {
+      if (wheel.used[level] == 0) {
+         continue;
+      }
+      const unsigned int shift = wheel_shift(level);
+      const unsigned int current = (wheel.now >> shift) & SLOT_MASK;
+      /* Rotate the bitmap, so bit 0 is the current slot */
+      const uint64_t used =
+          current == 0 ? wheel.used[level]
+                       : (wheel.used[level] >> current) |
+                             (wheel.used[level] << (APP_TIMER_SLOTS - current));
+      const uint32_t slots = (uint32_t)__builtin_ctzll(used);
+      /* Level 0 slot is a tick, higher level slot starts at its first tick */
+      const uint32_t tick =
+          level == 0 ? wheel.now + slots
+                     : ((wheel.now >> shift) + slots) << shift;
+      if (found < 0 || (int32_t)(tick - best) < 0) {
+         best = tick;
+         found = 0;
+      }
+   }
+   if (found == 0) {
+      *next = best;
+   }
+   return found;
+}
+
+/**
+ * @brief Advance the wheel up to now and call callbacks of expired timers.
+ *        Ticks without any work are skipped.
+ * @param now current tick in ms
+ */
+void app_timer_run(const uint32_t now)
+{
+   uint32_t next;
+
+   while ((int32_t)(now - wheel.now) >= 0) {
+      if (app_timer_next(&next) < 0 || (int32_t)(next - now) > 0) {
+         wheel.now = now + 1U;
+         break;
+      }
+      if ((int32_t)(next - wheel.now) > 0) {
+         wheel.now = next;
+      }
+      wheel_step();
+   }
+}
+
+#ifdef APP_TIMER_BENCH
+
+#include "core_clock.h"
+
+static app_timer_bench_t bench;
+static uint32_t bench_seed = 1;
+
+/**
+ * @brief Pseudo random timeout, mostly short ones with some hours long
+ * @return uint32_t ms
+ */
+static uint32_t bench_timeout(void)
+{
+   bench_seed = bench_seed * 1664525U + 1013904223U;
+   const uint32_t r = bench_seed >> 8;
+   return (r & 3U) != 0 ? 1U + (r >> 2) % 2000U : 1U + (r >> 2) % 3600000U;
+}
+
+/**
+ * @brief Restart the timer on expiry, so the count of active timers is kept
+ * @param timer
+ * @param arg
+ */
+static void bench_expired(app_timer_t *const timer, void *const arg)
+{
+   bench.expired++;
+   app_timer_start(timer, timer->expires + bench_timeout(), bench_expired,
+                   arg);
+}
+
+/**
+ * @brief Measure the wheel with timers restarted on expiry. Costs are
+ *        averaged over the whole loops, since one operation is shorter than
+ *        the microsecond of the clock. The wheel is reset afterwards.
+ * @param timers storage of the timers, owned by the caller
+ * @param count of the timers
+ */
+void app_timer_bench_run(app_timer_t *const timers, const uint32_t count)
+{
+   uint64_t start;
+
+   bench.done = 0;
+   bench.expired = 0;
+   bench.tick_max_us = 0;
+   app_timer_init(0);
+
+   start = core_clock_us();
+   for (uint32_t i = 0; i < count; i++) {
+      timers[i].pprev = NULL;
+      app_timer_start(&timers[i], bench_timeout(), bench_expired, NULL);
+   }
+   bench.start_ns = (uint32_t)((core_clock_us() - start) * 1000U / count);
+   bench.timers = count;
+
+   uint64_t sum = 0;
+   for (uint32_t now = 0; now < APP_TIMER_BENCH_TICKS; now++) {
+      start = core_clock_us();
+      app_timer_run(now);
+      const uint32_t us = (uint32_t)(core_clock_us() - start);
+      sum += us;
+      if (us > bench.tick_max_us) {
+         bench.tick_max_us = us;
+      }
+   }
+   bench.tick_ns = (uint32_t)(sum * 1000U / APP_TIMER_BENCH_TICKS);
+
+   start = core_clock_us();
+   for (uint32_t i = 0; i < count; i++) {
+      app_timer_cancel(&timers[i]);
+   }
+   bench.cancel_ns = (uint32_t)((core_clock_us() - start) * 1000U / count);
+
+   app_timer_init((uint32_t)core_clock_ms());
+   bench.done = 1;
+}
+
+/**
+ * @brief Get results of the benchmark
+ * @return const app_timer_bench_t*
+ */
+const app_timer_bench_t *app_timer_bench_results(void) { return &bench; }
+
+#endif /* APP_TIMER_BENCH */
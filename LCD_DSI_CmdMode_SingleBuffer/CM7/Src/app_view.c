@@ -0,0 +1,445 @@
+/*
+ * app_view.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "app_view.h"
+#include "main.h"
+
+/* Retained widgets of the scene, drawn in this order */
+typedef enum {
+   WIDGET_CAPTIONS,
+   WIDGET_RIGHT_BUTTON,
+   WIDGET_LEFT_BUTTON,
+   WIDGET_TIMER_DIAL, /* inside of the left button */
+   WIDGET_TITLE,
+   WIDGET_STATUS,
+   WIDGET_HEATER,
+   WIDGET_PROGRESS,
+   WIDGET_COUNT
+} Widget_t;
+
+/* Widget is drawn only when its key, the part of App_t it shows, changes */
+typedef struct {
+   uint64_t (*key)(const App_t *app);
+   void (*draw)(App_t *app);
+} Widget_desc_t;
+
+/* Keys of the widgets in the frame buffer */
+#define WIDGET_INVALID UINT64_MAX
+static uint64_t widget_drawn[WIDGET_COUNT];
+/* Drawing waits for the end of the refresh */
+static uint8_t render_deferred = 0;
+#ifdef APP_RENDER_STATS
+static App_render_stats_t render_stats;
+#endif
+
+/* Display functions */
+static void LCD_Display_SetStatus(char *ptr);
+static void LCD_Display_ProgressBar(uint16_t progress, uint32_t color);
+static void LCD_Display_SetTitle(char *ptr);
+static void LCD_Display_Button(uint32_t Xpos, uint32_t color);
+static void LCD_Display_LeftButton(App_t *app);
+static void LCD_Display_RightButton(App_t *app);
+static void LCD_Display_ButtonTitles(App_t *app);
+static void LCD_Display_TimerButton(App_t *app);
+static void LCD_Display_TimerDial(App_t *app);
+static void LCD_Display_Title(App_t *app);
+static void LCD_Display_Status(App_t *app);
+static void LCD_Display_Heater(App_t *app);
+static void LCD_Display_Progress(App_t *app);
+
+/* Keys of the widgets */
+static uint64_t WIDGET_KeyCaptions(const App_t *app) { return app->scene; }
+
+static uint64_t WIDGET_KeyRightButton(const App_t *app)
+{
+   return (uint64_t)app->button_right_type << 32 | app->button_right_color;
+}
+
+static uint64_t WIDGET_KeyLeftButton(const App_t *app)
+{
+   return (uint64_t)app->button_left_type << 32 |
+          (app->button_left_type == PUSH_BUTTON ? app->button_left_color : 0);
+}
+
+static uint64_t WIDGET_KeyTimerDial(const App_t *app)
+{
+   return (uint64_t)app->button_left_type << 32 |
+          (app->button_left_type == TIMER_BUTTON ? app->config_timer : 0);
+}
+
+/* The title does not change */
+static uint64_t WIDGET_KeyTitle(const App_t *app)
+{
+   (void)app;
+   return 0;
+}
+
+static uint64_t WIDGET_KeyStatus(const App_t *app)
+{
+   return app->status_version;
+}
+
+static uint64_t WIDGET_KeyHeater(const App_t *app)
+{
+   return (uint64_t)app->heater.faults << 32 |
+          (uint32_t)app->heater_lost << 2 |
+          (uint32_t)app->heater_confirmed << 1 | (app->heater.heater != 0);
+}
+
+static uint64_t WIDGET_KeyProgress(const App_t *app)
+{
+   return (uint64_t)app->progress_bar << 32 | app->status_color;
+}
+
+/* Widget descriptors, indexed by Widget_t */
+static const Widget_desc_t widget_desc[WIDGET_COUNT] = {
+    [WIDGET_CAPTIONS] = {WIDGET_KeyCaptions, LCD_Display_ButtonTitles},
+    [WIDGET_RIGHT_BUTTON] = {WIDGET_KeyRightButton, LCD_Display_RightButton},
+    [WIDGET_LEFT_BUTTON] = {WIDGET_KeyLeftButton, LCD_Display_LeftButton},
+    [WIDGET_TIMER_DIAL] = {WIDGET_KeyTimerDial, LCD_Display_TimerDial},
+    [WIDGET_TITLE] = {WIDGET_KeyTitle, LCD_Display_Title},
+    [WIDGET_STATUS] = {WIDGET_KeyStatus, LCD_Display_Status},
+    [WIDGET_HEATER] = {WIDGET_KeyHeater, LCD_Display_Heater},
+    [WIDGET_PROGRESS] = {WIDGET_KeyProgress, LCD_Display_Progress},
+};
+
+/**
+ * @brief Setup status message above the progress bar.
+ *
+ * @param ptr pointer to array of chars
+ */
+static void LCD_Display_SetStatus(char *ptr)
+{
+   LCD_SetFont(&Font16);
+   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
+   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
+   LCD_DisplayStringAtLine(26, ptr);
+}
+
+/**
+ * @brief Setup title and header background, the header is cached as a sprite.
+ *
+ * @param ptr pointer to array of chars
+ */
+static void LCD_Display_SetTitle(char *ptr)
+{
+   const uint64_t key =
+       LCD_TextKey(ptr, &FontAvenirNext20, APP_COLOR_TEXT, APP_COLOR_STONE);
+
+   if (LCD_BeginSprite(key, 0, 0, 800, 75)) {
+      UTIL_LCD_FillRect(0, 0, 800, 75, APP_COLOR_STONE);
+      LCD_SetFont(&FontAvenirNext20);
+      UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
+      UTIL_LCD_SetBackColor(APP_COLOR_STONE);
+      LCD_DisplayStringAtLine(1, (uint8_t *)ptr);
+      // UTIL_LCD_FillRect(170, 80, 460, 1, APP_COLOR_TEXT);
+      LCD_EndSprite();
+   }
+}
+
+/**
+ * @brief Render the title widget.
+ *
+ * @param app
+ */
+static void LCD_Display_Title(App_t *app) { LCD_Display_SetTitle(app->title); }
+
+/**
+ * @brief Render the status widget.
+ *
+ * @param app
+ */
+static void LCD_Display_Status(App_t *app)
+{
+   LCD_Display_SetStatus(app->status_message);
+}
+
+/**
+ * @brief Render the heater widget, the state and the faults reported by M4,
+ * on the line above the status. A request M4 has not confirmed yet is shown,
+ * a request given up as well. The line is padded, so a shorter text
+ * overwrites a longer one.
+ *
+ * @param app
+ */
+static void LCD_Display_Heater(App_t *app)
+{
+   char buf[72 + 1]; /* whole line of Font16, the longest text fits */
+   char *end = app_format_str(buf, app->heater.heater ? "  Heater on"
+                                                      : "  Heater off");
+   const uint8_t fault =
+       app->heater_lost || (app->heater.faults & CORE_FAULT_OVERHEAT);
+
+   if (app->heater_lost)
+      end = app_format_str(end, ", M4 does not respond");
+   else if (!app->heater_confirmed)
+      end = app_format_str(end, ", waiting for M4");
+   if (app->heater.faults & CORE_FAULT_OVERHEAT)
+      end = app_format_str(end, ", overheated");
+   if (app->heater.faults & CORE_FAULT_SENSOR)
+      end = app_format_str(end, ", no temperature sensor");
+   while (end < &buf[sizeof(buf) - 1])
+      *end++ = ' ';
+   *end = '\0';
+
+   LCD_SetFont(&Font16);
+   UTIL_LCD_SetTextColor(fault ? APP_COLOR_RED : APP_COLOR_TEXT);
+   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
+   LCD_DisplayStringAtLine(24, (uint8_t *)buf);
+}
+
+/**
+ * @brief Render the progress widget.
+ *
+ * @param app
+ */
+static void LCD_Display_Progress(App_t *app)
+{
+   LCD_Display_ProgressBar(app->progress_bar, app->status_color);
+}
+
+/**
+ * @brief Render progress bar.
+ *
+ * @param progress progress in interval 0-100 %
+ * @param color color of progress bar, color formate is argc
+ */
+static void LCD_Display_ProgressBar(uint16_t progress, uint32_t color)
+{
+   /* Clean space */
+   UTIL_LCD_FillRect(00, 440, 800, 20, APP_COLOR_BACKGROUND);
+   UTIL_LCD_FillRect(19, 439, 762, 22, APP_COLOR_TEXT);
+   UTIL_LCD_FillRect(20, 440, (uint32_t)(progress * 7.60), 20, color);
+}
+
+/**
+ * @brief Render special timer button for config time.
+ *
+ * @param app
+ */
+static void LCD_Display_TimerButton(App_t *app)
+{
+   LCD_SetFont(&FontMenlo32);
+   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
+   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
+   LCD_DisplayStringAtLine(4, (uint8_t *)"         +");
+   LCD_DisplayStringAtLine(9, (uint8_t *)"         -");
+   /* Time of config timer is in miliseconds */
+   char buf[8 + APP_FORMAT_HMS_MAX];
+   char *end = app_format_hms(app_format_str(buf, "       "),
+                              app->config_timer / SECOND);
+   *end = '\0';
+   LCD_SetFont(&FontAvenirNext20);
+   LCD_DisplayStringAtLine(11, (uint8_t *)&buf);
+}
+
+/**
+ * @brief Render round button with the border, the background color hides the
+ * button. The square of the button is cached as a sprite, the buttons of the
+ * same color share it.
+ *
+ * @param Xpos X position of the center
+ * @param color
+ */
+static void LCD_Display_Button(uint32_t Xpos, uint32_t color)
+{
+   const uint32_t radius = 92;
+   const uint32_t size = 2 * radius + 1;
+   const uint32_t shape[4] = {radius, color, APP_COLOR_TEXT,
+                              APP_COLOR_BACKGROUND};
+   const uint64_t key = app_sprite_hash(APP_SPRITE_SEED, shape, sizeof(shape));
+
+   if (LCD_BeginSprite(key, Xpos - radius, 220 - radius, size, size)) {
+      UTIL_LCD_FillRect(Xpos - radius, 220 - radius, size, size,
+                        APP_COLOR_BACKGROUND);
+      if (color != APP_COLOR_BACKGROUND) {
+         UTIL_LCD_FillCircle(Xpos, 220, radius, APP_COLOR_TEXT);
+         UTIL_LCD_FillCircle(Xpos, 220, radius - 2, color);
+      }
+      LCD_EndSprite();
+   }
+}
+
+/**
+ * @brief Render the left button. The left button can by displayed in 2 options:
+ * PUSH_BUTTON and TIMER_BUTTON. The PUSH_BUTTON is classical mode, TIMER_BUTTON
+ * is used for config timer value, the value is drawn by the timer dial widget.
+ *
+ * @param app
+ */
+static void LCD_Display_LeftButton(App_t *app)
+{
+   if (app->button_left_type == PUSH_BUTTON) {
+      LCD_Display_Button(200, app->button_left_color);
+   } else if (app->button_left_type == TIMER_BUTTON) {
+      LCD_Display_Button(200, APP_COLOR_BACKGROUND);
+   }
+   /* The dial was overdrawn */
+   widget_drawn[WIDGET_TIMER_DIAL] = WIDGET_INVALID;
+}
+
+/**
+ * @brief Render the timer dial inside of the TIMER_BUTTON.
+ *
+ * @param app
+ */
+static void LCD_Display_TimerDial(App_t *app)
+{
+   if (app->button_left_type == TIMER_BUTTON)
+      LCD_Display_TimerButton(app);
+}
+
+/**
+ * @brief Render the right button, that can by displayed in 2 options as
+ * PUSH_BUTTON or as NONE. The PUSH_BUTTON render classical button. The NONE
+ * options render circle in same color as a background, so there will be
+ * nothing.
+ *
+ * @param app
+ */
+static void LCD_Display_RightButton(App_t *app)
+{
+   if (app->button_right_type == PUSH_BUTTON) {
+      LCD_Display_Button(600, app->button_right_color);
+   } else if (app->button_right_type == NONE) {
+      LCD_Display_Button(600, APP_COLOR_BACKGROUND);
+   }
+}
+
+/**
+ * @brief Render titles under the buttons, the titles are taken from the scene
+ * descriptor.
+ *
+ * @param app
+ */
+static void LCD_Display_ButtonTitles(App_t *app)
+{
+   const char *const titles = APP_ButtonTitles(app->scene);
+   const uint64_t key = LCD_TextKey(titles, &FontAvenirNext20, APP_COLOR_TEXT,
+                                    APP_COLOR_BACKGROUND);
+
+   LCD_SetFont(&FontAvenirNext20);
+   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
+   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
+   if (LCD_BeginSprite(key, 0, LINE(17), HACT, UTIL_LCD_GetFont()->Height)) {
+      LCD_DisplayStringAtLine(17, (uint8_t *)titles);
+      LCD_EndSprite();
+   }
+}
+
+/**
+ * @brief One of three main logic function thats render data on display.
+ *
+ * @param app
+ */
+void APP_UpdateScene(App_t *app)
+{
+   /* Drawn back buffer waits for the end of the refresh, the scene is drawn
+    on APP_EVENT_REFRESH */
+   if (LCD_BeginDraw() < 0) {
+      render_deferred = 1;
+      return;
+   }
+   render_deferred = 0;
+
+#ifdef APP_RENDER_STATS
+   const uint64_t start = core_clock_us();
+   APP_RenderScene(app);
+   const uint64_t issued = core_clock_us();
+   app_dma2d_flush();
+   render_stats.frames++;
+   render_stats.render_us += issued - start;
+   render_stats.flush_us += core_clock_us() - issued;
+   render_stats.frame_us =
+       (uint32_t)((render_stats.render_us + render_stats.flush_us) /
+                  render_stats.frames);
+#else
+   APP_RenderScene(app);
+#endif
+   APP_RefreshDisplay();
+}
+
+/**
+ * @brief Draw the scene into the frame buffer of the LCD utility driver. Only
+ * widgets that show changed part of the app struct are drawn.
+ *
+ * @param app
+ * @return uint32_t count of drawn widgets
+ */
+uint32_t APP_RenderScene(App_t *app)
+{
+   uint32_t drawn = 0;
+
+   /* Update status message, only when the shown minutes change */
+   if (app->scene == WAITING_SCENE)
+      APP_FormatStatus(app, app->timer_left / (60 * SECOND));
+   /* Update progress bar*/
+   if (app->timer == 0)
+      app->progress_bar = 100;
+   else
+      app->progress_bar = (uint16_t)((100 * app->timer_left) / app->timer);
+
+   for (uint32_t i = 0; i < WIDGET_COUNT; i++) {
+      const uint64_t key = widget_desc[i].key(app);
+      if (key == widget_drawn[i])
+         continue;
+      widget_drawn[i] = key;
+      widget_desc[i].draw(app);
+      drawn++;
+   }
+   return drawn;
+}
+
+/**
+ * @brief Mark all widgets as not drawn, it has to be called when the frame
+ * buffer is cleared.
+ *
+ */
+void APP_InvalidateScene(void)
+{
+   for (uint32_t i = 0; i < WIDGET_COUNT; i++)
+      widget_drawn[i] = WIDGET_INVALID;
+}
+
+/**
+ * @brief Check that drawing of the scene waits for the end of the refresh.
+ *
+ * @return uint8_t 1 if APP_UpdateScene has to be called on APP_EVENT_REFRESH
+ */
+uint8_t APP_RenderDeferred(void) { return render_deferred; }
+
+#ifdef APP_RENDER_STATS
+/**
+ * @brief Get the CPU time of the frames drawn by APP_UpdateScene.
+ *
+ * @return const App_render_stats_t*
+ */
+const App_render_stats_t *APP_RenderStats(void) { return &render_stats; }
+#endif
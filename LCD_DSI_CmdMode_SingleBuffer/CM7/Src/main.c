@@ -35,123 +35,24 @@
  */
 
 /* Private typedef -----------------------------------------------------------*/
-extern LTDC_HandleTypeDef hlcd_ltdc;
 extern DSI_HandleTypeDef hlcd_dsi;
-DSI_VidCfgTypeDef hdsivideo_handle;
-DSI_CmdCfgTypeDef CmdCfg;
-DSI_LPCmdTypeDef LPCmd;
-DSI_PLLInitTypeDef dsiPllInit;
-static RCC_PeriphCLKInitTypeDef PeriphClkInitStruct;
-OTM8009A_Object_t *pObj;
-
-typedef enum {
-   FRONT_SCREEN,
-   TURNON_SCENE,
-   TIMER_CONFIG_SCENE,
-   WAITING_SCENE
-} Scene_t;
-typedef enum { PUSH_BUTTON, TIMER_BUTTON, NONE } Button_type_t;
-
-typedef struct {
-   Scene_t scene;
-   uint8_t _delay;
-   char status_message[50];
-   char title[50];
-   uint32_t status_color;
-   uint16_t progress_bar;
-   uint32_t timer;
-   uint32_t config_timer;
-   uint32_t timer_left;
-   uint32_t timer_start_time;
-   uint32_t button_left_color;
-   Button_type_t button_left_type;
-   uint32_t button_right_color;
-   Button_type_t button_right_type;
-} App_t;
 
 /* Private define ------------------------------------------------------------*/
 
-#define VSYNC 1
-#define VBP 1
-#define VFP 1
-#define VACT 480
-#define HSYNC 1
-#define HBP 1
-#define HFP 1
-#define HACT 800
-
 #define TS_ACCURACY 2
-#define TS_INSTANCE 0
-
-#define SECOND 1000
 
-#define APP_COLOR_BACKGROUND UTIL_LCD_COLOR_CUSTOM_Stone
-#define APP_COLOR_RED UTIL_LCD_COLOR_RED
-#define APP_COLOR_BLUE UTIL_LCD_COLOR_CUSTOM_Blue
-#define APP_COLOR_TEXT UTIL_LCD_COLOR_WHITE
-#define APP_COLOR_GREEN UTIL_LCD_COLOR_DARKGREEN
-#define APP_COLOR_YELLOW UTIL_LCD_COLOR_CUSTOM_Yellow
-#define APP_COLOR_STONE UTIL_LCD_COLOR_BLACK
-
-#define LAYER0_ADDRESS (LCD_FB_START_ADDRESS)
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-static int32_t pending_buffer = -1;
-
 /* Private function prototypes -----------------------------------------------*/
 static void SystemClock_Config(void);
-static void Error_Handler(void);
-
-/* LCD screen functions */
-static uint8_t LCD_Init(void);
-void LTDC_Init(void);
-
-static void LCD_LayertInit(uint16_t LayerIndex, uint32_t Address);
-static int32_t DSI_IO_Write(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData,
-                            uint16_t Size);
-static int32_t DSI_IO_Read(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData,
-                           uint16_t Size);
-int32_t LCD_GetXSize(uint32_t Instance, uint32_t *XSize);
-int32_t LCD_GetYSize(uint32_t Instance, uint32_t *YSize);
-void LCD_MspInit(void);
-
-/* Display functions */
-static void LCD_Display_SetStatus(char *ptr);
-static void LCD_Display_ProgressBar(uint16_t progress, uint32_t color);
-static void LCD_Display_SetTitle(char *ptr);
-static void LCD_Display_LeftButton(App_t *app);
-static void LCD_Display_RightButton(App_t *app);
-static void LCD_Display_ButtonTitles(App_t *app);
-static void LCD_Display_TimerButton(App_t *app);
 
 /* TouchScreen functions */
 int32_t TS_Init(void);
 
-/* Main app logic functions */
-static void APP_HandleTouch(TS_State_t *TS_State, App_t *app);
-static void APP_UpdateScene(App_t *app);
-uint8_t APP_HandleTouch_IsInInterval(TS_State_t *s, uint32_t x_max,
-                                     uint32_t x_min, uint32_t y_max,
-                                     uint32_t y_min);
-static void APP_StartTimer(App_t *app);
-static void APP_UpdateTimer(App_t *app);
-static void APP_TurnPeripheries(App_t *app);
-
-static void TO_FRONT_SCENE(App_t *app);
-static void TO_TURNON_SCENE(App_t *app);
-static void TO_TIMER_CONFIG_SCENE(App_t *app);
-static void TO_WAITING_SCENE(App_t *app);
-
 static void CPU_CACHE_Enable(void);
 static void MPU_Config(void);
 
-const LCD_UTILS_Drv_t LCD_UTIL_Driver = {
-    BSP_LCD_DrawBitmap,     BSP_LCD_FillRGBRect,   BSP_LCD_DrawHLine,
-    BSP_LCD_DrawVLine,      BSP_LCD_FillRect,      BSP_LCD_ReadPixel,
-    BSP_LCD_WritePixel,     LCD_GetXSize,          LCD_GetYSize,
-    BSP_LCD_SetActiveLayer, BSP_LCD_GetPixelFormat};
-
 /* Private functions ---------------------------------------------------------*/
 
 /**
@@ -167,11 +68,12 @@ int main(void)
     mode(Cortex-M4 in deep-sleep)
     */
 
-   /* Configure the MPU attributes as Write Through for SDRAM*/
+   /* Configure the MPU attributes as Write Through for SDRAM and as not
+    cacheable for the memory shared with Cortex-M4 */
    MPU_Config();
 
    /* Enable the CPU Cache */
-   // CPU_CACHE_Enable(); // ! FOR DUAL CORE COMMUN., CACHE SHOULD BE DISABLE
+   CPU_CACHE_Enable();
 
    /* STM32H7xx HAL library initialization:
     - Systick timer is configured by default as source of time base, but user
@@ -190,14 +92,59 @@ int main(void)
    /* When system initialization is finished, Cortex-M7 could wakeup (when
     needed) the Cortex-M4  by means of HSEM notification or by any D2 wakeup
     source (SEV,EXTI..)   */
+   core_clock_init();
+   core_share_init();
+   core_snapshot_init();
+   core_lock_clear_stats();
+   core_lock_init();
+   core_notify_init();
+   core_notify_boot_m4();
+
+#ifdef CORE_BENCH
+   /* Measure inter-core communication, results are in core_bench_results() */
+   core_bench_run_m7();
+#endif
+
+#ifdef APP_FORMAT_BENCH
+   /* Compare the formatter with sprintf, results are in
+    app_format_bench_results() */
+   app_format_bench_run();
+#endif
+
+#ifdef APP_RECT_BENCH
+   /* Measure coalescing of dirty rectangles, results are in
+    app_rect_bench_results() */
+   app_rect_bench_run();
+#endif
+
+#ifdef APP_TIMER_BENCH
+   /* Measure the timer wheel, results are in app_timer_bench_results().
+    Timers do not fit DTCM, AXI SRAM is not used by the linker script */
+   app_timer_bench_run((app_timer_t *)D1_AXISRAM_BASE, APP_TIMER_BENCH_COUNT);
+#endif
 
-   /* Initialize used Leds */
+   /* Initialize used Leds, M4 configures its Leds on the same port */
+   core_lock_take(CORE_LOCK_GPIO);
    BSP_LED_Init(LED3);
    BSP_LED_Init(LED4);
+   core_lock_release(CORE_LOCK_GPIO);
+
+   /* Record inputs of the scene logic, a recording before reset is kept,
+    it is replayed by the host build from a dump of AXI SRAM */
+   app_record_start();
+
+   /* Init RTC, the schedule is kept in its backup registers */
+   RTC_Init();
+   APP_ScheduleRestore(APP_RtcNow());
 
    /* Initialize the SDRAM */
    BSP_SDRAM_Init(0);
 
+#ifdef APP_FB_BENCH
+   /* Measure rendering of the scenes, results are in APP_FbBenchResults() */
+   APP_FbBench();
+#endif
+
    /* Init Touch Screen */
    if (TS_Init() != BSP_ERROR_NONE) {
       Error_Handler();
@@ -218,748 +165,33 @@ int main(void)
    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
 
    /* Initialize LTDC layer 0 iused for Hint */
+   LCD_DrawInit();
    LCD_LayertInit(0, LCD_FRAME_BUFFER);
    UTIL_LCD_SetFuncDriver(&LCD_UTIL_Driver);
 
    /* Enable DSI Wrapper so DSI IP will drive the LTDC */
    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
 
-   /* Clear display */
-   UTIL_LCD_Clear(APP_COLOR_BACKGROUND);
-
-   /*Refresh the LCD display*/
-   HAL_DSI_Refresh(&hlcd_dsi);
+#ifdef APP_GLYPH_BENCH
+   /* Measure drawing of text, results are in APP_GlyphBenchResults() */
+   APP_GlyphBench();
+#endif
 
-   /* Create App struct */
+   /* Clear display and render the first frame */
    App_t app;
-   app.progress_bar = 100;
-   app.timer = 0;
-   app.scene = FRONT_SCREEN;
-   sprintf(app.status_message, "  Toaster is stopped                         ");
-   sprintf(app.title, "            ~ TOASTER CONTROLLER ~");
-   app.status_color = APP_COLOR_RED;
-   app.button_left_color = APP_COLOR_GREEN;
-   app.button_left_type = PUSH_BUTTON;
-   app.button_right_color = APP_COLOR_YELLOW;
-   app.button_right_type = PUSH_BUTTON;
-   app._delay = 0;
-
-   TS_State_t TS_State;
+   APP_Start(&app);
 
    /* Infinite loop */
    while (1) {
-
-      BSP_TS_GetState(TS_INSTANCE, &TS_State);
-      /* Handel touch && Update app struct */
-      APP_HandleTouch(&TS_State, &app);
-
-      /* Update timer */
-      APP_UpdateTimer(&app);
-
-      /* Render display by app struct */
-      APP_UpdateScene(&app);
-
-      /* Turn on toaster, in testing mode I used LED */
-      APP_TurnPeripheries(&app);
-   }
-}
-/**
- * @brief  Gets the LCD X size.
- * @param  Instance  LCD Instance
- * @param  XSize     LCD width
- * @retval BSP status
- */
-int32_t LCD_GetXSize(uint32_t Instance, uint32_t *XSize)
-{
-   *XSize = Lcd_Ctx[0].XSize;
-
-   return BSP_ERROR_NONE;
-}
-
-/**
- * @brief  Gets the LCD Y size.
- * @param  Instance  LCD Instance
- * @param  YSize     LCD Height
- * @retval BSP status
- */
-int32_t LCD_GetYSize(uint32_t Instance, uint32_t *YSize)
-{
-   *YSize = Lcd_Ctx[0].YSize;
-
-   return BSP_ERROR_NONE;
-}
-/**
- * @brief  End of Refresh DSI callback.
- * @param  hdsi: pointer to a DSI_HandleTypeDef structure that contains
- *               the configuration information for the DSI.
- * @retval None
- */
-void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi)
-{
-   if (pending_buffer >= 0) {
-      pending_buffer = -1;
+      APP_Loop(&app);
    }
 }
-
 /**
- * @brief  Initializes the DSI LCD.
- * The ititialization is done as below:
- *     - DSI PLL ititialization
- *     - DSI ititialization
- *     - LTDC ititialization
- *     - OTM8009A LCD Display IC Driver ititialization
- * @param  None
- * @retval LCD state
- */
-static uint8_t LCD_Init(void)
-{
-   DSI_PHY_TimerTypeDef PhyTimings;
-   OTM8009A_IO_t IOCtx;
-   static OTM8009A_Object_t OTM8009AObj;
-   static void *Lcd_CompObj = NULL;
-
-   /* Toggle Hardware Reset of the DSI LCD using
-    its XRES signal (active low) */
-   BSP_LCD_Reset(0);
-
-   /* Call first MSP Initialize only in case of first initialization
-    * This will set IP blocks LTDC, DSI and DMA2D
-    * - out of reset
-    * - clocked
-    * - NVIC IRQ related to IP blocks enabled
-    */
-   LCD_MspInit();
-
-   /* LCD clock configuration */
-   /* LCD clock configuration */
-   /* PLL3_VCO Input = HSE_VALUE/PLL3M = 5 Mhz */
-   /* PLL3_VCO Output = PLL3_VCO Input * PLL3N = 800 Mhz */
-   /* PLLLCDCLK = PLL3_VCO Output/PLL3R = 800/19 = 42 Mhz */
-   /* LTDC clock frequency = PLLLCDCLK = 42 Mhz */
-   PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_LTDC;
-   PeriphClkInitStruct.PLL3.PLL3M = 5;
-   PeriphClkInitStruct.PLL3.PLL3N = 160;
-   PeriphClkInitStruct.PLL3.PLL3FRACN = 0;
-   PeriphClkInitStruct.PLL3.PLL3P = 2;
-   PeriphClkInitStruct.PLL3.PLL3Q = 2;
-   PeriphClkInitStruct.PLL3.PLL3R = 19;
-   PeriphClkInitStruct.PLL3.PLL3VCOSEL = RCC_PLL3VCOWIDE;
-   PeriphClkInitStruct.PLL3.PLL3RGE = RCC_PLL3VCIRANGE_2;
-   HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
-
-   /* Base address of DSI Host/Wrapper registers to be set before calling
-    * De-Init */
-   hlcd_dsi.Instance = DSI;
-
-   HAL_DSI_DeInit(&(hlcd_dsi));
-
-   dsiPllInit.PLLNDIV = 100;
-   dsiPllInit.PLLIDF = DSI_PLL_IN_DIV5;
-   dsiPllInit.PLLODF = DSI_PLL_OUT_DIV1;
-
-   hlcd_dsi.Init.NumberOfLanes = DSI_TWO_DATA_LANES;
-   hlcd_dsi.Init.TXEscapeCkdiv = 0x4;
-
-   HAL_DSI_Init(&(hlcd_dsi), &(dsiPllInit));
-
-   /* Configure the DSI for Command mode */
-   CmdCfg.VirtualChannelID = 0;
-   CmdCfg.HSPolarity = DSI_HSYNC_ACTIVE_HIGH;
-   CmdCfg.VSPolarity = DSI_VSYNC_ACTIVE_HIGH;
-   CmdCfg.DEPolarity = DSI_DATA_ENABLE_ACTIVE_HIGH;
-   CmdCfg.ColorCoding = DSI_RGB888;
-   CmdCfg.CommandSize = HACT;
-   CmdCfg.TearingEffectSource = DSI_TE_DSILINK;
-   CmdCfg.TearingEffectPolarity = DSI_TE_RISING_EDGE;
-   CmdCfg.VSyncPol = DSI_VSYNC_FALLING;
-   CmdCfg.AutomaticRefresh = DSI_AR_DISABLE;
-   CmdCfg.TEAcknowledgeRequest = DSI_TE_ACKNOWLEDGE_ENABLE;
-   HAL_DSI_ConfigAdaptedCommandMode(&hlcd_dsi, &CmdCfg);
-
-   LPCmd.LPGenShortWriteNoP = DSI_LP_GSW0P_ENABLE;
-   LPCmd.LPGenShortWriteOneP = DSI_LP_GSW1P_ENABLE;
-   LPCmd.LPGenShortWriteTwoP = DSI_LP_GSW2P_ENABLE;
-   LPCmd.LPGenShortReadNoP = DSI_LP_GSR0P_ENABLE;
-   LPCmd.LPGenShortReadOneP = DSI_LP_GSR1P_ENABLE;
-   LPCmd.LPGenShortReadTwoP = DSI_LP_GSR2P_ENABLE;
-   LPCmd.LPGenLongWrite = DSI_LP_GLW_ENABLE;
-   LPCmd.LPDcsShortWriteNoP = DSI_LP_DSW0P_ENABLE;
-   LPCmd.LPDcsShortWriteOneP = DSI_LP_DSW1P_ENABLE;
-   LPCmd.LPDcsShortReadNoP = DSI_LP_DSR0P_ENABLE;
-   LPCmd.LPDcsLongWrite = DSI_LP_DLW_ENABLE;
-   HAL_DSI_ConfigCommand(&hlcd_dsi, &LPCmd);
-
-   /* Initialize LTDC */
-   LTDC_Init();
-
-   /* Start DSI */
-   HAL_DSI_Start(&(hlcd_dsi));
-
-   /* Configure DSI PHY HS2LP and LP2HS timings */
-   PhyTimings.ClockLaneHS2LPTime = 35;
-   PhyTimings.ClockLaneLP2HSTime = 35;
-   PhyTimings.DataLaneHS2LPTime = 35;
-   PhyTimings.DataLaneLP2HSTime = 35;
-   PhyTimings.DataLaneMaxReadTime = 0;
-   PhyTimings.StopWaitTime = 10;
-   HAL_DSI_ConfigPhyTimer(&hlcd_dsi, &PhyTimings);
-
-   /* Initialize the OTM8009A LCD Display IC Driver (KoD LCD IC Driver) */
-   IOCtx.Address = 0;
-   IOCtx.GetTick = BSP_GetTick;
-   IOCtx.WriteReg = DSI_IO_Write;
-   IOCtx.ReadReg = DSI_IO_Read;
-   OTM8009A_RegisterBusIO(&OTM8009AObj, &IOCtx);
-   Lcd_CompObj = (&OTM8009AObj);
-   OTM8009A_Init(Lcd_CompObj, OTM8009A_COLMOD_RGB888,
-                 LCD_ORIENTATION_LANDSCAPE);
-
-   LPCmd.LPGenShortWriteNoP = DSI_LP_GSW0P_DISABLE;
-   LPCmd.LPGenShortWriteOneP = DSI_LP_GSW1P_DISABLE;
-   LPCmd.LPGenShortWriteTwoP = DSI_LP_GSW2P_DISABLE;
-   LPCmd.LPGenShortReadNoP = DSI_LP_GSR0P_DISABLE;
-   LPCmd.LPGenShortReadOneP = DSI_LP_GSR1P_DISABLE;
-   LPCmd.LPGenShortReadTwoP = DSI_LP_GSR2P_DISABLE;
-   LPCmd.LPGenLongWrite = DSI_LP_GLW_DISABLE;
-   LPCmd.LPDcsShortWriteNoP = DSI_LP_DSW0P_DISABLE;
-   LPCmd.LPDcsShortWriteOneP = DSI_LP_DSW1P_DISABLE;
-   LPCmd.LPDcsShortReadNoP = DSI_LP_DSR0P_DISABLE;
-   LPCmd.LPDcsLongWrite = DSI_LP_DLW_DISABLE;
-   HAL_DSI_ConfigCommand(&hlcd_dsi, &LPCmd);
-
-   HAL_DSI_ConfigFlowControl(&hlcd_dsi, DSI_FLOW_CONTROL_BTA);
-   HAL_DSI_ForceRXLowPower(&hlcd_dsi, ENABLE);
-
-   return BSP_ERROR_NONE;
-}
-
-/**
- * @brief
- * @param  None
+ * @brief  Touch controller EXTI callback.
+ * @param  Instance TS instance
  * @retval None
  */
-void LTDC_Init(void)
-{
-   /* DeInit */
-   hlcd_ltdc.Instance = LTDC;
-   HAL_LTDC_DeInit(&hlcd_ltdc);
-
-   /* LTDC Config */
-   /* Timing and polarity */
-   hlcd_ltdc.Init.HorizontalSync = HSYNC;
-   hlcd_ltdc.Init.VerticalSync = VSYNC;
-   hlcd_ltdc.Init.AccumulatedHBP = HSYNC + HBP;
-   hlcd_ltdc.Init.AccumulatedVBP = VSYNC + VBP;
-   hlcd_ltdc.Init.AccumulatedActiveH = VSYNC + VBP + VACT;
-   hlcd_ltdc.Init.AccumulatedActiveW = HSYNC + HBP + HACT;
-   hlcd_ltdc.Init.TotalHeigh = VSYNC + VBP + VACT + VFP;
-   hlcd_ltdc.Init.TotalWidth = HSYNC + HBP + HACT + HFP;
-
-   /* background value */
-   hlcd_ltdc.Init.Backcolor.Blue = 0;
-   hlcd_ltdc.Init.Backcolor.Green = 0;
-   hlcd_ltdc.Init.Backcolor.Red = 0;
-
-   /* Polarity */
-   hlcd_ltdc.Init.HSPolarity = LTDC_HSPOLARITY_AL;
-   hlcd_ltdc.Init.VSPolarity = LTDC_VSPOLARITY_AL;
-   hlcd_ltdc.Init.DEPolarity = LTDC_DEPOLARITY_AL;
-   hlcd_ltdc.Init.PCPolarity = LTDC_PCPOLARITY_IPC;
-   hlcd_ltdc.Instance = LTDC;
-
-   HAL_LTDC_Init(&hlcd_ltdc);
-}
-
-/**
- * @brief  Initializes the LCD layers.
- * @param  LayerIndex: Layer foreground or background
- * @param  FB_Address: Layer frame buffer
- * @retval None
- */
-static void LCD_LayertInit(uint16_t LayerIndex, uint32_t Address)
-{
-   LTDC_LayerCfgTypeDef layercfg;
-
-   /* Layer Init */
-   layercfg.WindowX0 = 0;
-   layercfg.WindowX1 = Lcd_Ctx[0].XSize;
-   layercfg.WindowY0 = 0;
-   layercfg.WindowY1 = Lcd_Ctx[0].YSize;
-   layercfg.PixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
-   layercfg.FBStartAdress = Address;
-   layercfg.Alpha = 255;
-   layercfg.Alpha0 = 0;
-   layercfg.Backcolor.Blue = 0;
-   layercfg.Backcolor.Green = 0;
-   layercfg.Backcolor.Red = 0;
-   layercfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
-   layercfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
-   layercfg.ImageWidth = Lcd_Ctx[0].XSize;
-   layercfg.ImageHeight = Lcd_Ctx[0].YSize;
-
-   HAL_LTDC_ConfigLayer(&hlcd_ltdc, &layercfg, LayerIndex);
-}
-
-/**
- * @brief  DCS or Generic short/long write command
- * @param  ChannelNbr Virtual channel ID
- * @param  Reg Register to be written
- * @param  pData pointer to a buffer of data to be write
- * @param  Size To precise command to be used (short or long)
- * @retval BSP status
- */
-static int32_t DSI_IO_Write(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData,
-                            uint16_t Size)
-{
-   int32_t ret = BSP_ERROR_NONE;
-
-   if (Size <= 1U) {
-      if (HAL_DSI_ShortWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_SHORT_PKT_WRITE_P1,
-                             Reg, (uint32_t)pData[Size]) != HAL_OK) {
-         ret = BSP_ERROR_BUS_FAILURE;
-      }
-   } else {
-      if (HAL_DSI_LongWrite(&hlcd_dsi, ChannelNbr, DSI_DCS_LONG_PKT_WRITE, Size,
-                            (uint32_t)Reg, pData) != HAL_OK) {
-         ret = BSP_ERROR_BUS_FAILURE;
-      }
-   }
-
-   return ret;
-}
-
-/**
- * @brief  DCS or Generic read command
- * @param  ChannelNbr Virtual channel ID
- * @param  Reg Register to be read
- * @param  pData pointer to a buffer to store the payload of a read back
- * operation.
- * @param  Size  Data size to be read (in byte).
- * @retval BSP status
- */
-static int32_t DSI_IO_Read(uint16_t ChannelNbr, uint16_t Reg, uint8_t *pData,
-                           uint16_t Size)
-{
-   int32_t ret = BSP_ERROR_NONE;
-
-   if (HAL_DSI_Read(&hlcd_dsi, ChannelNbr, pData, Size, DSI_DCS_SHORT_PKT_READ,
-                    Reg, pData) != HAL_OK) {
-      ret = BSP_ERROR_BUS_FAILURE;
-   }
-
-   return ret;
-}
-
-void LCD_MspInit(void)
-{
-   /** @brief Enable the LTDC clock */
-   __HAL_RCC_LTDC_CLK_ENABLE();
-
-   /** @brief Toggle Sw reset of LTDC IP */
-   __HAL_RCC_LTDC_FORCE_RESET();
-   __HAL_RCC_LTDC_RELEASE_RESET();
-
-   /** @brief Enable the DMA2D clock */
-   __HAL_RCC_DMA2D_CLK_ENABLE();
-
-   /** @brief Toggle Sw reset of DMA2D IP */
-   __HAL_RCC_DMA2D_FORCE_RESET();
-   __HAL_RCC_DMA2D_RELEASE_RESET();
-
-   /** @brief Enable DSI Host and wrapper clocks */
-   __HAL_RCC_DSI_CLK_ENABLE();
-
-   /** @brief Soft Reset the DSI Host and wrapper */
-   __HAL_RCC_DSI_FORCE_RESET();
-   __HAL_RCC_DSI_RELEASE_RESET();
-
-   /** @brief NVIC configuration for LTDC interrupt that is now enabled */
-   HAL_NVIC_SetPriority(LTDC_IRQn, 9, 0xf);
-   HAL_NVIC_EnableIRQ(LTDC_IRQn);
-
-   /** @brief NVIC configuration for DMA2D interrupt that is now enabled */
-   HAL_NVIC_SetPriority(DMA2D_IRQn, 9, 0xf);
-   HAL_NVIC_EnableIRQ(DMA2D_IRQn);
-
-   /** @brief NVIC configuration for DSI interrupt that is now enabled */
-   HAL_NVIC_SetPriority(DSI_IRQn, 9, 0xf);
-   HAL_NVIC_EnableIRQ(DSI_IRQn);
-}
-
-/**
- * @brief Setup status message above the progress bar.
- *
- * @param ptr pointer to array of chars
- */
-static void LCD_Display_SetStatus(char *ptr)
-{
-   UTIL_LCD_SetFont(&Font16);
-   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
-   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
-   UTIL_LCD_DisplayStringAtLine(26, ptr);
-}
-
-/**
- * @brief Setup title and header background.
- *
- * @param ptr pointer to array of chars
- */
-static void LCD_Display_SetTitle(char *ptr)
-{
-   UTIL_LCD_FillRect(0, 0, 800, 75, APP_COLOR_STONE);
-   UTIL_LCD_SetFont(&FontAvenirNext20);
-   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
-   UTIL_LCD_SetBackColor(APP_COLOR_STONE);
-   UTIL_LCD_DisplayStringAtLine(1, ptr);
-   // UTIL_LCD_FillRect(170, 80, 460, 1, APP_COLOR_TEXT);
-}
-
-/**
- * @brief Render progress bar.
- *
- * @param progress progress in interval 0-100 %
- * @param color color of progress bar, color formate is argc
- */
-static void LCD_Display_ProgressBar(uint16_t progress, uint32_t color)
-{
-   /* Clean space */
-   UTIL_LCD_FillRect(00, 440, 800, 20, APP_COLOR_BACKGROUND);
-   UTIL_LCD_FillRect(19, 439, 762, 22, APP_COLOR_TEXT);
-   UTIL_LCD_FillRect(20, 440, (uint32_t)(progress * 7.60), 20, color);
-}
-
-/**
- * @brief Render special timer button for config time.
- *
- * @param app
- */
-static void LCD_Display_TimerButton(App_t *app)
-{
-   UTIL_LCD_SetFont(&FontMenlo32);
-   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
-   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
-   UTIL_LCD_DisplayStringAtLine(4, (uint8_t *)"         +");
-   UTIL_LCD_DisplayStringAtLine(9, (uint8_t *)"         -");
-   char buf[40];
-   uint32_t tmp = app->config_timer / SECOND; // from miliseconds to seconds
-   uint32_t h = tmp / 3600;
-   tmp %= 3600;
-   uint32_t m = tmp / 60;
-   uint32_t s = tmp % 60;
-   sprintf(buf, "       %02ld:%02ld:%02ld", h, m, s);
-   UTIL_LCD_SetFont(&FontAvenirNext20);
-   UTIL_LCD_DisplayStringAtLine(11, (uint8_t *)&buf);
-}
-
-/**
- * @brief Render the left button. The left button can by displayed in 2 options:
- * PUSH_BUTTON and TIMER_BUTTON. The PUSH_BUTTON is classical mode, TIMER_BUTTON
- * is used for config timer value.
- *
- * @param app
- */
-static void LCD_Display_LeftButton(App_t *app)
-{
-   if (app->button_left_type == PUSH_BUTTON) {
-      UTIL_LCD_FillCircle(200, 220, 92, APP_COLOR_TEXT);
-      UTIL_LCD_FillCircle(200, 220, 90, app->button_left_color);
-   } else if (app->button_left_type == TIMER_BUTTON) {
-      UTIL_LCD_FillCircle(200, 220, 92, APP_COLOR_BACKGROUND);
-      LCD_Display_TimerButton(app);
-   }
-}
-
-/**
- * @brief Render the right button, that can by displayed in 2 options as
- * PUSH_BUTTON or as NONE. The PUSH_BUTTON render classical button. The NONE
- * options render circle in same color as a background, so there will be
- * nothing.
- *
- * @param app
- */
-static void LCD_Display_RightButton(App_t *app)
-{
-   if (app->button_right_type == PUSH_BUTTON) {
-      UTIL_LCD_FillCircle(600, 220, 92, APP_COLOR_TEXT);
-      UTIL_LCD_FillCircle(600, 220, 90, app->button_right_color);
-   } else if (app->button_right_type == NONE) {
-      UTIL_LCD_FillCircle(600, 220, 92, APP_COLOR_BACKGROUND);
-   }
-}
-
-/**
- * @brief Render titles under the buttons. There are a four options
- * (FRONT_SCREEN, MANUALLY_SCREEN, TIMER_CONFIG_SCENE and WAITING_SCENE) thats
- * switched by app scene.
- *
- * @param app
- */
-static void LCD_Display_ButtonTitles(App_t *app)
-{
-   UTIL_LCD_SetFont(&FontAvenirNext20);
-   UTIL_LCD_SetTextColor(APP_COLOR_TEXT);
-   UTIL_LCD_SetBackColor(APP_COLOR_BACKGROUND);
-   switch (app->scene) {
-   case FRONT_SCREEN:
-      UTIL_LCD_DisplayStringAtLine(
-          17, (uint8_t *)"     MANUALLY START          SETUP TIMER           ");
-      break;
-   case TURNON_SCENE:
-      UTIL_LCD_DisplayStringAtLine(
-          17, (uint8_t *)"     MANUALLY STOP                                 ");
-      break;
-
-   case TIMER_CONFIG_SCENE:
-      UTIL_LCD_DisplayStringAtLine(
-          17, (uint8_t *)"                             START TIMER           ");
-      break;
-   case WAITING_SCENE:
-      UTIL_LCD_DisplayStringAtLine(
-          17, (uint8_t *)"      STOP TIMER            MANUALLY START         ");
-      break;
-   }
-}
-
-/**
- * @brief The util function to determine if the touch is in the area. The
- * examined area is in the shape of a square.
- *
- * @param s (TS_State_t) The structure returned from touch screen
- * @param x_max
- * @param x_min
- * @param y_max
- * @param y_min
- * @return uint8_t
- */
-uint8_t APP_HandleTouch_IsInInterval(TS_State_t *s, uint32_t x_max,
-                                     uint32_t x_min, uint32_t y_max,
-                                     uint32_t y_min)
-{
-   if (s->TouchX < x_max && s->TouchX > x_min && s->TouchY < y_max &&
-       s->TouchY > y_min)
-      return 1;
-   else
-      return 0;
-}
-
-/**
- * @brief Start software timer thats work by sys ticks.
- *
- * @param app
- */
-static void APP_StartTimer(App_t *app)
-{
-   app->timer_left = app->timer;
-   app->timer_start_time = HAL_GetTick();
-}
-
-/**
- * @brief Update software timer by sys tick value.
- *
- * @param app
- */
-static void APP_UpdateTimer(App_t *app)
-{
-   if (app->timer != 0) {
-      uint32_t now = HAL_GetTick();
-      if (app->timer > now - app->timer_start_time)
-         app->timer_left = app->timer - (now - app->timer_start_time);
-      else {
-         if (app->scene == WAITING_SCENE)
-            TO_TURNON_SCENE(app);
-         else
-            TO_FRONT_SCENE(app);
-      }
-   }
-}
-
-/**
- * @brief Transition to the front page.
- *
- * @param app
- */
-static void TO_FRONT_SCENE(App_t *app)
-{
-   app->_delay = 1;
-   app->scene = FRONT_SCREEN;
-   app->button_left_color = APP_COLOR_GREEN;
-   app->button_left_type = PUSH_BUTTON;
-   app->button_right_color = APP_COLOR_YELLOW;
-   app->button_right_type = PUSH_BUTTON;
-   sprintf(app->status_message,
-           "  Toaster is stopped                         ");
-   app->status_color = APP_COLOR_RED;
-
-   app->timer = 0;
-}
-
-/**
- * @brief Transition to the manual page.
- *
- * @param app
- */
-static void TO_TURNON_SCENE(App_t *app)
-{
-   app->_delay = 1;
-   app->scene = TURNON_SCENE;
-   app->button_left_color = APP_COLOR_RED;
-   app->button_left_type = PUSH_BUTTON;
-   app->button_right_type = NONE;
-   sprintf(app->status_message, "  Started manually                          ");
-   app->status_color = APP_COLOR_GREEN;
-
-   /* Set up timer */
-   app->timer = 1 * 60 * SECOND; // 1 min
-   APP_StartTimer(app);
-}
-
-/**
- * @brief Transition to the config scene.
- *
- * @param app
- */
-static void TO_TIMER_CONFIG_SCENE(App_t *app)
-{
-   app->_delay = 1;
-   app->scene = TIMER_CONFIG_SCENE;
-   app->button_right_color = APP_COLOR_GREEN;
-   app->button_left_type = TIMER_BUTTON;
-   app->status_color = APP_COLOR_YELLOW;
-   sprintf(app->status_message, "  Delay configuration                       ");
-
-   app->config_timer =
-       17 * 60 * SECOND + 21 * SECOND; // default 17 min and 21 s
-}
-
-/**
- * @brief Transition to the waiting scene.
- *
- * @param app
- */
-static void TO_WAITING_SCENE(App_t *app)
-{
-   app->_delay = 1;
-   app->scene = WAITING_SCENE;
-   app->button_left_color = APP_COLOR_YELLOW;
-   app->button_left_type = PUSH_BUTTON;
-   app->button_right_color = APP_COLOR_GREEN;
-   app->button_right_type = PUSH_BUTTON;
-   app->status_color = APP_COLOR_YELLOW;
-   app->timer = app->config_timer;
-   sprintf(app->status_message, "  Start in %ld min",
-           app->timer / (60 * SECOND));
-   APP_StartTimer(app);
-}
-
-/**
- * @brief One of three main logic function thats handle touch screen.
- *
- * @param TS_State
- * @param app
- */
-static void APP_HandleTouch(TS_State_t *TS_State, App_t *app)
-{
-   if (TS_State->TouchDetected != 0U) {
-
-      /* Handle config timer time */
-      if (app->scene == TIMER_CONFIG_SCENE) {
-         if (APP_HandleTouch_IsInInterval(TS_State, 450, 250, 300, 80))
-            app->config_timer += SECOND;
-         else if (APP_HandleTouch_IsInInterval(TS_State, 210, 20, 300, 80))
-            app->config_timer -= SECOND;
-      }
-
-      if (APP_HandleTouch_IsInInterval(TS_State, 320, 160, 283, 125)) {
-         /* Detect left button push */
-         switch (app->scene) {
-            /* PUSH MANUALLY START button -> Set up TURNON_SCENE */
-         case FRONT_SCREEN:
-            TO_TURNON_SCENE(app);
-            break;
-            /* PUSH MANUALLY STOP button -> Set up FRONT_SCREEN */
-         case TURNON_SCENE:
-            TO_FRONT_SCENE(app);
-            break;
-         case WAITING_SCENE:
-            TO_FRONT_SCENE(app);
-            break;
-         }
-      } else if (APP_HandleTouch_IsInInterval(TS_State, 320, 160, 670, 539)) {
-         /* Detect right button push */
-         switch (app->scene) {
-         case FRONT_SCREEN:
-            TO_TIMER_CONFIG_SCENE(app);
-            break;
-         case TIMER_CONFIG_SCENE:
-            TO_WAITING_SCENE(app);
-            break;
-         case WAITING_SCENE:
-            TO_TURNON_SCENE(app);
-            break;
-         }
-      }
-   }
-}
-
-/**
- * @brief One of three main logic function thats render data on display.
- *
- * @param app
- */
-static void APP_UpdateScene(App_t *app)
-{
-   /* Update button titles by scene */
-   LCD_Display_ButtonTitles(app);
-
-   /* Update right button */
-   LCD_Display_RightButton(app);
-   /* Update left button */
-   LCD_Display_LeftButton(app);
-
-   /* Update title */
-   LCD_Display_SetTitle(app->title);
-
-   /* Update status message */
-   if (app->scene == WAITING_SCENE) {
-      sprintf(app->status_message,
-              "  Start in %ld min                          ",
-              app->timer_left / (60 * SECOND));
-   }
-   LCD_Display_SetStatus(app->status_message);
-   /* Update progress bar*/
-   if (app->timer == 0)
-      app->progress_bar = 100;
-   else
-      app->progress_bar = (uint16_t)((100 * app->timer_left) / app->timer);
-   LCD_Display_ProgressBar(app->progress_bar, app->status_color);
-
-   /*Refresh the LCD display*/
-   // HAL_Delay(10);
-   HAL_DSI_Refresh(&hlcd_dsi);
-   if (app->_delay) {
-      HAL_Delay(800);
-      app->_delay = 0;
-   }
-}
-
-/**
- * @brief On TURNON_SCENE turn on LED4 and send message trough shared memory to
- * M4 CPU.
- *
- * @param app
- */
-static void APP_TurnPeripheries(App_t *app)
-{
-   if (app->scene == TURNON_SCENE) {
-      const int buff[] = {1, 1};
-      BSP_LED_On(LED4);
-      put_to_m4(&buff, 2);
-   } else {
-      const int buff[] = {1, 0};
-      BSP_LED_Off(LED4);
-      put_to_m4(&buff, 2);
-   }
-}
+void BSP_TS_Callback(uint32_t Instance) { app_event_post(APP_EVENT_TOUCH); }
 
 /**
  * @brief Init touch screen.
@@ -978,7 +210,8 @@ int32_t TS_Init(void)
    int32_t ret = BSP_TS_Init(TS_INSTANCE, &TS_InitStruct);
    if (ret != BSP_ERROR_NONE)
       return ret;
-   // ret = BSP_TS_EnableIT(TS_INSTANCE);
+   /* The main loop sleeps until the touch interrupt */
+   ret = BSP_TS_EnableIT(TS_INSTANCE);
    return ret;
 }
 
@@ -1094,9 +327,11 @@ static void CPU_CACHE_Enable(void)
 }
 
 /**
- * @brief  Configure the MPU attributes as Write Through for External SDRAM.
- * @note   The Base Address is 0xD0000000 .
+ * @brief  Configure the MPU attributes as Write Through for External SDRAM
+ *         and as Not Cacheable, Shareable for RAM_D3 shared with Cortex-M4.
+ * @note   The SDRAM Base Address is 0xD0000000 .
  *         The Configured Region Size is 32MB because same as SDRAM size.
+ *         The RAM_D3 Base Address is 0x38000000, the Size is 64KB.
  * @param  None
  * @retval None
  */
@@ -1137,6 +372,22 @@ static void MPU_Config(void)
 
    HAL_MPU_ConfigRegion(&MPU_InitStruct);
 
+   /* Configure the MPU attributes as Not Cacheable for shared RAM_D3, so both
+    cores always see the same data */
+   MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+   MPU_InitStruct.BaseAddress = D3_SRAM_BASE;
+   MPU_InitStruct.Size = MPU_REGION_SIZE_64KB;
+   MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
+   MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+   MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+   MPU_InitStruct.IsShareable = MPU_ACCESS_SHAREABLE;
+   MPU_InitStruct.Number = MPU_REGION_NUMBER2;
+   MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+   MPU_InitStruct.SubRegionDisable = 0x00;
+   MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+
+   HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
    /* Enable the MPU */
    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
 }
@@ -1145,7 +396,7 @@ static void MPU_Config(void)
  * @brief Error Handler
  * @retval None
  */
-static void Error_Handler(void)
+void Error_Handler(void)
 {
 
    BSP_LED_On(LED3);
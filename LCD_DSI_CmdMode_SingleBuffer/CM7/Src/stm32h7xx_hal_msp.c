@@ -39,6 +39,54 @@
   * @{
   */
 
+/**
+  * @brief  RTC MSP Initialization. RTC is clocked by LSE, so the calendar and
+  *         the backup registers are kept over reset. When LSE does not start,
+  *         RTC runs from LSI, which is off by a few percent and stops over
+  *         a power loss.
+  * @param  hrtc: RTC handle pointer
+  * @retval None
+  */
+void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_PeriphCLKInitTypeDef PeriphClkInitStruct = {0};
+
+  /* Backup domain is write protected after reset */
+  HAL_PWR_EnableBkUpAccess();
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    /* Crystal is missing or broken, 32 kHz LSI to 1 Hz */
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSI;
+    RCC_OscInitStruct.LSIState = RCC_LSI_ON;
+    if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSI;
+    hrtc->Init.AsynchPrediv = 127;
+    hrtc->Init.SynchPrediv = 249;
+  }
+
+  /* Backup domain is reset only when the RTC clock source changes, then the
+     schedule in the backup registers is lost and the calendar is seeded */
+  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  __HAL_RCC_RTC_ENABLE();
+
+  HAL_NVIC_SetPriority(RTC_Alarm_IRQn, 10, 0);
+  HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
+}
+
 
 /**
   * @}
@@ -33,6 +33,7 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/ 
 extern DSI_HandleTypeDef hlcd_dsi;
+extern RTC_HandleTypeDef hrtc;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -154,6 +155,61 @@ void DSI_IRQHandler(void)
   HAL_DSI_IRQHandler(&hlcd_dsi);
 }
 
+/**
+  * @brief  This function handles External lines 9 to 5 interrupt request,
+  *         the touch controller interrupt is on line 7.
+  * @param  None
+  * @retval None
+  */
+void EXTI9_5_IRQHandler(void)
+{
+  BSP_TS_IRQHandler(0);
+}
+
+/**
+  * @brief  This function handles HSEM interrupt request of Cortex-M7.
+  * @param  None
+  * @retval None
+  */
+void HSEM1_IRQHandler(void)
+{
+  HAL_HSEM_IRQHandler();
+}
+
+/**
+  * @brief  This function handles TIM2 interrupt request, TIM2 is the core
+  *         clock and its compare is the deadline of the main loop.
+  * @param  None
+  * @retval None
+  */
+void TIM2_IRQHandler(void)
+{
+  core_clock_irq();
+  if (core_clock_alarm_irq())
+    app_event_tick((uint32_t)core_clock_ms());
+}
+
+/**
+  * @brief  This function handles DMA2D interrupt request, the next queued
+  *         operation is started.
+  * @param  None
+  * @retval None
+  */
+void DMA2D_IRQHandler(void)
+{
+  app_dma2d_irq();
+}
+
+/**
+  * @brief  This function handles RTC Alarm interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RTC_Alarm_IRQHandler(void)
+{
+  HAL_RTC_AlarmIRQHandler(&hrtc);
+}
+
 /**
   * @}
   */
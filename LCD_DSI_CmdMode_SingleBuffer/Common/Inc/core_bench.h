@@ -0,0 +1,92 @@
+/*
+ * core_bench.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_BENCH_H_
+#define CORE_BENCH_H_
+
+#include <stdint.h>
+
+/*
+ * Inter-core benchmark, built only with CORE_BENCH defined in both projects.
+ * M7 drives the scenarios, M4 echoes the messages. Results are written into
+ * the shared table, so they can be read by the debugger from any core.
+ */
+
+/* Number of measured message sizes: 1, 2, 4 ... BUFFSHAREDSIZE items */
+#define CORE_BENCH_SIZES (8U)
+
+/* Round trips measured for every message size */
+#ifndef CORE_BENCH_ROUNDS
+#define CORE_BENCH_ROUNDS (256U)
+#endif
+
+/* Messages streamed for throughput for every message size */
+#ifndef CORE_BENCH_STREAM
+#define CORE_BENCH_STREAM (4096U)
+#endif
+
+/* Result for one message size, times are in nanoseconds */
+typedef struct {
+   uint32_t size;         /* items in one message */
+   uint32_t rtt_min;      /* round trip M7 -> M4 -> M7 */
+   uint32_t rtt_avg;
+   uint32_t rtt_max;
+   uint32_t one_way_min;  /* M7 -> M4, clocks aligned by the fastest trip */
+   uint32_t one_way_avg;
+   uint32_t one_way_max;
+   uint32_t msgs_per_s;   /* sustained M7 -> M4 throughput */
+   uint32_t full_permille; /* sends refused because the queue was full */
+} core_bench_result_t;
+
+typedef struct {
+   uint32_t done;   /* 1 when all results are valid */
+   uint32_t m7_hz;  /* M7 core clock */
+   uint32_t m4_hz;  /* M4 core clock */
+   core_bench_result_t result[CORE_BENCH_SIZES];
+} core_bench_table_t;
+
+/**
+ * @brief Run all scenarios on M7, M4 has to run core_bench_run_m4(). Both
+ *        cores continue with the application afterwards.
+ */
+void core_bench_run_m7(void);
+
+/**
+ * @brief Echo benchmark messages on M4 until M7 finishes the scenarios
+ */
+void core_bench_run_m4(void);
+
+/**
+ * @brief Get the shared results table
+ * @return const core_bench_table_t*
+ */
+const core_bench_table_t *core_bench_results(void);
+
+#endif /* CORE_BENCH_H_ */
@@ -0,0 +1,101 @@
+/*
+ * core_cache.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_CACHE_H_
+#define CORE_CACHE_H_
+
+#include <stdint.h>
+
+#if defined(CORE_CM7) || defined(CORE_CM4)
+#include "stm32h7xx.h"
+#endif
+
+/*
+ * Cache maintenance of buffers shared with other bus masters (M4, DMA2D,
+ * LTDC). On cores without D-cache and on host builds all of them are no-op.
+ */
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+
+/* Cortex-M7 L1 D-cache line size in bytes */
+#define CACHE_LINE_SIZE (32U)
+
+/**
+ * @brief Write cached data of the area back to the memory
+ * @param addr
+ * @param size in bytes
+ */
+static inline void cache_clean(const void *const addr, const uint32_t size)
+{
+   if (SCB->CCR & SCB_CCR_DC_Msk) {
+      const uint32_t start = (uint32_t)addr & ~(CACHE_LINE_SIZE - 1U);
+      const uint32_t end = (uint32_t)addr + size;
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+   }
+}
+
+/**
+ * @brief Drop cached data of the area, next read goes to the memory
+ * @param addr
+ * @param size in bytes
+ */
+static inline void cache_invalidate(void *const addr, const uint32_t size)
+{
+   if (SCB->CCR & SCB_CCR_DC_Msk) {
+      const uint32_t start = (uint32_t)addr & ~(CACHE_LINE_SIZE - 1U);
+      const uint32_t end = (uint32_t)addr + size;
+      SCB_InvalidateDCache_by_Addr((void *)start, (int32_t)(end - start));
+   }
+}
+
+/**
+ * @brief Wait until all buffered writes (write-through areas) reach the memory
+ */
+static inline void cache_sync(void) { __DSB(); }
+
+#else
+
+static inline void cache_clean(const void *const addr, const uint32_t size)
+{
+   (void)addr;
+   (void)size;
+}
+
+static inline void cache_invalidate(void *const addr, const uint32_t size)
+{
+   (void)addr;
+   (void)size;
+}
+
+static inline void cache_sync(void) {}
+
+#endif
+
+#endif /* CORE_CACHE_H_ */
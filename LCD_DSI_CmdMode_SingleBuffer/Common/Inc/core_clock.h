@@ -0,0 +1,93 @@
+/*
+ * core_clock.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_CLOCK_H_
+#define CORE_CLOCK_H_
+
+#include <stdint.h>
+
+/*
+ * Monotonic 64-bit microsecond clock shared by both cores. TIM2 is a free
+ * running 32-bit counter at 1 MHz, it wraps every 71.6 minutes. M7 counts the
+ * wraps in the update interrupt into the shared high word. Readers combine
+ * both under a sequence lock and add the wrap, which is pending and not yet
+ * counted, so the clock never goes back, not even in an interrupt with higher
+ * priority.
+ *
+ * Compare channel 1 of TIM2 is an alarm of M7, it wakes up M7 at a given time
+ * without any periodic interrupt.
+ */
+
+/* TIM2 update interrupt has to preempt every reader on M7 */
+#define CORE_CLOCK_IRQ_PRIORITY (0U)
+
+/**
+ * @brief Start TIM2 and clear the wrap counter, called by M7 before M4 is
+ *        woken up
+ */
+void core_clock_init(void);
+
+/**
+ * @brief Count the wrap of TIM2, called by M7 from TIM2_IRQHandler
+ */
+void core_clock_irq(void);
+
+/**
+ * @brief Read the clock, safe from any core and interrupt
+ * @return uint64_t microseconds since core_clock_init
+ */
+uint64_t core_clock_us(void);
+
+/**
+ * @brief Read the clock in milliseconds
+ * @return uint64_t milliseconds since core_clock_init
+ */
+uint64_t core_clock_ms(void);
+
+/**
+ * @brief Arm the alarm of M7, TIM2 interrupt calls core_clock_alarm_irq() once
+ *        the clock reaches the time. The previous alarm is replaced, an alarm
+ *        in the past fires at once.
+ * @param us time of the clock
+ */
+void core_clock_alarm(const uint64_t us);
+
+/**
+ * @brief Disarm the alarm of M7
+ */
+void core_clock_alarm_cancel(void);
+
+/**
+ * @brief Check the alarm, called by M7 from TIM2_IRQHandler
+ * @return 1 if the alarm time was reached (the alarm is disarmed), otherwise 0
+ */
+int core_clock_alarm_irq(void);
+
+#endif /* CORE_CLOCK_H_ */
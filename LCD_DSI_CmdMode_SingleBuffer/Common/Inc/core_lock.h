@@ -0,0 +1,108 @@
+/*
+ * core_lock.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_LOCK_H_
+#define CORE_LOCK_H_
+
+#include <stdint.h>
+
+/* Number of inter-core locks */
+#ifndef CORE_LOCK_COUNT
+#define CORE_LOCK_COUNT (4U)
+#endif
+
+/* First HW semaphore used by locks, the lower ones are used for notification */
+#define CORE_HSEM_LOCK_BASE (4U)
+
+/* Index of the core in the statistics */
+#define CORE_LOCK_M7 (0U)
+#define CORE_LOCK_M4 (1U)
+
+/* GPIO and RCC registers configured by both cores, e.g. by BSP_LED_Init() */
+#define CORE_LOCK_GPIO (0U)
+
+/* Statistics of one lock as seen by one core */
+typedef struct {
+   uint32_t acquisitions;    /* successful takes */
+   uint32_t contentions;     /* takes that had to wait */
+   uint32_t spin_cycles;     /* CPU cycles spent waiting, wraps around */
+   uint32_t max_hold_cycles; /* the longest time between take and release */
+} core_lock_stats_t;
+
+/**
+ * @brief Enable HSEM clock and the cycle counter on the current core
+ */
+void core_lock_init(void);
+
+/**
+ * @brief Clear the statistics of all locks, it has to be called in only one
+ *        of the cores
+ */
+void core_lock_clear_stats(void);
+
+/*
+ * The locks are meant for thread context only and they are not recursive.
+ * Interrupts of the core are masked from take to release, so an interrupt
+ * handler can never try to take a lock its own core holds (the HSEM would
+ * grant it again). A second take by the holding core is caught by assert_param.
+ */
+
+/**
+ * @brief Take the lock, spin while the other core holds it. If the other core
+ *        waits for the lock, it gets the lock before this core takes it again.
+ *        Interrupts are masked until core_lock_release().
+ * @param lock index of the lock
+ */
+void core_lock_take(const unsigned int lock);
+
+/**
+ * @brief Try to take the lock without waiting, interrupts are masked until
+ *        core_lock_release() if the lock is acquired
+ * @param lock index of the lock
+ * @return 0 if lock is acquired, -1 if it is held by the other core
+ */
+int core_lock_try(const unsigned int lock);
+
+/**
+ * @brief Release the lock taken by core_lock_take() or core_lock_try()
+ * @param lock index of the lock
+ */
+void core_lock_release(const unsigned int lock);
+
+/**
+ * @brief Read statistics of the lock, it can be called from both cores
+ * @param lock index of the lock
+ * @param core CORE_LOCK_M7 or CORE_LOCK_M4
+ * @param stats
+ */
+void core_lock_get_stats(const unsigned int lock, const unsigned int core,
+                         core_lock_stats_t *const stats);
+
+#endif /* CORE_LOCK_H_ */
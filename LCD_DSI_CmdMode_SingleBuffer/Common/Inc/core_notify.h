@@ -0,0 +1,82 @@
+/*
+ * core_notify.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_NOTIFY_H_
+#define CORE_NOTIFY_H_
+
+#include <stdint.h>
+
+/* HW semaphore used by M7 to wake up M4 after system initialization */
+#define CORE_HSEM_BOOT (0U)
+/* HW semaphore released by M7 when a message for M4 was posted */
+#define CORE_HSEM_TO_M4 (1U)
+/* HW semaphore released by M4 when a message for M7 was posted */
+#define CORE_HSEM_TO_M7 (2U)
+
+/**
+ * @brief Enable HSEM clock and activate notification for the current core.
+ *        On M7 the notification raises HSEM1 IRQ, HAL_HSEM_FreeCallback has
+ *        to activate it again.
+ */
+void core_notify_init(void);
+
+/**
+ * @brief Wake up M4 after system initialization, called by M7
+ */
+void core_notify_boot_m4(void);
+
+/**
+ * @brief Notify M4 that a message was posted, called by M7
+ */
+void core_notify_m4(void);
+
+/**
+ * @brief Notify M7 that a message was posted, called by M4
+ */
+void core_notify_m7(void);
+
+/**
+ * @brief Put M4 (domain D2) into STOP mode until M7 posts a message. Returns
+ *        immediately if there is a pending message already.
+ */
+void core_wait_m7(void);
+
+/**
+ * @brief Like core_wait_m7(), but it returns immediately also if any of the
+ *        mask bits is set in the flag register. It is meant for a peripheral
+ *        whose wakeup line is an event of M4, its flag set before the sleep
+ *        would not wake M4 again.
+ * @param flag status register of the peripheral
+ * @param mask
+ */
+void core_wait_m7_or(volatile const uint32_t *const flag,
+                     const uint32_t mask);
+
+#endif /* CORE_NOTIFY_H_ */
@@ -0,0 +1,163 @@
+/*
+ * core_protocol.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_PROTOCOL_H_
+#define CORE_PROTOCOL_H_
+
+#include <stdint.h>
+
+/* Version of the protocol, increment on every incompatible change */
+#define CORE_MSG_VERSION (1U)
+
+/* Header words in front of every payload (version|type|length, sequence) */
+#define CORE_MSG_HEADER_SIZE (2U)
+
+/* Heater on/off command, M7 -> M4 */
+typedef struct {
+   int32_t on;
+} core_msg_heater_t;
+
+/* Heater duty setpoint in percent (0-100), M7 -> M4 */
+typedef struct {
+   int32_t duty;
+} core_msg_duty_t;
+
+/* Recipe stage with its duration, M7 -> M4 */
+typedef struct {
+   int32_t stage;
+   uint32_t duration_ms;
+} core_msg_stage_t;
+
+/* Heartbeat with free-running counter, both directions */
+typedef struct {
+   uint32_t counter;
+} core_msg_heartbeat_t;
+
+/* Telemetry of the heater side, M4 -> M7 */
+typedef struct {
+   int32_t heater;
+   int32_t temperature;
+   uint32_t faults;
+} core_msg_telemetry_t;
+
+/* Response to a request, carries sequence number of the request, M4 -> M7 */
+typedef struct {
+   uint32_t request_seq;
+   int32_t status; /* 0 request was applied, negative value on error */
+} core_msg_ack_t;
+
+/*
+ * Table of all messages: X(type ID, payload member, payload type). The type
+ * enum, the payload union and the payload lengths are generated from it.
+ */
+#define CORE_MSG_TABLE(X)                                                      \
+   X(CORE_MSG_HEATER, heater, core_msg_heater_t)                               \
+   X(CORE_MSG_DUTY, duty, core_msg_duty_t)                                     \
+   X(CORE_MSG_STAGE, stage, core_msg_stage_t)                                  \
+   X(CORE_MSG_HEARTBEAT, heartbeat, core_msg_heartbeat_t)                      \
+   X(CORE_MSG_TELEMETRY, telemetry, core_msg_telemetry_t)                      \
+   X(CORE_MSG_ACK, ack, core_msg_ack_t)
+
+#define CORE_MSG_ENUM(id, member, type) id,
+typedef enum { CORE_MSG_TABLE(CORE_MSG_ENUM) CORE_MSG_COUNT } core_msg_type_t;
+#undef CORE_MSG_ENUM
+
+typedef struct {
+   uint8_t version;
+   uint8_t type;
+   uint16_t length; /* payload words */
+   uint32_t seq;
+} core_msg_header_t;
+
+#define CORE_MSG_MEMBER(id, member, type) type member;
+typedef struct {
+   core_msg_header_t header;
+   union {
+      CORE_MSG_TABLE(CORE_MSG_MEMBER)
+   } payload;
+} core_msg_t;
+#undef CORE_MSG_MEMBER
+
+/**
+ * @brief Encode message into buffer, header length and version are filled in
+ *        by the type, sequence number is taken from msg
+ * @param msg
+ * @param buffer
+ * @param size size of buffer
+ * @return number of written items, -1 if type is unknown or buffer is small
+ */
+int core_msg_encode(const core_msg_t *const msg, int *const buffer,
+                    const unsigned int size);
+
+/**
+ * @brief Decode message from buffer
+ * @param buffer
+ * @param size items in buffer
+ * @param msg
+ * @return 0 on success, -1 if version, type or length does not match
+ */
+int core_msg_decode(const int *const buffer, const unsigned int size,
+                    core_msg_t *const msg);
+
+/**
+ * @brief Encode message directly into shared memory and send it to M4, the
+ *        sequence number is assigned by the sender
+ * @param msg
+ * @return 0 on success, -1 if queue is full or message is invalid
+ */
+int core_msg_send_to_m4(core_msg_t *const msg);
+
+/**
+ * @brief Encode message directly into shared memory and send it to M7, the
+ *        sequence number is assigned by the sender
+ * @param msg
+ * @return 0 on success, -1 if queue is full or message is invalid
+ */
+int core_msg_send_to_m7(core_msg_t *const msg);
+
+/**
+ * @brief Decode the oldest message from M7 straight from its shared slot
+ *        into msg and release the slot
+ * @param msg
+ * @return 0 on success, -1 if queue is empty, -2 if the message was invalid
+ *         (it is dropped)
+ */
+int core_msg_receive_from_m7(core_msg_t *const msg);
+
+/**
+ * @brief Decode the oldest message from M4 straight from its shared slot
+ *        into msg and release the slot
+ * @param msg
+ * @return 0 on success, -1 if queue is empty, -2 if the message was invalid
+ *         (it is dropped)
+ */
+int core_msg_receive_from_m4(core_msg_t *const msg);
+
+#endif /* CORE_PROTOCOL_H_ */
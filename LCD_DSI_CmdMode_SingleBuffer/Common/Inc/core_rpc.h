@@ -0,0 +1,81 @@
+/*
+ * core_rpc.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_RPC_H_
+#define CORE_RPC_H_
+
+#include "core_protocol.h"
+#include <stdint.h>
+
+/* Maximal number of calls waiting for response at once */
+#ifndef CORE_RPC_SLOTS
+#define CORE_RPC_SLOTS (4U)
+#endif
+
+/* States of a call returned by core_rpc_poll() */
+#define CORE_RPC_DONE (0)
+#define CORE_RPC_PENDING (1)
+#define CORE_RPC_TIMEOUT (-1)
+#define CORE_RPC_INVALID (-2)
+
+/**
+ * @brief Send request to M4 and register it for the response. The call never
+ *        blocks, the result is checked by core_rpc_poll().
+ * @param msg request, its sequence number is used as the call ID
+ * @param timeout_ms how long to wait for the response
+ * @return call handle, -1 if there is no free slot or the queue is full
+ */
+int core_rpc_call_m4(core_msg_t *const msg, const uint32_t timeout_ms);
+
+/**
+ * @brief Check the state of the call, the slot is freed once the call is not
+ *        pending anymore
+ * @param call handle returned by core_rpc_call_m4()
+ * @param status status sent by M4, valid for CORE_RPC_DONE
+ * @return CORE_RPC_DONE, CORE_RPC_PENDING, CORE_RPC_TIMEOUT or
+ *         CORE_RPC_INVALID for unknown handle
+ */
+int core_rpc_poll(const int call, int32_t *const status);
+
+/**
+ * @brief Read all responses sent by M4 and complete the matching calls, it has
+ *        to be called periodically on M7
+ */
+void core_rpc_process(void);
+
+/**
+ * @brief Send response to the request received from M7, called by M4
+ * @param request
+ * @param status 0 request was applied, negative value on error
+ * @return 0 on success, -1 if queue is full
+ */
+int core_rpc_reply_m7(const core_msg_t *const request, const int32_t status);
+
+#endif /* CORE_RPC_H_ */
@@ -0,0 +1,73 @@
+/*
+ * core_snapshot.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CORE_SNAPSHOT_H_
+#define CORE_SNAPSHOT_H_
+
+#include <stdint.h>
+
+/* Fault flags of the heater side */
+#define CORE_FAULT_NONE (0U)
+#define CORE_FAULT_OVERHEAT (1U << 0)
+#define CORE_FAULT_SENSOR (1U << 1)
+
+/* Temperature of a snapshot without a valid measurement */
+#define CORE_SNAPSHOT_NO_TEMPERATURE INT32_MIN
+
+/* Latest state of the heater side published by M4 */
+typedef struct {
+   int32_t heater;      /* 1 heater is on, 0 heater is off */
+   int32_t temperature; /* 0.1 degC or CORE_SNAPSHOT_NO_TEMPERATURE */
+   uint32_t faults;     /* CORE_FAULT_* flags */
+   uint32_t uptime_ms;  /* core clock when published */
+} core_snapshot_t;
+
+/**
+ * @brief Clear the snapshot, it has to be called in only one of the cores
+ */
+void core_snapshot_init(void);
+
+/**
+ * @brief Publish new snapshot, called by M4 (the only writer). It never
+ *        blocks.
+ * @param snapshot
+ */
+void core_snapshot_write(const core_snapshot_t *const snapshot);
+
+/**
+ * @brief Read the latest consistent snapshot, called by M7. It never blocks
+ *        the writer, it retries only while the writer is in the middle of an
+ *        update.
+ * @param snapshot
+ * @return 0 on success, -1 if no consistent copy was read in a few tries
+ */
+int core_snapshot_read(core_snapshot_t *const snapshot);
+
+#endif /* CORE_SNAPSHOT_H_ */
@@ -35,8 +35,22 @@
 #define BUFFSHAREDSIZE 128
 #endif
 
+/* Number of message slots in each direction, has to be power of two */
+#ifndef CORE_RING_DEPTH
+#define CORE_RING_DEPTH 8
+#endif
+
+/* Cortex-M7 L1 cache line size in bytes */
+#ifndef CORE_CACHE_LINE
+#define CORE_CACHE_LINE 32
+#endif
+
+#if (CORE_RING_DEPTH & (CORE_RING_DEPTH - 1)) != 0
+#error "CORE_RING_DEPTH has to be power of two"
+#endif
+
 /**
- * @brief Used to clear the buffer locks and their size holders
+ * @brief Used to clear the ring indexes and their slots
  *        It has to be called in only one of the cores
  */
 void core_share_init(void);
@@ -45,7 +59,7 @@ void core_share_init(void);
  * @brief Send data from M7 to M4
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were transferred
+ * @return -1 if queue is full, otherwise how many items were transferred
  */
 int put_to_m4(const int *const restrict buffer, const unsigned int size);
 
@@ -53,7 +67,7 @@ int put_to_m4(const int *const restrict buffer, const unsigned int size);
  * @brief Get data from M4
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were read
+ * @return -1 if queue is empty, otherwise how many items were read
  */
 int get_from_m4(int *const restrict buffer, unsigned int size);
 
@@ -61,7 +75,7 @@ int get_from_m4(int *const restrict buffer, unsigned int size);
  * @brief Send data from M4 to M7
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were transferred
+ * @return -1 if queue is full, otherwise how many items were transferred
  */
 int put_to_m7(const int *const restrict buffer, const unsigned int size);
 
@@ -69,8 +83,130 @@ int put_to_m7(const int *const restrict buffer, const unsigned int size);
  * @brief Get data from M7
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were read
+ * @return -1 if queue is empty, otherwise how many items were read
  */
 int get_from_m7(int *const restrict buffer, unsigned int size);
 
+/**
+ * @brief Send more messages from M7 to M4 at once, the messages are stored one
+ *        after another in buffer, each of them has size items
+ * @param buffer
+ * @param size size of one message
+ * @param count number of messages
+ * @return how many messages were transferred (0 if queue is full)
+ */
+int put_batch_to_m4(const int *const restrict buffer, const unsigned int size,
+                    const unsigned int count);
+
+/**
+ * @brief Get more messages from M4 at once, the messages are stored one
+ *        after another in buffer, each of them is given size items
+ * @param buffer
+ * @param size size of one message
+ * @param count maximal number of messages
+ * @return how many messages were read (0 if queue is empty)
+ */
+int get_batch_from_m4(int *const restrict buffer, const unsigned int size,
+                      const unsigned int count);
+
+/**
+ * @brief Send more messages from M4 to M7 at once, the messages are stored one
+ *        after another in buffer, each of them has size items
+ * @param buffer
+ * @param size size of one message
+ * @param count number of messages
+ * @return how many messages were transferred (0 if queue is full)
+ */
+int put_batch_to_m7(const int *const restrict buffer, const unsigned int size,
+                    const unsigned int count);
+
+/**
+ * @brief Get more messages from M7 at once, the messages are stored one
+ *        after another in buffer, each of them is given size items
+ * @param buffer
+ * @param size size of one message
+ * @param count maximal number of messages
+ * @return how many messages were read (0 if queue is empty)
+ */
+int get_batch_from_m7(int *const restrict buffer, const unsigned int size,
+                      const unsigned int count);
+
+/**
+ * @brief Number of messages sent by M4 and not read yet
+ * @return unsigned int
+ */
+unsigned int pending_from_m4(void);
+
+/**
+ * @brief Number of messages sent by M7 and not read yet
+ * @return unsigned int
+ */
+unsigned int pending_from_m7(void);
+
+/*
+ * Zero-copy API. The producer reserves a slot, builds the message directly in
+ * the shared memory and commits it. The consumer peeks the message in place and
+ * releases it when done. Every reserve has to be followed by commit or cancel
+ * and every successful peek by release, before the next reserve/peek on the
+ * same queue.
+ */
+
+/**
+ * @brief Reserve a slot for message from M7 to M4
+ * @return pointer to BUFFSHAREDSIZE items, NULL if queue is full
+ */
+int *reserve_to_m4(void);
+
+/**
+ * @brief Publish the slot reserved by reserve_to_m4()
+ * @param size items written into the slot
+ */
+void commit_to_m4(const unsigned int size);
+
+/**
+ * @brief Drop the slot reserved by reserve_to_m4() without sending it
+ */
+void cancel_to_m4(void);
+
+/**
+ * @brief Reserve a slot for message from M4 to M7
+ * @return pointer to BUFFSHAREDSIZE items, NULL if queue is full
+ */
+int *reserve_to_m7(void);
+
+/**
+ * @brief Publish the slot reserved by reserve_to_m7()
+ * @param size items written into the slot
+ */
+void commit_to_m7(const unsigned int size);
+
+/**
+ * @brief Drop the slot reserved by reserve_to_m7() without sending it
+ */
+void cancel_to_m7(void);
+
+/**
+ * @brief Read the oldest message from M4 in place
+ * @param size items in the message
+ * @return pointer to the message, NULL if queue is empty
+ */
+const int *peek_from_m4(unsigned int *const size);
+
+/**
+ * @brief Release the message returned by peek_from_m4()
+ */
+void release_from_m4(void);
+
+/**
+ * @brief Read the oldest message from M7 in place
+ * @param size items in the message
+ * @return pointer to the message, NULL if queue is empty
+ */
+const int *peek_from_m7(unsigned int *const size);
+
+/**
+ * @brief Release the message returned by peek_from_m7()
+ */
+void release_from_m7(void);
+
 #endif /* CORES_COMMUNICATION_H_ */
\ No newline at end of file
@@ -0,0 +1,291 @@
+/*
+ * core_bench.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_bench.h"
+#include "cores_communication.h"
+#include "stm32h7xx_hal.h"
+
+#ifdef CORE_BENCH
+
+/* Kind of the benchmark message, stored in the first item */
+#define BENCH_SYNC (1)
+#define BENCH_PING (2)
+#define BENCH_STREAM (3)
+#define BENCH_STREAM_END (4)
+#define BENCH_STOP (5)
+
+static core_bench_table_t bench_table __attribute__((section(".shared")));
+
+/* Samples of the round trips: send time, M4 receive time, receive time */
+static uint32_t sample_send[CORE_BENCH_ROUNDS];
+static uint32_t sample_m4[CORE_BENCH_ROUNDS];
+static uint32_t sample_recv[CORE_BENCH_ROUNDS];
+
+/**
+ * @brief Read the cycle counter
+ * @return uint32_t
+ */
+static inline uint32_t bench_cycles(void) { return DWT->CYCCNT; }
+
+/**
+ * @brief Enable the cycle counter on the current core
+ */
+static void bench_cycles_init(void)
+{
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Convert M7 cycles to nanoseconds
+ * @param cycles
+ * @return uint32_t
+ */
+static uint32_t bench_ns(const uint32_t cycles)
+{
+   return (uint32_t)(((uint64_t)cycles * 1000000000ULL) / bench_table.m7_hz);
+}
+
+/**
+ * @brief Send message to M4, spin while the queue is full
+ * @param buffer
+ * @param size
+ * @return how many times the queue was full
+ */
+static uint32_t bench_put(const int *const buffer, const unsigned int size)
+{
+   uint32_t full = 0;
+   while (put_to_m4(buffer, size) < 0) {
+      full++;
+      __NOP();
+   }
+   return full;
+}
+
+/**
+ * @brief Wait for message from M4
+ * @param buffer
+ * @return items read
+ */
+static int bench_get(int *const buffer)
+{
+   int n;
+   while ((n = get_from_m4(buffer, BUFFSHAREDSIZE)) < 0) {
+      __NOP();
+   }
+   return n;
+}
+
+/**
+ * @brief Measure round trip and one-way latency of messages with size items
+ * @param result
+ * @param size
+ * @param ratio M7 cycles per one M4 cycle
+ */
+static void bench_latency(core_bench_result_t *const result,
+                          const unsigned int size, const uint32_t ratio)
+{
+   int buffer[BUFFSHAREDSIZE] = {0};
+   uint32_t best = 0;
+   uint64_t sum = 0;
+
+   result->rtt_min = UINT32_MAX;
+   result->rtt_max = 0;
+
+   for (unsigned int i = 0; i < CORE_BENCH_ROUNDS; i++) {
+      buffer[0] = BENCH_PING;
+      sample_send[i] = bench_cycles();
+      bench_put(buffer, size);
+      bench_get(buffer);
+      sample_recv[i] = bench_cycles();
+      sample_m4[i] = (uint32_t)buffer[1];
+
+      const uint32_t rtt = sample_recv[i] - sample_send[i];
+      sum += rtt;
+      if (rtt < result->rtt_min) {
+         result->rtt_min = rtt;
+         best = i;
+      }
+      if (rtt > result->rtt_max) {
+         result->rtt_max = rtt;
+      }
+   }
+
+   /*
+    * The cores have separate cycle counters. The offset between them is
+    * estimated by the fastest round trip, where both directions are assumed
+    * to take the same time.
+    */
+   const uint32_t offset = sample_m4[best] * ratio -
+                           (sample_send[best] + result->rtt_min / 2U);
+
+   uint64_t one_way_sum = 0;
+   result->one_way_min = UINT32_MAX;
+   result->one_way_max = 0;
+   for (unsigned int i = 0; i < CORE_BENCH_ROUNDS; i++) {
+      const uint32_t one_way = sample_m4[i] * ratio - offset - sample_send[i];
+      one_way_sum += one_way;
+      if (one_way < result->one_way_min) {
+         result->one_way_min = one_way;
+      }
+      if (one_way > result->one_way_max) {
+         result->one_way_max = one_way;
+      }
+   }
+
+   result->rtt_min = bench_ns(result->rtt_min);
+   result->rtt_max = bench_ns(result->rtt_max);
+   result->rtt_avg = bench_ns((uint32_t)(sum / CORE_BENCH_ROUNDS));
+   result->one_way_min = bench_ns(result->one_way_min);
+   result->one_way_max = bench_ns(result->one_way_max);
+   result->one_way_avg = bench_ns((uint32_t)(one_way_sum / CORE_BENCH_ROUNDS));
+}
+
+/**
+ * @brief Measure sustained throughput and how often the queue was full
+ * @param result
+ * @param size
+ */
+static void bench_throughput(core_bench_result_t *const result,
+                             const unsigned int size)
+{
+   int buffer[BUFFSHAREDSIZE] = {0};
+   uint32_t full = 0;
+
+   buffer[0] = BENCH_STREAM;
+   const uint32_t start = bench_cycles();
+   for (unsigned int i = 0; i < CORE_BENCH_STREAM - 1U; i++) {
+      full += bench_put(buffer, size);
+   }
+   buffer[0] = BENCH_STREAM_END;
+   full += bench_put(buffer, size);
+
+   /* M4 confirms the last message */
+   bench_get(buffer);
+   const uint32_t cycles = bench_cycles() - start;
+
+   result->msgs_per_s = (uint32_t)(((uint64_t)CORE_BENCH_STREAM *
+                                    bench_table.m7_hz) /
+                                   cycles);
+   result->full_permille =
+       (uint32_t)(((uint64_t)full * 1000U) / (full + CORE_BENCH_STREAM));
+}
+
+/**
+ * @brief Run all scenarios on M7, M4 has to run core_bench_run_m4(). Both
+ *        cores continue with the application afterwards.
+ */
+void core_bench_run_m7(void)
+{
+   int buffer[BUFFSHAREDSIZE] = {0};
+
+   bench_cycles_init();
+   bench_table.done = 0;
+   bench_table.m7_hz = SystemCoreClock;
+
+   /* Wait for M4, it sends its clock back */
+   buffer[0] = BENCH_SYNC;
+   bench_put(buffer, 1);
+   bench_get(buffer);
+   bench_table.m4_hz = (uint32_t)buffer[1];
+
+   const uint32_t ratio = bench_table.m7_hz / bench_table.m4_hz;
+
+   for (unsigned int i = 0; i < CORE_BENCH_SIZES; i++) {
+      core_bench_result_t *const result = &bench_table.result[i];
+      const unsigned int size = BUFFSHAREDSIZE >> (CORE_BENCH_SIZES - 1U - i);
+
+      result->size = size;
+      bench_latency(result, size, ratio);
+      bench_throughput(result, size);
+   }
+
+   buffer[0] = BENCH_STOP;
+   bench_put(buffer, 1);
+   bench_table.done = 1;
+}
+
+/**
+ * @brief Echo benchmark messages on M4 until M7 finishes the scenarios
+ */
+void core_bench_run_m4(void)
+{
+   int buffer[BUFFSHAREDSIZE];
+   uint32_t received = 0;
+
+   bench_cycles_init();
+
+   for (;;) {
+      const int n = get_from_m7(buffer, BUFFSHAREDSIZE);
+      if (n < 1) {
+         __NOP();
+         continue;
+      }
+      const uint32_t now = bench_cycles();
+
+      switch (buffer[0]) {
+      case BENCH_SYNC:
+         buffer[1] = (int)SystemCoreClock;
+         while (put_to_m7(buffer, 2) < 0) {
+            __NOP();
+         }
+         break;
+      case BENCH_PING:
+         /* Answer with the same size, at least with the receive time */
+         buffer[1] = (int)now;
+         while (put_to_m7(buffer, (n < 2) ? 2 : n) < 0) {
+            __NOP();
+         }
+         break;
+      case BENCH_STREAM:
+         received++;
+         break;
+      case BENCH_STREAM_END:
+         buffer[1] = (int)(received + 1U);
+         received = 0;
+         while (put_to_m7(buffer, 2) < 0) {
+            __NOP();
+         }
+         break;
+      case BENCH_STOP:
+         return;
+      default:
+         break;
+      }
+   }
+}
+
+/**
+ * @brief Get the shared results table
+ * @return const core_bench_table_t*
+ */
+const core_bench_table_t *core_bench_results(void) { return &bench_table; }
+
+#endif /* CORE_BENCH */
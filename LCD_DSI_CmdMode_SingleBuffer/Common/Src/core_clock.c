@@ -0,0 +1,200 @@
+/*
+ * core_clock.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_clock.h"
+#include "cores_communication.h"
+#include "stm32h7xx_hal.h"
+#include <stdatomic.h>
+
+#define CLOCK_TIMER TIM2
+#define CLOCK_HZ (1000000UL)
+
+/*
+ * Sequence lock over the wrap counter, odd sequence means M7 is just counting
+ * a wrap. The pending update flag is cleared inside the locked section, so a
+ * reader sees either the flag or the incremented high word, never both.
+ */
+struct _clock {
+   atomic_uint seq __attribute__((aligned(CORE_CACHE_LINE)));
+   atomic_uint high;
+};
+
+static struct _clock clock_data __attribute__((section(".shared")));
+
+/* Alarm time, the compare register holds its low word */
+static uint64_t alarm_us;
+
+/**
+ * @brief Get the TIM2 kernel clock, it is twice the APB1 clock when APB1 is
+ *        divided
+ * @return uint32_t Hz
+ */
+static uint32_t clock_timer_hz(void)
+{
+   const uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+   return (RCC->D2CFGR & RCC_D2CFGR_D2PPRE1) == RCC_APB1_DIV1 ? pclk
+                                                              : 2U * pclk;
+}
+
+/**
+ * @brief Start TIM2 and clear the wrap counter, called by M7 before M4 is
+ *        woken up
+ */
+void core_clock_init(void)
+{
+   atomic_init(&clock_data.seq, 0U);
+   atomic_init(&clock_data.high, 0U);
+
+   __HAL_RCC_TIM2_CLK_ENABLE();
+   CLOCK_TIMER->CR1 = TIM_CR1_URS; /* only the wrap sets update flag */
+   CLOCK_TIMER->PSC = clock_timer_hz() / CLOCK_HZ - 1U;
+   CLOCK_TIMER->ARR = UINT32_MAX;
+   CLOCK_TIMER->CNT = 0;
+   CLOCK_TIMER->EGR = TIM_EGR_UG; /* load the prescaler */
+   CLOCK_TIMER->SR = 0;
+   CLOCK_TIMER->DIER = TIM_DIER_UIE;
+
+   HAL_NVIC_SetPriority(TIM2_IRQn, CORE_CLOCK_IRQ_PRIORITY, 0);
+   HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+   CLOCK_TIMER->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+ * @brief Count the wrap of TIM2, called by M7 from TIM2_IRQHandler
+ */
+void core_clock_irq(void)
+{
+   if ((CLOCK_TIMER->SR & TIM_SR_UIF) == 0) {
+      return;
+   }
+
+   const unsigned int seq =
+       atomic_load_explicit(&clock_data.seq, memory_order_relaxed);
+   atomic_store_explicit(&clock_data.seq, seq + 1U, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+
+   CLOCK_TIMER->SR = ~(uint32_t)TIM_SR_UIF;
+   atomic_fetch_add_explicit(&clock_data.high, 1U, memory_order_relaxed);
+
+   atomic_store_explicit(&clock_data.seq, seq + 2U, memory_order_release);
+}
+
+/**
+ * @brief Read the clock, safe from any core and interrupt
+ * @return uint64_t microseconds since core_clock_init
+ */
+uint64_t core_clock_us(void)
+{
+   unsigned int begin;
+   uint32_t high;
+   uint32_t low;
+   uint32_t pending;
+
+   do {
+      begin = atomic_load_explicit(&clock_data.seq, memory_order_acquire);
+      high = atomic_load_explicit(&clock_data.high, memory_order_relaxed);
+      low = CLOCK_TIMER->CNT;
+      pending = CLOCK_TIMER->SR & TIM_SR_UIF;
+      /* Counter and flag have to be read before the sequence is checked */
+      atomic_thread_fence(memory_order_acquire);
+   } while ((begin & 1U) ||
+            begin != atomic_load_explicit(&clock_data.seq,
+                                          memory_order_relaxed));
+
+   /* Wrap not counted yet, unless the counter was read just before it */
+   if (pending && low < 0x80000000UL) {
+      high++;
+   }
+   return ((uint64_t)high << 32) | low;
+}
+
+/**
+ * @brief Read the clock in milliseconds
+ * @return uint64_t milliseconds since core_clock_init
+ */
+uint64_t core_clock_ms(void) { return core_clock_us() / 1000U; }
+
+/**
+ * @brief Arm the alarm of M7, TIM2 interrupt calls core_clock_alarm_irq() once
+ *        the clock reaches the time. The previous alarm is replaced, an alarm
+ *        in the past fires at once.
+ * @param us time of the clock
+ */
+void core_clock_alarm(const uint64_t us)
+{
+   /* TIM2 interrupt disarms the alarm by the same register */
+   const uint32_t primask = __get_PRIMASK();
+   __disable_irq();
+
+   alarm_us = us;
+   CLOCK_TIMER->CCR1 = (uint32_t)us;
+   CLOCK_TIMER->SR = ~(uint32_t)TIM_SR_CC1IF;
+   CLOCK_TIMER->DIER |= TIM_DIER_CC1IE;
+
+   /* The compare matches only when the counter passes the register */
+   if (core_clock_us() >= us) {
+      CLOCK_TIMER->EGR = TIM_EGR_CC1G;
+   }
+
+   __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Disarm the alarm of M7
+ */
+void core_clock_alarm_cancel(void)
+{
+   const uint32_t primask = __get_PRIMASK();
+   __disable_irq();
+   CLOCK_TIMER->DIER &= ~(uint32_t)TIM_DIER_CC1IE;
+   __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Check the alarm, called by M7 from TIM2_IRQHandler
+ * @return 1 if the alarm time was reached (the alarm is disarmed), otherwise 0
+ */
+int core_clock_alarm_irq(void)
+{
+   if ((CLOCK_TIMER->DIER & TIM_DIER_CC1IE) == 0 ||
+       (CLOCK_TIMER->SR & TIM_SR_CC1IF) == 0) {
+      return 0;
+   }
+   CLOCK_TIMER->SR = ~(uint32_t)TIM_SR_CC1IF;
+
+   /* The low word matches once per wrap, a later alarm stays armed */
+   if (core_clock_us() < alarm_us) {
+      return 0;
+   }
+
+   CLOCK_TIMER->DIER &= ~(uint32_t)TIM_DIER_CC1IE;
+   return 1;
+}
@@ -30,149 +30,439 @@
 
 #include "cores_communication.h"
 #include <stdatomic.h>
+#include <stddef.h>
+
+#define RING_MASK (CORE_RING_DEPTH - 1U)
+
+/* One message, aligned to the cache line to not share line with neighbours */
+struct _slot {
+   unsigned int size;
+   int buffer[BUFFSHAREDSIZE];
+} __attribute__((aligned(CORE_CACHE_LINE)));
+
+/*
+ * Single producer / single consumer ring. The head is written only by the
+ * producer, the tail only by the consumer. Both are free-running counters and
+ * each of them lives in its own cache line.
+ */
+struct _ring {
+   atomic_uint head __attribute__((aligned(CORE_CACHE_LINE)));
+   atomic_uint tail __attribute__((aligned(CORE_CACHE_LINE)));
+   struct _slot slots[CORE_RING_DEPTH];
+};
 
 struct _shared {
-   atomic_bool lock1, lock2;
-   int buffer1[BUFFSHAREDSIZE], buffer2[BUFFSHAREDSIZE];
-   unsigned int buffer1_size, buffer2_size;
+   struct _ring to_m4, to_m7;
 };
 
 static struct _shared shared_data __attribute__((section(".shared")));
 
 /**
- * @brief Used to clear the buffer locks and their size holders
+ * @brief Clear indexes of the ring
+ * @param ring
+ */
+static void ring_init(struct _ring *const ring)
+{
+   atomic_init(&ring->head, 0U);
+   atomic_init(&ring->tail, 0U);
+   for (unsigned int i = 0; i < CORE_RING_DEPTH; i++) {
+      ring->slots[i].size = 0;
+   }
+}
+
+/**
+ * @brief Enqueue up to count messages and publish them by one head update
+ * @param ring
+ * @param buffer messages stored one after another
+ * @param size size of one message
+ * @param count number of messages
+ * @return how many messages were enqueued
+ */
+static unsigned int ring_put(struct _ring *const ring,
+                             const int *const restrict buffer,
+                             const unsigned int size, const unsigned int count)
+{
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_relaxed);
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+   /* Never overwrite messages the consumer has not read yet */
+   const unsigned int space = CORE_RING_DEPTH - (head - tail);
+   const unsigned int n = (count <= space) ? count : space;
+
+   /* Limit size of message to be transfered to the size of destine slot */
+   const unsigned int items = (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
+
+   for (unsigned int m = 0; m < n; m++) {
+      struct _slot *const slot = &ring->slots[(head + m) & RING_MASK];
+      const int *const src = &buffer[m * size];
+
+      /* Copy from buffer[] to slot.buffer[] */
+      for (unsigned int i = 0; i < items; i++) {
+         slot->buffer[i] = src[i];
+      }
+      slot->size = items;
+   }
+
+   /* Publish all written slots at once */
+   if (n > 0) {
+      atomic_store_explicit(&ring->head, head + n, memory_order_release);
+   }
+
+   return n;
+}
+
+/**
+ * @brief Dequeue up to count messages and release them by one tail update
+ * @param ring
+ * @param buffer place for messages stored one after another
+ * @param size maximal size of one message
+ * @param count maximal number of messages
+ * @param last_size items in the last dequeued message
+ * @return how many messages were dequeued
+ */
+static unsigned int ring_get(struct _ring *const ring,
+                             int *const restrict buffer,
+                             const unsigned int size, const unsigned int count,
+                             unsigned int *const last_size)
+{
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_relaxed);
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_acquire);
+
+   const unsigned int used = head - tail;
+   const unsigned int n = (count <= used) ? count : used;
+
+   for (unsigned int m = 0; m < n; m++) {
+      const struct _slot *const slot = &ring->slots[(tail + m) & RING_MASK];
+      int *const dst = &buffer[m * size];
+
+      /* Verify whether we are trying to read more items than are available */
+      const unsigned int items = (size <= slot->size) ? size : slot->size;
+
+      /* Copy items from slot.buffer[] to buffer[] */
+      for (unsigned int i = 0; i < items; i++) {
+         dst[i] = slot->buffer[i];
+      }
+      *last_size = items;
+   }
+
+   /* Give all read slots back to the producer at once */
+   if (n > 0) {
+      atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+   }
+
+   return n;
+}
+
+/**
+ * @brief Get next free slot of the ring without publishing it
+ * @param ring
+ * @return pointer to the slot buffer, NULL if ring is full
+ */
+static int *ring_reserve(struct _ring *const ring)
+{
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_relaxed);
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+   if (head - tail >= CORE_RING_DEPTH) {
+      return NULL;
+   }
+
+   return ring->slots[head & RING_MASK].buffer;
+}
+
+/**
+ * @brief Publish the slot returned by ring_reserve()
+ * @param ring
+ * @param size items written into the slot
+ */
+static void ring_commit(struct _ring *const ring, const unsigned int size)
+{
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+   ring->slots[head & RING_MASK].size =
+       (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
+   atomic_store_explicit(&ring->head, head + 1U, memory_order_release);
+}
+
+/**
+ * @brief Drop the slot returned by ring_reserve(), the head is moved only by
+ *        ring_commit() so the consumer never sees the slot and the next
+ *        reserve returns it again
+ * @param ring
+ */
+static void ring_cancel(struct _ring *const ring) { (void)ring; }
+
+/**
+ * @brief Get the oldest message of the ring without removing it
+ * @param ring
+ * @param size items in the message
+ * @return pointer to the slot buffer, NULL if ring is empty
+ */
+static const int *ring_peek(struct _ring *const ring,
+                            unsigned int *const size)
+{
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_relaxed);
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_acquire);
+
+   if (head == tail) {
+      return NULL;
+   }
+
+   const struct _slot *const slot = &ring->slots[tail & RING_MASK];
+   *size = slot->size;
+   return slot->buffer;
+}
+
+/**
+ * @brief Give the slot returned by ring_peek() back to the producer
+ * @param ring
+ */
+static void ring_release(struct _ring *const ring)
+{
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+   atomic_store_explicit(&ring->tail, tail + 1U, memory_order_release);
+}
+
+/**
+ * @brief Number of messages available for the consumer
+ * @param ring
+ * @return unsigned int
+ */
+static unsigned int ring_pending(struct _ring *const ring)
+{
+   const unsigned int tail =
+       atomic_load_explicit(&ring->tail, memory_order_relaxed);
+   const unsigned int head =
+       atomic_load_explicit(&ring->head, memory_order_acquire);
+
+   return head - tail;
+}
+
+/**
+ * @brief Used to clear the ring indexes and their slots
  *        It has to be called in only one of the cores
  */
 void core_share_init(void)
 {
-   atomic_flag_clear(&shared_data.lock1);
-   atomic_flag_clear(&shared_data.lock2);
-   shared_data.buffer1_size = 0;
-   shared_data.buffer2_size = 0;
+   ring_init(&shared_data.to_m4);
+   ring_init(&shared_data.to_m7);
 }
 
 /**
  * @brief Send data from M7 to M4
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were transfered
+ * @return -1 if queue is full, otherwise how many items were transfered
  */
 int put_to_m4(const int *const restrict buffer, const unsigned int size)
 {
-   /* Try and get lock */
-   if (atomic_flag_test_and_set(&shared_data.lock1)) {
-      /* Return -1 in case lock is not acquired (used by other core)*/
+   if (ring_put(&shared_data.to_m4, buffer, size, 1) == 0) {
+      /* Return -1 in case there is no free slot (M4 did not read yet) */
       return -1;
    }
 
-   /* Limit size of buffer to be transfered to the size of destine buffer */
-   shared_data.buffer1_size = (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
-
-   /* Copy from buffer[] to shared_data.buffer[] */
-   for (unsigned int i = 0; i < shared_data.buffer1_size; i++) {
-      shared_data.buffer1[i] = buffer[i];
-   }
-
-   /* Clear lock */
-   atomic_flag_clear(&shared_data.lock1);
-
    /* Return how many items were transfered */
-   return shared_data.buffer1_size;
+   return (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
 }
 
 /**
  * @brief Get data from M4
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were read
+ * @return -1 if queue is empty, otherwise how many items were read
  */
 int get_from_m4(int *const restrict buffer, unsigned int size)
 {
-   /* Try and get lock */
-   if (atomic_flag_test_and_set(&shared_data.lock2)) {
-      /* Return -1 in case lock is not acquired (used by other core)*/
-      return -1;
-   }
-
-   /* Verify whether we are trying to read more items than are available */
-   if (size >= shared_data.buffer2_size) {
-      size = shared_data.buffer2_size;
-   }
+   unsigned int read = 0;
 
-   /* Copy items from shared_data.buffer[] to buffer[] */
-   for (unsigned int i = 0; i < size; i++) {
-      buffer[i] = shared_data.buffer2[i];
+   if (ring_get(&shared_data.to_m7, buffer, size, 1, &read) == 0) {
+      /* Return -1 in case there is no message available */
+      return -1;
    }
 
-   /* Clear shared_data.buffer_size (there is no more data available) */
-   shared_data.buffer2_size = 0;
-
-   /* Clear lock */
-   atomic_flag_clear(&shared_data.lock2);
-
    /* Return how many items were read */
-   return size;
+   return read;
 }
 
 /**
  * @brief Send data from M4 to M7
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were transfered
+ * @return -1 if queue is full, otherwise how many items were transfered
  */
 int put_to_m7(const int *const restrict buffer, const unsigned int size)
 {
-   /* Try and get lock */
-   if (atomic_flag_test_and_set(&shared_data.lock2)) {
-      /* Return -1 in case lock is not acquired (used by other core)*/
+   if (ring_put(&shared_data.to_m7, buffer, size, 1) == 0) {
+      /* Return -1 in case there is no free slot (M7 did not read yet) */
       return -1;
    }
 
-   /* Limit size of buffer to be transfered to the size of destine buffer */
-   shared_data.buffer2_size = (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
-
-   /* Copy from buffer[] to shared_data.buffer[] */
-   for (unsigned int i = 0; i < shared_data.buffer2_size; i++) {
-      shared_data.buffer2[i] = buffer[i];
-   }
-
-   /* Clear lock */
-   atomic_flag_clear(&shared_data.lock2);
-
    /* Return how many items were transfered */
-   return shared_data.buffer2_size;
+   return (size <= BUFFSHAREDSIZE) ? size : BUFFSHAREDSIZE;
 }
 
 /**
  * @brief Get data from M7
  * @param buffer
  * @param size
- * @return -1 if lock is not acquired, otherwise how many items were read
+ * @return -1 if queue is empty, otherwise how many items were read
  */
 int get_from_m7(int *const restrict buffer, unsigned int size)
 {
-   /* Try and get lock */
-   if (atomic_flag_test_and_set(&shared_data.lock1)) {
-      /* Return -1 in case lock is not acquired (used by other core)*/
+   unsigned int read = 0;
+
+   if (ring_get(&shared_data.to_m4, buffer, size, 1, &read) == 0) {
+      /* Return -1 in case there is no message available */
       return -1;
    }
 
-   /* Verify whether we are trying to read more items than are available */
-   if (size >= shared_data.buffer1_size) {
-      size = shared_data.buffer1_size;
-   }
+   /* Return how many items were read */
+   return read;
+}
 
-   /* Copy items from shared_data.buffer[] to buffer[] */
-   for (unsigned int i = 0; i < size; i++) {
-      buffer[i] = shared_data.buffer1[i];
-   }
+/**
+ * @brief Send more messages from M7 to M4 at once
+ * @param buffer
+ * @param size size of one message
+ * @param count number of messages
+ * @return how many messages were transferred (0 if queue is full)
+ */
+int put_batch_to_m4(const int *const restrict buffer, const unsigned int size,
+                    const unsigned int count)
+{
+   return ring_put(&shared_data.to_m4, buffer, size, count);
+}
 
-   /* Clear shared_data.buffer_size (there is no more data available) */
-   shared_data.buffer1_size = 0;
+/**
+ * @brief Get more messages from M4 at once
+ * @param buffer
+ * @param size size of one message
+ * @param count maximal number of messages
+ * @return how many messages were read (0 if queue is empty)
+ */
+int get_batch_from_m4(int *const restrict buffer, const unsigned int size,
+                      const unsigned int count)
+{
+   unsigned int read = 0;
+   return ring_get(&shared_data.to_m7, buffer, size, count, &read);
+}
 
-   /* Clear lock */
-   atomic_flag_clear(&shared_data.lock1);
+/**
+ * @brief Send more messages from M4 to M7 at once
+ * @param buffer
+ * @param size size of one message
+ * @param count number of messages
+ * @return how many messages were transferred (0 if queue is full)
+ */
+int put_batch_to_m7(const int *const restrict buffer, const unsigned int size,
+                    const unsigned int count)
+{
+   return ring_put(&shared_data.to_m7, buffer, size, count);
+}
 
-   /* Return how many items were read */
-   return size;
+/**
+ * @brief Get more messages from M7 at once
+ * @param buffer
+ * @param size size of one message
+ * @param count maximal number of messages
+ * @return how many messages were read (0 if queue is empty)
+ */
+int get_batch_from_m7(int *const restrict buffer, const unsigned int size,
+                      const unsigned int count)
+{
+   unsigned int read = 0;
+   return ring_get(&shared_data.to_m4, buffer, size, count, &read);
 }
+
+/**
+ * @brief Number of messages sent by M4 and not read yet
+ * @return unsigned int
+ */
+unsigned int pending_from_m4(void) { return ring_pending(&shared_data.to_m7); }
+
+/**
+ * @brief Number of messages sent by M7 and not read yet
+ * @return unsigned int
+ */
+unsigned int pending_from_m7(void) { return ring_pending(&shared_data.to_m4); }
+
+/**
+ * @brief Reserve a slot for message from M7 to M4
+ * @return pointer to BUFFSHAREDSIZE items, NULL if queue is full
+ */
+int *reserve_to_m4(void) { return ring_reserve(&shared_data.to_m4); }
+
+/**
+ * @brief Publish the slot reserved by reserve_to_m4()
+ * @param size items written into the slot
+ */
+void commit_to_m4(const unsigned int size)
+{
+   ring_commit(&shared_data.to_m4, size);
+}
+
+/**
+ * @brief Drop the slot reserved by reserve_to_m4() without sending it
+ */
+void cancel_to_m4(void) { ring_cancel(&shared_data.to_m4); }
+
+/**
+ * @brief Reserve a slot for message from M4 to M7
+ * @return pointer to BUFFSHAREDSIZE items, NULL if queue is full
+ */
+int *reserve_to_m7(void) { return ring_reserve(&shared_data.to_m7); }
+
+/**
+ * @brief Publish the slot reserved by reserve_to_m7()
+ * @param size items written into the slot
+ */
+void commit_to_m7(const unsigned int size)
+{
+   ring_commit(&shared_data.to_m7, size);
+}
+
+/**
+ * @brief Drop the slot reserved by reserve_to_m7() without sending it
+ */
+void cancel_to_m7(void) { ring_cancel(&shared_data.to_m7); }
+
+/**
+ * @brief Read the oldest message from M4 in place
+ * @param size items in the message
+ * @return pointer to the message, NULL if queue is empty
+ */
+const int *peek_from_m4(unsigned int *const size)
+{
+   return ring_peek(&shared_data.to_m7, size);
+}
+
+/**
+ * @brief Release the message returned by peek_from_m4()
+ */
+void release_from_m4(void) { ring_release(&shared_data.to_m7); }
+
+/**
+ * @brief Read the oldest message from M7 in place
+ * @param size items in the message
+ * @return pointer to the message, NULL if queue is empty
+ */
+const int *peek_from_m7(unsigned int *const size)
+{
+   return ring_peek(&shared_data.to_m4, size);
+}
+
+/**
+ * @brief Release the message returned by peek_from_m7()
+ */
+void release_from_m7(void) { ring_release(&shared_data.to_m4); }
@@ -0,0 +1,273 @@
+/*
+ * core_lock.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_lock.h"
+#include "cores_communication.h"
+#include "stm32h7xx_hal.h"
+#include <stdatomic.h>
+
+/* Owner of a lock which was never taken */
+#define LOCK_NOBODY (2U)
+
+/* Statistics are written only by the core they belong to */
+struct _lock_stats {
+   atomic_uint acquisitions;
+   atomic_uint contentions;
+   atomic_uint spin_cycles;
+   atomic_uint max_hold_cycles;
+};
+
+/* State of a held lock, used only by the core which holds it */
+struct _lock_held {
+   uint32_t held;      /* the core holds the lock */
+   uint32_t primask;   /* interrupt mask before the take */
+   uint32_t take_time; /* cycle counter at the take */
+};
+
+struct _lock {
+   atomic_uint waiting[2]; /* the core spins for the lock */
+   atomic_uint owner;      /* the core which took the lock last */
+   struct _lock_stats stats[2];
+} __attribute__((aligned(CORE_CACHE_LINE)));
+
+static struct _lock lock_data[CORE_LOCK_COUNT]
+    __attribute__((section(".shared")));
+
+/* Each core uses only its own row, both are kept so that the same code works
+ * when the cores are emulated by threads of one process */
+static struct _lock_held lock_held[2][CORE_LOCK_COUNT];
+
+/**
+ * @brief Index of the current core
+ * @return CORE_LOCK_M7 or CORE_LOCK_M4
+ */
+static inline unsigned int lock_self(void)
+{
+   return (HAL_GetCurrentCPUID() == CM7_CPUID) ? CORE_LOCK_M7 : CORE_LOCK_M4;
+}
+
+/**
+ * @brief Read the cycle counter
+ * @return uint32_t
+ */
+static inline uint32_t lock_cycles(void) { return DWT->CYCCNT; }
+
+/**
+ * @brief Update statistics of the core after successful take
+ * @param stats
+ * @param spin cycles spent waiting
+ * @param contended
+ */
+static void lock_count(struct _lock_stats *const stats, const uint32_t spin,
+                       const uint8_t contended)
+{
+   atomic_store_explicit(
+       &stats->acquisitions,
+       atomic_load_explicit(&stats->acquisitions, memory_order_relaxed) + 1U,
+       memory_order_relaxed);
+   if (contended) {
+      atomic_store_explicit(
+          &stats->contentions,
+          atomic_load_explicit(&stats->contentions, memory_order_relaxed) + 1U,
+          memory_order_relaxed);
+      atomic_store_explicit(
+          &stats->spin_cycles,
+          atomic_load_explicit(&stats->spin_cycles, memory_order_relaxed) +
+              spin,
+          memory_order_relaxed);
+   }
+}
+
+/**
+ * @brief Enable HSEM clock and the cycle counter on the current core
+ */
+void core_lock_init(void)
+{
+   /* HW semaphore Clock enable */
+   __HAL_RCC_HSEM_CLK_ENABLE();
+
+   /* Enable DWT cycle counter */
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Clear the statistics of all locks, it has to be called in only one
+ *        of the cores
+ */
+void core_lock_clear_stats(void)
+{
+   for (unsigned int i = 0; i < CORE_LOCK_COUNT; i++) {
+      struct _lock *const l = &lock_data[i];
+      atomic_init(&l->owner, LOCK_NOBODY);
+      for (unsigned int core = 0; core < 2; core++) {
+         atomic_init(&l->waiting[core], 0U);
+         atomic_init(&l->stats[core].acquisitions, 0U);
+         atomic_init(&l->stats[core].contentions, 0U);
+         atomic_init(&l->stats[core].spin_cycles, 0U);
+         atomic_init(&l->stats[core].max_hold_cycles, 0U);
+      }
+   }
+}
+
+/**
+ * @brief Take the lock, spin while the other core holds it. If the other core
+ *        waits for the lock, it gets the lock before this core takes it again.
+ *        Interrupts are masked until core_lock_release().
+ * @param lock index of the lock
+ */
+void core_lock_take(const unsigned int lock)
+{
+   struct _lock *const l = &lock_data[lock];
+   const unsigned int self = lock_self();
+   struct _lock_held *const h = &lock_held[self][lock];
+   const uint32_t start = lock_cycles();
+   uint8_t contended = 0;
+
+   /* The HSEM is granted again to the core which holds it */
+   assert_param(!h->held);
+
+   for (;;) {
+      /* Hand the lock off to the other core if it waits for our release */
+      const uint8_t handoff =
+          atomic_load_explicit(&l->waiting[self ^ 1U],
+                               memory_order_acquire) &&
+          atomic_load_explicit(&l->owner, memory_order_relaxed) == self;
+
+      if (!handoff) {
+         /* Interrupts are served while spinning, masked once it is held */
+         const uint32_t primask = __get_PRIMASK();
+         __disable_irq();
+         if (HAL_HSEM_FastTake(CORE_HSEM_LOCK_BASE + lock) == HAL_OK) {
+            h->primask = primask;
+            break;
+         }
+         __set_PRIMASK(primask);
+      }
+
+      if (!contended) {
+         contended = 1;
+         atomic_store_explicit(&l->waiting[self], 1U, memory_order_release);
+      }
+   }
+
+   const uint32_t now = lock_cycles();
+   atomic_store_explicit(&l->owner, self, memory_order_relaxed);
+   atomic_store_explicit(&l->waiting[self], 0U, memory_order_release);
+   atomic_thread_fence(memory_order_acquire);
+
+   h->held = 1;
+   h->take_time = now;
+   lock_count(&l->stats[self], now - start, contended);
+}
+
+/**
+ * @brief Try to take the lock without waiting, interrupts are masked until
+ *        core_lock_release() if the lock is acquired
+ * @param lock index of the lock
+ * @return 0 if lock is acquired, -1 if it is held by the other core
+ */
+int core_lock_try(const unsigned int lock)
+{
+   struct _lock *const l = &lock_data[lock];
+   const unsigned int self = lock_self();
+   struct _lock_held *const h = &lock_held[self][lock];
+
+   assert_param(!h->held);
+
+   const uint32_t primask = __get_PRIMASK();
+   __disable_irq();
+   if (HAL_HSEM_FastTake(CORE_HSEM_LOCK_BASE + lock) != HAL_OK) {
+      __set_PRIMASK(primask);
+      atomic_store_explicit(
+          &l->stats[self].contentions,
+          atomic_load_explicit(&l->stats[self].contentions,
+                               memory_order_relaxed) +
+              1U,
+          memory_order_relaxed);
+      return -1;
+   }
+
+   atomic_store_explicit(&l->owner, self, memory_order_relaxed);
+   atomic_thread_fence(memory_order_acquire);
+
+   h->held = 1;
+   h->primask = primask;
+   h->take_time = lock_cycles();
+   lock_count(&l->stats[self], 0, 0);
+   return 0;
+}
+
+/**
+ * @brief Release the lock taken by core_lock_take() or core_lock_try()
+ * @param lock index of the lock
+ */
+void core_lock_release(const unsigned int lock)
+{
+   struct _lock *const l = &lock_data[lock];
+   const unsigned int self = lock_self();
+   struct _lock_held *const h = &lock_held[self][lock];
+   const uint32_t hold = lock_cycles() - h->take_time;
+
+   assert_param(h->held);
+
+   if (hold > atomic_load_explicit(&l->stats[self].max_hold_cycles,
+                                   memory_order_relaxed)) {
+      atomic_store_explicit(&l->stats[self].max_hold_cycles, hold,
+                            memory_order_relaxed);
+   }
+   h->held = 0;
+
+   /* All writes done under the lock have to be visible before release */
+   atomic_thread_fence(memory_order_release);
+   HAL_HSEM_Release(CORE_HSEM_LOCK_BASE + lock, 0);
+   __set_PRIMASK(h->primask);
+}
+
+/**
+ * @brief Read statistics of the lock, it can be called from both cores
+ * @param lock index of the lock
+ * @param core CORE_LOCK_M7 or CORE_LOCK_M4
+ * @param stats
+ */
+void core_lock_get_stats(const unsigned int lock, const unsigned int core,
+                         core_lock_stats_t *const stats)
+{
+   const struct _lock_stats *const s = &lock_data[lock].stats[core];
+
+   stats->acquisitions =
+       atomic_load_explicit(&s->acquisitions, memory_order_relaxed);
+   stats->contentions =
+       atomic_load_explicit(&s->contentions, memory_order_relaxed);
+   stats->spin_cycles =
+       atomic_load_explicit(&s->spin_cycles, memory_order_relaxed);
+   stats->max_hold_cycles =
+       atomic_load_explicit(&s->max_hold_cycles, memory_order_relaxed);
+}
@@ -0,0 +1,113 @@
+/*
+ * core_notify.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_notify.h"
+#include "cores_communication.h"
+#include "stm32h7xx_hal.h"
+#include <stddef.h>
+
+/**
+ * @brief Take and release the semaphore, every core with activated
+ *        notification on it gets an event
+ * @param id HW semaphore ID
+ */
+static void core_notify(const uint32_t id)
+{
+   if (HAL_HSEM_FastTake(id) == HAL_OK) {
+      HAL_HSEM_Release(id, 0);
+   }
+}
+
+/**
+ * @brief Enable HSEM clock and activate notification for the current core
+ */
+void core_notify_init(void)
+{
+   /* HW semaphore Clock enable */
+   __HAL_RCC_HSEM_CLK_ENABLE();
+
+#if defined(CORE_CM4)
+   /* M4 is woken up by the HSEM EXTI event, no IRQ is used */
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+#elif defined(CORE_CM7)
+   /* M7 sleeps in WFI, it is woken up by the HSEM IRQ */
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_NVIC_SetPriority(HSEM1_IRQn, 10, 0);
+   HAL_NVIC_EnableIRQ(HSEM1_IRQn);
+#endif
+}
+
+/**
+ * @brief Wake up M4 after system initialization, called by M7
+ */
+void core_notify_boot_m4(void) { core_notify(CORE_HSEM_BOOT); }
+
+/**
+ * @brief Notify M4 that a message was posted, called by M7
+ */
+void core_notify_m4(void) { core_notify(CORE_HSEM_TO_M4); }
+
+/**
+ * @brief Notify M7 that a message was posted, called by M4
+ */
+void core_notify_m7(void) { core_notify(CORE_HSEM_TO_M7); }
+
+/**
+ * @brief Put M4 (domain D2) into STOP mode until M7 posts a message. Returns
+ *        immediately if there is a pending message already.
+ */
+void core_wait_m7(void) { core_wait_m7_or(NULL, 0); }
+
+/**
+ * @brief Like core_wait_m7(), but it returns immediately also if any of the
+ *        mask bits is set in the flag register. It is meant for a peripheral
+ *        whose wakeup line is an event of M4, its flag set before the sleep
+ *        would not wake M4 again.
+ * @param flag status register of the peripheral
+ * @param mask
+ */
+void core_wait_m7_or(volatile const uint32_t *const flag, const uint32_t mask)
+{
+   /* Clear the flag first, so the next release generates a new event */
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+
+   /* Clear pending events, a message posted from now on keeps the event */
+   HAL_PWREx_ClearPendingEvent();
+
+   /* Message posted or flag set before the events were cleared */
+   if (pending_from_m7() > 0 || (flag != NULL && (*flag & mask) != 0U)) {
+      return;
+   }
+
+   HAL_PWREx_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFE,
+                           PWR_D2_DOMAIN);
+}
@@ -0,0 +1,215 @@
+/*
+ * core_protocol.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_protocol.h"
+#include "cores_communication.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Payload length in items of every message type, generated from the table */
+#define CORE_MSG_LENGTH(id, member, type)                                      \
+   [id] = (uint16_t)(sizeof(type) / sizeof(int)),
+static const uint16_t msg_length[CORE_MSG_COUNT] = {
+    CORE_MSG_TABLE(CORE_MSG_LENGTH)};
+#undef CORE_MSG_LENGTH
+
+/* Every payload has to be made of whole items and fit into one slot */
+#define CORE_MSG_CHECK(id, member, type)                                       \
+   _Static_assert(sizeof(type) % sizeof(int) == 0,                             \
+                  #type " is not made of whole items");                       \
+   _Static_assert(sizeof(type) / sizeof(int) + CORE_MSG_HEADER_SIZE <=         \
+                      BUFFSHAREDSIZE,                                          \
+                  #type " does not fit into shared buffer");
+CORE_MSG_TABLE(CORE_MSG_CHECK)
+#undef CORE_MSG_CHECK
+
+/* Sequence numbers of messages sent by this core */
+static uint32_t seq_to_m4, seq_to_m7;
+
+/**
+ * @brief Encode message into buffer, header length and version are filled in
+ *        by the type, sequence number is taken from msg
+ * @param msg
+ * @param buffer
+ * @param size size of buffer
+ * @return number of written items, -1 if type is unknown or buffer is small
+ */
+int core_msg_encode(const core_msg_t *const msg, int *const buffer,
+                    const unsigned int size)
+{
+   if (msg->header.type >= CORE_MSG_COUNT) {
+      return -1;
+   }
+
+   const unsigned int length = msg_length[msg->header.type];
+   if (length + CORE_MSG_HEADER_SIZE > size) {
+      return -1;
+   }
+
+   buffer[0] = (int)((CORE_MSG_VERSION << 24) |
+                     ((uint32_t)msg->header.type << 16) | length);
+   buffer[1] = (int)msg->header.seq;
+   memcpy(&buffer[CORE_MSG_HEADER_SIZE], &msg->payload, length * sizeof(int));
+
+   return (int)(length + CORE_MSG_HEADER_SIZE);
+}
+
+/**
+ * @brief Decode message from buffer
+ * @param buffer
+ * @param size items in buffer
+ * @param msg
+ * @return 0 on success, -1 if version, type or length does not match
+ */
+int core_msg_decode(const int *const buffer, const unsigned int size,
+                    core_msg_t *const msg)
+{
+   if (size < CORE_MSG_HEADER_SIZE) {
+      return -1;
+   }
+
+   const uint32_t word = (uint32_t)buffer[0];
+   const uint8_t version = (uint8_t)(word >> 24);
+   const uint8_t type = (uint8_t)(word >> 16);
+   const uint16_t length = (uint16_t)word;
+
+   if (version != CORE_MSG_VERSION || type >= CORE_MSG_COUNT ||
+       length != msg_length[type] || length + CORE_MSG_HEADER_SIZE > size) {
+      return -1;
+   }
+
+   msg->header.version = version;
+   msg->header.type = type;
+   msg->header.length = length;
+   msg->header.seq = (uint32_t)buffer[1];
+   memcpy(&msg->payload, &buffer[CORE_MSG_HEADER_SIZE], length * sizeof(int));
+
+   return 0;
+}
+
+/**
+ * @brief Encode message directly into shared memory and send it to M4, the
+ *        sequence number is assigned by the sender
+ * @param msg
+ * @return 0 on success, -1 if queue is full or message is invalid
+ */
+int core_msg_send_to_m4(core_msg_t *const msg)
+{
+   if (msg->header.type >= CORE_MSG_COUNT) {
+      return -1;
+   }
+
+   int *const slot = reserve_to_m4();
+   if (slot == NULL) {
+      return -1;
+   }
+
+   msg->header.seq = seq_to_m4;
+   const int size = core_msg_encode(msg, slot, BUFFSHAREDSIZE);
+   if (size < 0) {
+      cancel_to_m4();
+      return -1;
+   }
+
+   commit_to_m4((unsigned int)size);
+   seq_to_m4++;
+   return 0;
+}
+
+/**
+ * @brief Encode message directly into shared memory and send it to M7, the
+ *        sequence number is assigned by the sender
+ * @param msg
+ * @return 0 on success, -1 if queue is full or message is invalid
+ */
+int core_msg_send_to_m7(core_msg_t *const msg)
+{
+   if (msg->header.type >= CORE_MSG_COUNT) {
+      return -1;
+   }
+
+   int *const slot = reserve_to_m7();
+   if (slot == NULL) {
+      return -1;
+   }
+
+   msg->header.seq = seq_to_m7;
+   const int size = core_msg_encode(msg, slot, BUFFSHAREDSIZE);
+   if (size < 0) {
+      cancel_to_m7();
+      return -1;
+   }
+
+   commit_to_m7((unsigned int)size);
+   seq_to_m7++;
+   return 0;
+}
+
+/**
+ * @brief Decode the oldest message from M7 straight from its shared slot
+ *        into msg and release the slot
+ * @param msg
+ * @return 0 on success, -1 if queue is empty, -2 if the message was invalid
+ *         (it is dropped)
+ */
+int core_msg_receive_from_m7(core_msg_t *const msg)
+{
+   unsigned int size;
+   const int *const slot = peek_from_m7(&size);
+   if (slot == NULL) {
+      return -1;
+   }
+
+   const int ret = core_msg_decode(slot, size, msg);
+   release_from_m7();
+
+   return (ret == 0) ? 0 : -2;
+}
+
+/**
+ * @brief Decode the oldest message from M4 straight from its shared slot
+ *        into msg and release the slot
+ * @param msg
+ * @return 0 on success, -1 if queue is empty, -2 if the message was invalid
+ *         (it is dropped)
+ */
+int core_msg_receive_from_m4(core_msg_t *const msg)
+{
+   unsigned int size;
+   const int *const slot = peek_from_m4(&size);
+   if (slot == NULL) {
+      return -1;
+   }
+
+   const int ret = core_msg_decode(slot, size, msg);
+   release_from_m4();
+
+   return (ret == 0) ? 0 : -2;
+}
@@ -0,0 +1,148 @@
+/*
+ * core_rpc.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_rpc.h"
+#include "core_clock.h"
+
+typedef enum { SLOT_FREE, SLOT_PENDING, SLOT_DONE } slot_state_t;
+
+/* Completion slot of one call */
+typedef struct {
+   slot_state_t state;
+   uint32_t seq;
+   uint32_t start;
+   uint32_t timeout;
+   int32_t status;
+} rpc_slot_t;
+
+static rpc_slot_t rpc_slots[CORE_RPC_SLOTS];
+
+/**
+ * @brief Send request to M4 and register it for the response. The call never
+ *        blocks, the result is checked by core_rpc_poll().
+ * @param msg request, its sequence number is used as the call ID
+ * @param timeout_ms how long to wait for the response
+ * @return call handle, -1 if there is no free slot or the queue is full
+ */
+int core_rpc_call_m4(core_msg_t *const msg, const uint32_t timeout_ms)
+{
+   for (unsigned int i = 0; i < CORE_RPC_SLOTS; i++) {
+      rpc_slot_t *const slot = &rpc_slots[i];
+      if (slot->state != SLOT_FREE) {
+         continue;
+      }
+
+      if (core_msg_send_to_m4(msg) != 0) {
+         return -1;
+      }
+
+      slot->seq = msg->header.seq;
+      slot->start = (uint32_t)core_clock_ms();
+      slot->timeout = timeout_ms;
+      slot->status = 0;
+      slot->state = SLOT_PENDING;
+      return (int)i;
+   }
+
+   return -1;
+}
+
+/**
+ * @brief Check the state of the call, the slot is freed once the call is not
+ *        pending anymore
+ * @param call handle returned by core_rpc_call_m4()
+ * @param status status sent by M4, valid for CORE_RPC_DONE
+ * @return CORE_RPC_DONE, CORE_RPC_PENDING, CORE_RPC_TIMEOUT or
+ *         CORE_RPC_INVALID for unknown handle
+ */
+int core_rpc_poll(const int call, int32_t *const status)
+{
+   if (call < 0 || call >= (int)CORE_RPC_SLOTS) {
+      return CORE_RPC_INVALID;
+   }
+
+   rpc_slot_t *const slot = &rpc_slots[call];
+   switch (slot->state) {
+   case SLOT_DONE:
+      *status = slot->status;
+      slot->state = SLOT_FREE;
+      return CORE_RPC_DONE;
+   case SLOT_PENDING:
+      if ((uint32_t)core_clock_ms() - slot->start >= slot->timeout) {
+         /* Late response will not match any pending slot */
+         slot->state = SLOT_FREE;
+         return CORE_RPC_TIMEOUT;
+      }
+      return CORE_RPC_PENDING;
+   default:
+      return CORE_RPC_INVALID;
+   }
+}
+
+/**
+ * @brief Read all responses sent by M4 and complete the matching calls, it has
+ *        to be called periodically on M7
+ */
+void core_rpc_process(void)
+{
+   core_msg_t msg;
+   int ret;
+
+   while ((ret = core_msg_receive_from_m4(&msg)) != -1) {
+      if (ret != 0 || msg.header.type != CORE_MSG_ACK) {
+         continue;
+      }
+
+      for (unsigned int i = 0; i < CORE_RPC_SLOTS; i++) {
+         rpc_slot_t *const slot = &rpc_slots[i];
+         if (slot->state == SLOT_PENDING &&
+             slot->seq == msg.payload.ack.request_seq) {
+            slot->status = msg.payload.ack.status;
+            slot->state = SLOT_DONE;
+            break;
+         }
+      }
+   }
+}
+
+/**
+ * @brief Send response to the request received from M7, called by M4
+ * @param request
+ * @param status 0 request was applied, negative value on error
+ * @return 0 on success, -1 if queue is full
+ */
+int core_rpc_reply_m7(const core_msg_t *const request, const int32_t status)
+{
+   core_msg_t msg = {.header.type = CORE_MSG_ACK,
+                     .payload.ack.request_seq = request->header.seq,
+                     .payload.ack.status = status};
+
+   return core_msg_send_to_m7(&msg);
+}
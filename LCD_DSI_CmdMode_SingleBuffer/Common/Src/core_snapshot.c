@@ -0,0 +1,129 @@
+/*
+ * core_snapshot.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "core_snapshot.h"
+#include "cores_communication.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#define SNAPSHOT_WORDS (sizeof(core_snapshot_t) / sizeof(uint32_t))
+
+/* How many times the reader tries before it gives up */
+#define SNAPSHOT_READ_TRIES (4U)
+
+_Static_assert(sizeof(core_snapshot_t) % sizeof(uint32_t) == 0,
+               "core_snapshot_t is not made of whole words");
+
+/*
+ * Sequence lock, odd sequence means the writer is updating the data. The data
+ * are accessed as relaxed atomic words, so the reader may see torn values, but
+ * it always detects them by the changed sequence.
+ */
+struct _snapshot {
+   atomic_uint seq __attribute__((aligned(CORE_CACHE_LINE)));
+   atomic_uint data[SNAPSHOT_WORDS];
+};
+
+static struct _snapshot snapshot_data __attribute__((section(".shared")));
+
+/**
+ * @brief Clear the snapshot, it has to be called in only one of the cores
+ */
+void core_snapshot_init(void)
+{
+   atomic_init(&snapshot_data.seq, 0U);
+   for (unsigned int i = 0; i < SNAPSHOT_WORDS; i++) {
+      atomic_init(&snapshot_data.data[i], 0U);
+   }
+}
+
+/**
+ * @brief Publish new snapshot, called by M4 (the only writer). It never
+ *        blocks.
+ * @param snapshot
+ */
+void core_snapshot_write(const core_snapshot_t *const snapshot)
+{
+   uint32_t words[SNAPSHOT_WORDS];
+   memcpy(words, snapshot, sizeof(words));
+
+   const unsigned int seq =
+       atomic_load_explicit(&snapshot_data.seq, memory_order_relaxed);
+
+   /* Mark update in progress before any data is touched */
+   atomic_store_explicit(&snapshot_data.seq, seq + 1U, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+
+   for (unsigned int i = 0; i < SNAPSHOT_WORDS; i++) {
+      atomic_store_explicit(&snapshot_data.data[i], words[i],
+                            memory_order_relaxed);
+   }
+
+   /* Publish the data */
+   atomic_store_explicit(&snapshot_data.seq, seq + 2U, memory_order_release);
+}
+
+/**
+ * @brief Read the latest consistent snapshot, called by M7. It never blocks
+ *        the writer, it retries only while the writer is in the middle of an
+ *        update.
+ * @param snapshot
+ * @return 0 on success, -1 if no consistent copy was read in a few tries
+ */
+int core_snapshot_read(core_snapshot_t *const snapshot)
+{
+   uint32_t words[SNAPSHOT_WORDS];
+
+   for (unsigned int tries = 0; tries < SNAPSHOT_READ_TRIES; tries++) {
+      const unsigned int begin =
+          atomic_load_explicit(&snapshot_data.seq, memory_order_acquire);
+      if (begin & 1U) {
+         /* Writer is updating the data */
+         continue;
+      }
+
+      for (unsigned int i = 0; i < SNAPSHOT_WORDS; i++) {
+         words[i] = atomic_load_explicit(&snapshot_data.data[i],
+                                         memory_order_relaxed);
+      }
+
+      /* Data has to be read before the sequence is checked again */
+      atomic_thread_fence(memory_order_acquire);
+      const unsigned int end =
+          atomic_load_explicit(&snapshot_data.seq, memory_order_relaxed);
+
+      if (begin == end) {
+         memcpy(snapshot, words, sizeof(words));
+         return 0;
+      }
+   }
+
+   return -1;
+}
@@ -0,0 +1,214 @@
+/*
+ * host.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include "app_rect.h"
+#include "stm32h747i_discovery.h"
+#include <stdint.h>
+
+/*
+ * Control of the host build. The tests and the simulator drive the stand-ins
+ * of the HAL and BSP by these functions, the application does not call them.
+ */
+
+/* Mapped SDRAM from LCD_FRAME_BUFFER, the caches of glyphs and sprites are
+   in it */
+#define HOST_SDRAM_SIZE (0x02000000UL)
+
+/**
+ * @brief Map SDRAM and AXI SRAM at their addresses and make the calling
+ *        thread M7. The clock starts at 0 in simulated mode.
+ */
+void host_init(void);
+
+/**
+ * @brief Bring up the board as main() of M7 does, the panel takes the place
+ *        of LTDC and DSI. Both cores get their notification, the recording
+ *        is not started.
+ * @param calendar RTC seconds since 2000-01-01 00:00:00
+ */
+void host_start(uint32_t calendar);
+
+/**
+ * @brief Make the calling thread the core
+ * @param cpuid CM7_CPUID or CM4_CPUID
+ */
+void host_core(uint32_t cpuid);
+
+/**
+ * @brief Pin the calling thread to the CPU, modulo the count of CPUs
+ * @param cpu
+ * @return 0 on success, -1 if the thread cannot be pinned
+ */
+int host_pin(uint32_t cpu);
+
+/**
+ * @brief Load AXI SRAM from its image, e.g. dumped from the board by debugger
+ *        with the recording of app_record.c
+ * @param path file of D1_AXISRAM_SIZE bytes
+ * @return 0 on success, -1 on error
+ */
+int host_axi_load(const char *path);
+
+/**
+ * @brief Write AXI SRAM into a file, host_axi_load() reads it back
+ * @param path
+ * @return 0 on success, -1 on error
+ */
+int host_axi_save(const char *path);
+
+/**
+ * @brief Run the core clock by the monotonic clock of the host instead of
+ *        host_clock_set(), for benchmarks measuring by core_clock_us()
+ * @param wall 1 for the monotonic clock
+ */
+void host_clock_wall(uint8_t wall);
+
+/**
+ * @brief Get the simulated core clock
+ * @return uint64_t us
+ */
+uint64_t host_clock_get(void);
+
+/**
+ * @brief Move the simulated core clock forward. TIM2 sets its flags on the way
+ *        and the TIM2 interrupt runs, as well as the RTC alarm.
+ * @param us new time, earlier time is ignored
+ */
+void host_clock_set(uint64_t us);
+
+/**
+ * @brief Restart the core clock from 0 as by reset of the board, TIM2 has to
+ *        be initialized again. The RTC calendar keeps running.
+ */
+void host_clock_reset(void);
+
+/**
+ * @brief Run the pending HSEM interrupt of the calling core
+ * @return 1 if an interrupt was pending
+ */
+int host_irq_poll(void);
+
+/**
+ * @brief Check the event of M4, set by HSEM notification
+ * @return 1 if M4 would be woken up
+ */
+int host_m4_event(void);
+
+/**
+ * @brief Run M4, if it was woken up by the notification. Heater requests are
+ *        confirmed and M7 is notified, a changed heater state is published.
+ * @return 1 if M4 ran, 0 otherwise
+ */
+int host_m4_run(void);
+
+/**
+ * @brief Get the heater state requested by M7
+ * @return 1 on, 0 off, -1 before the first request
+ */
+int host_m4_heater(void);
+
+/**
+ * @brief Count changes of the heater state requested by M7
+ * @return uint32_t
+ */
+uint32_t host_m4_commands(void);
+
+/**
+ * @brief Set the calendar of RTC
+ * @param seconds since 2000-01-01 00:00:00 at the current core clock
+ */
+void host_rtc_set(uint32_t seconds);
+
+/**
+ * @brief Get the core clock of the next match of RTC alarm A
+ * @param us core clock in us
+ * @return 0 if the alarm is armed, -1 otherwise
+ */
+int host_rtc_alarm(uint64_t *us);
+
+/**
+ * @brief Set the state of the touch screen, a new touch runs BSP_TS_Callback
+ * @param touched
+ * @param x
+ * @param y
+ */
+void host_touch(uint32_t touched, uint32_t x, uint32_t y);
+
+/**
+ * @brief Get the state of the LED
+ * @param led
+ * @return 1 if it is on
+ */
+uint32_t host_led(Led_TypeDef led);
+
+/* Refresh of the panel by the host DSI */
+typedef struct {
+   uint32_t frames;     /* refreshes of the whole queued buffer */
+   uint32_t regions;    /* refreshed regions */
+   uint64_t pixels;     /* refreshed pixels */
+   uint32_t max_pixels; /* the most pixels of one frame */
+} host_dsi_stats_t;
+
+/**
+ * @brief Get the time when the running refresh of a region ends
+ * @param us core clock in us
+ * @return 0 if a region is being refreshed, -1 otherwise
+ */
+int host_dsi_busy(uint64_t *us);
+
+/**
+ * @brief End the refresh of the region, the end of refresh interrupt
+ * @return 1 if a frame was completed
+ */
+int host_dsi_done(void);
+
+/**
+ * @brief Get the image on the panel
+ * @return const uint32_t* ARGB8888 pixels, HACT x VACT
+ */
+const uint32_t *host_dsi_panel(void);
+
+/**
+ * @brief Get the statistics of the refresh
+ * @return const host_dsi_stats_t*
+ */
+const host_dsi_stats_t *host_dsi_stats(void);
+
+/**
+ * @brief Write the panel image as binary PPM
+ * @param path
+ * @return 0 on success, -1 on error
+ */
+int host_dsi_ppm(const char *path);
+
+#endif /* HOST_H_ */
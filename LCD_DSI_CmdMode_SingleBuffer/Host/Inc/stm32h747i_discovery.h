@@ -0,0 +1,60 @@
+/*
+ * stm32h747i_discovery.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STM32H747I_DISCOVERY_H_
+#define STM32H747I_DISCOVERY_H_
+
+#include "stm32h747i_discovery_errno.h"
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+
+/*
+ * Stand-in of the board support for the host build, LEDs are kept in memory
+ * and read back by host_led().
+ */
+
+typedef enum {
+   LED1 = 0U,
+   LED_GREEN = LED1,
+   LED2 = 1U,
+   LED_ORANGE = LED2,
+   LED3 = 2U,
+   LED_RED = LED3,
+   LED4 = 3U,
+   LED_BLUE = LED4,
+   LEDn
+} Led_TypeDef;
+
+int32_t BSP_LED_Init(Led_TypeDef Led);
+int32_t BSP_LED_On(Led_TypeDef Led);
+int32_t BSP_LED_Off(Led_TypeDef Led);
+int32_t BSP_LED_Toggle(Led_TypeDef Led);
+
+#endif /* STM32H747I_DISCOVERY_H_ */
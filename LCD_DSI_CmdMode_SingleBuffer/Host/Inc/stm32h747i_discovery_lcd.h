@@ -0,0 +1,75 @@
+/*
+ * stm32h747i_discovery_lcd.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STM32H747I_DISCOVERY_LCD_H_
+#define STM32H747I_DISCOVERY_LCD_H_
+
+#include "lcd.h"
+#include "stm32h747i_discovery_errno.h"
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+
+/*
+ * Stand-in of the LCD driver for the host build. The drawing functions draw
+ * by the CPU into the buffer of the active LTDC layer, the panel is refreshed
+ * by the host LCD_RefreshRegion().
+ */
+
+typedef struct {
+   uint32_t XSize;
+   uint32_t YSize;
+   uint32_t ActiveLayer;
+   uint32_t PixelFormat;
+   uint32_t BppFactor;
+   uint32_t IsMspCallbacksValid;
+   uint32_t ReloadEnable;
+} BSP_LCD_Ctx_t;
+
+extern LTDC_HandleTypeDef hlcd_ltdc;
+extern BSP_LCD_Ctx_t Lcd_Ctx[];
+
+int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                           uint8_t *pBmp);
+int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint8_t *pData, uint32_t Width, uint32_t Height);
+int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t Length, uint32_t Color);
+int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t Length, uint32_t Color);
+int32_t BSP_LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                         uint32_t Width, uint32_t Height, uint32_t Color);
+int32_t BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t *Color);
+int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                           uint32_t Color);
+int32_t BSP_LCD_SetActiveLayer(uint32_t Instance, uint32_t LayerIndex);
+int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat);
+
+#endif /* STM32H747I_DISCOVERY_LCD_H_ */
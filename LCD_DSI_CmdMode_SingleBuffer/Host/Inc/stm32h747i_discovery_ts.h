@@ -0,0 +1,65 @@
+/*
+ * stm32h747i_discovery_ts.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STM32H747I_DISCOVERY_TS_H_
+#define STM32H747I_DISCOVERY_TS_H_
+
+#include "stm32h747i_discovery_errno.h"
+#include <stdint.h>
+
+/*
+ * Stand-in of the touch screen driver for the host build, the touch is set
+ * by host_touch().
+ */
+
+#define TS_INSTANCES_NBR 1U
+#define TS_MAX_WIDTH 800U
+#define TS_MAX_HEIGHT 480U
+#define TS_SWAP_NONE 0x01U
+
+typedef struct {
+   uint32_t Width;
+   uint32_t Height;
+   uint32_t Orientation;
+   uint32_t Accuracy;
+} TS_Init_t;
+
+typedef struct {
+   uint32_t TouchDetected;
+   uint32_t TouchX;
+   uint32_t TouchY;
+} TS_State_t;
+
+int32_t BSP_TS_Init(uint32_t Instance, TS_Init_t *TS_Init);
+int32_t BSP_TS_EnableIT(uint32_t Instance);
+int32_t BSP_TS_GetState(uint32_t Instance, TS_State_t *TS_State);
+void BSP_TS_Callback(uint32_t Instance);
+
+#endif /* STM32H747I_DISCOVERY_TS_H_ */
@@ -0,0 +1,269 @@
+/*
+ * stm32h7xx_hal.h
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STM32H7XX_HAL_H_
+#define STM32H7XX_HAL_H_
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/*
+ * Stand-in of the STM32H7 HAL for the x86 Linux host build. Only what the
+ * application and the Common code use is provided. Registers of TIM2, DWT and
+ * HSEM are emulated by host.c, the core clock is simulated and advanced by
+ * host_clock_set(). A thread is M7 or M4 by host_core(), each thread has its
+ * own interrupt mask. Interrupts are not asynchronous, they are delivered by
+ * host_clock_set(), host_irq_poll() and __WFI().
+ */
+
+typedef enum {
+   HAL_OK = 0x00U,
+   HAL_ERROR = 0x01U,
+   HAL_BUSY = 0x02U,
+   HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+#define assert_param(expr) assert(expr)
+
+/* Cortex-M ------------------------------------------------------------------*/
+#define CM7_CPUID (0x00000003U)
+#define CM4_CPUID (0x00000001U)
+
+typedef enum { TIM2_IRQn = 28, HSEM1_IRQn = 125 } IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+
+uint32_t HAL_GetCurrentCPUID(void);
+uint32_t HAL_GetTick(void);
+void HAL_SuspendTick(void);
+void HAL_ResumeTick(void);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority,
+                          uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+void __enable_irq(void);
+void __WFI(void);
+void __NOP(void);
+#define __DSB() atomic_thread_fence(memory_order_seq_cst)
+
+/* Cycle counter at SystemCoreClock, it runs by the monotonic clock */
+typedef struct {
+   uint32_t CTRL;
+   uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+   uint32_t DEMCR;
+} CoreDebug_Type;
+
+DWT_Type *host_dwt(void);
+extern CoreDebug_Type host_core_debug;
+
+#define DWT (host_dwt())
+#define CoreDebug (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+/* RCC -----------------------------------------------------------------------*/
+typedef struct {
+   uint32_t D2CFGR;
+} RCC_TypeDef;
+
+extern RCC_TypeDef host_rcc;
+
+#define RCC (&host_rcc)
+#define RCC_D2CFGR_D2PPRE1 (0x7UL << 4)
+#define RCC_APB1_DIV1 (0U)
+#define __HAL_RCC_TIM2_CLK_ENABLE() ((void)0)
+#define __HAL_RCC_HSEM_CLK_ENABLE() ((void)0)
+
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+
+/* TIM -----------------------------------------------------------------------*/
+/* The counter follows the simulated clock, SR is cleared by writing 0 and
+   EGR generates the event as by the hardware */
+typedef struct {
+   uint32_t CR1;
+   uint32_t DIER;
+   uint32_t SR;
+   uint32_t EGR;
+   uint32_t CNT;
+   uint32_t PSC;
+   uint32_t ARR;
+   uint32_t CCR1;
+} TIM_TypeDef;
+
+TIM_TypeDef *host_tim2(void);
+
+#define TIM2 (host_tim2())
+#define TIM_CR1_CEN (1UL << 0)
+#define TIM_CR1_URS (1UL << 2)
+#define TIM_DIER_UIE (1UL << 0)
+#define TIM_DIER_CC1IE (1UL << 1)
+#define TIM_SR_UIF (1UL << 0)
+#define TIM_SR_CC1IF (1UL << 1)
+#define TIM_EGR_UG (1UL << 0)
+#define TIM_EGR_CC1G (1UL << 1)
+
+/* HSEM ----------------------------------------------------------------------*/
+#define __HAL_HSEM_SEMID_TO_MASK(__SEMID__) (1UL << (__SEMID__))
+#define __HAL_HSEM_CLEAR_FLAG(__SEM_MASK__) host_hsem_clear((__SEM_MASK__))
+
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID);
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID);
+void HAL_HSEM_ActivateNotification(uint32_t SemMask);
+void HAL_HSEM_DeactivateNotification(uint32_t SemMask);
+void HAL_HSEM_FreeCallback(uint32_t SemMask);
+void HAL_HSEM_IRQHandler(void);
+void host_hsem_clear(uint32_t SemMask);
+
+/* PWR -----------------------------------------------------------------------*/
+#define PWR_MAINREGULATOR_ON (0U)
+#define PWR_STOPENTRY_WFI (1U)
+#define PWR_STOPENTRY_WFE (2U)
+#define PWR_D1_DOMAIN (0U)
+#define PWR_D2_DOMAIN (1U)
+
+void HAL_PWREx_ClearPendingEvent(void);
+void HAL_PWREx_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry,
+                             uint32_t Domain);
+
+/* RTC -----------------------------------------------------------------------*/
+typedef struct {
+   uint32_t TR;
+} RTC_TypeDef;
+
+extern RTC_TypeDef host_rtc;
+
+#define RTC (&host_rtc)
+
+typedef struct {
+   uint32_t HourFormat;
+   uint32_t AsynchPrediv;
+   uint32_t SynchPrediv;
+   uint32_t OutPut;
+   uint32_t OutPutRemap;
+   uint32_t OutPutPolarity;
+   uint32_t OutPutType;
+} RTC_InitTypeDef;
+
+typedef struct {
+   RTC_TypeDef *Instance;
+   RTC_InitTypeDef Init;
+} RTC_HandleTypeDef;
+
+typedef struct {
+   uint8_t Hours;
+   uint8_t Minutes;
+   uint8_t Seconds;
+   uint8_t TimeFormat;
+   uint32_t SubSeconds;
+   uint32_t DayLightSaving;
+   uint32_t StoreOperation;
+} RTC_TimeTypeDef;
+
+typedef struct {
+   uint8_t WeekDay;
+   uint8_t Month;
+   uint8_t Date;
+   uint8_t Year;
+} RTC_DateTypeDef;
+
+typedef struct {
+   RTC_TimeTypeDef AlarmTime;
+   uint32_t AlarmMask;
+   uint32_t AlarmSubSecondMask;
+   uint32_t AlarmDateWeekDaySel;
+   uint8_t AlarmDateWeekDay;
+   uint32_t Alarm;
+} RTC_AlarmTypeDef;
+
+#define RTC_HOURFORMAT_24 (0U)
+#define RTC_OUTPUT_DISABLE (0U)
+#define RTC_OUTPUT_POLARITY_HIGH (0U)
+#define RTC_OUTPUT_TYPE_OPENDRAIN (0U)
+#define RTC_OUTPUT_REMAP_NONE (0U)
+#define RTC_FORMAT_BIN (0U)
+#define RTC_DAYLIGHTSAVING_NONE (0U)
+#define RTC_STOREOPERATION_RESET (0U)
+#define RTC_ALARMMASK_NONE (0U)
+#define RTC_ALARMSUBSECONDMASK_ALL (0U)
+#define RTC_ALARMDATEWEEKDAYSEL_WEEKDAY (0x40000000U)
+#define RTC_ALARM_A (0x100U)
+#define RTC_BKP_NUMBER (32U)
+
+HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc,
+                                  RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc,
+                                  RTC_DateTypeDef *sDate, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc,
+                                  RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc,
+                                  RTC_DateTypeDef *sDate, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc,
+                                      RTC_AlarmTypeDef *sAlarm,
+                                      uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc,
+                                          uint32_t Alarm);
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc,
+                            uint32_t BackupRegister);
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister,
+                         uint32_t Data);
+void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc);
+void HAL_RTC_AlarmIRQHandler(RTC_HandleTypeDef *hrtc);
+
+/* LTDC ----------------------------------------------------------------------*/
+typedef struct {
+   uint32_t WindowX0;
+   uint32_t WindowX1;
+   uint32_t WindowY0;
+   uint32_t WindowY1;
+   uint32_t PixelFormat;
+   uint32_t FBStartAdress; /* frame buffers are mapped below 4 GiB */
+   uint32_t ImageWidth;
+   uint32_t ImageHeight;
+} LTDC_LayerCfgTypeDef;
+
+typedef struct {
+   LTDC_LayerCfgTypeDef LayerCfg[2];
+} LTDC_HandleTypeDef;
+
+/* Memory --------------------------------------------------------------------*/
+/* AXI SRAM is mapped at its address by host_init() */
+#define D1_AXISRAM_BASE (0x24000000UL)
+#define D1_AXISRAM_SIZE (0x80000UL)
+
+#endif /* STM32H7XX_HAL_H_ */
@@ -0,0 +1,246 @@
+/*
+ * host_bsp.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "host.h"
+#include "main.h"
+#include <string.h>
+
+LTDC_HandleTypeDef hlcd_ltdc;
+BSP_LCD_Ctx_t Lcd_Ctx[1];
+
+static uint32_t led_state[LEDn];
+static TS_State_t ts_state;
+
+/* LED -----------------------------------------------------------------------*/
+
+int32_t BSP_LED_Init(Led_TypeDef Led)
+{
+   led_state[Led] = 0;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_On(Led_TypeDef Led)
+{
+   led_state[Led] = 1;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Off(Led_TypeDef Led)
+{
+   led_state[Led] = 0;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Toggle(Led_TypeDef Led)
+{
+   led_state[Led] ^= 1U;
+   return BSP_ERROR_NONE;
+}
+
+uint32_t host_led(Led_TypeDef led) { return led_state[led]; }
+
+/* SDRAM ---------------------------------------------------------------------*/
+
+int32_t BSP_SDRAM_Init(uint32_t Instance)
+{
+   (void)Instance;
+   host_init();
+   return BSP_ERROR_NONE;
+}
+
+/* Touch screen --------------------------------------------------------------*/
+
+int32_t BSP_TS_Init(uint32_t Instance, TS_Init_t *TS_Init)
+{
+   (void)Instance;
+   (void)TS_Init;
+   memset(&ts_state, 0, sizeof(ts_state));
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_TS_EnableIT(uint32_t Instance)
+{
+   (void)Instance;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_TS_GetState(uint32_t Instance, TS_State_t *TS_State)
+{
+   (void)Instance;
+   *TS_State = ts_state;
+   return BSP_ERROR_NONE;
+}
+
+/* The controller interrupts on a new touch only */
+void host_touch(const uint32_t touched, const uint32_t x, const uint32_t y)
+{
+   const uint32_t pressed = touched && !ts_state.TouchDetected;
+
+   ts_state.TouchDetected = touched ? 1U : 0U;
+   if (touched) {
+      ts_state.TouchX = x;
+      ts_state.TouchY = y;
+   }
+   if (pressed)
+      BSP_TS_Callback(0);
+}
+
+__attribute__((weak)) void BSP_TS_Callback(uint32_t Instance)
+{
+   (void)Instance;
+}
+
+/* LCD -----------------------------------------------------------------------*/
+
+/**
+ * @brief Pixel of the active layer
+ */
+static uint32_t *lcd_pixel(const uint32_t Xpos, const uint32_t Ypos)
+{
+   const LTDC_LayerCfgTypeDef *const layer =
+       &hlcd_ltdc.LayerCfg[Lcd_Ctx[0].ActiveLayer];
+
+   return (uint32_t *)(uintptr_t)layer->FBStartAdress +
+          Ypos * Lcd_Ctx[0].XSize + Xpos;
+}
+
+int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                           uint8_t *pBmp)
+{
+   (void)Instance;
+   (void)Xpos;
+   (void)Ypos;
+   (void)pBmp;
+   return BSP_ERROR_FEATURE_NOT_SUPPORTED;
+}
+
+int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                            uint8_t *pData, uint32_t Width, uint32_t Height)
+{
+   (void)Instance;
+   for (uint32_t y = 0; y < Height; y++)
+      memcpy(lcd_pixel(Xpos, Ypos + y), pData + 4U * Width * y, 4U * Width);
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                         uint32_t Width, uint32_t Height, uint32_t Color)
+{
+   (void)Instance;
+   for (uint32_t y = 0; y < Height; y++) {
+      uint32_t *const row = lcd_pixel(Xpos, Ypos + y);
+      for (uint32_t x = 0; x < Width; x++)
+         row[x] = Color;
+   }
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t Length, uint32_t Color)
+{
+   return BSP_LCD_FillRect(Instance, Xpos, Ypos, Length, 1, Color);
+}
+
+int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t Length, uint32_t Color)
+{
+   return BSP_LCD_FillRect(Instance, Xpos, Ypos, 1, Length, Color);
+}
+
+int32_t BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                          uint32_t *Color)
+{
+   (void)Instance;
+   *Color = *lcd_pixel(Xpos, Ypos);
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos,
+                           uint32_t Color)
+{
+   (void)Instance;
+   *lcd_pixel(Xpos, Ypos) = Color;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_SetActiveLayer(uint32_t Instance, uint32_t LayerIndex)
+{
+   Lcd_Ctx[Instance].ActiveLayer = LayerIndex;
+   return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat)
+{
+   *PixelFormat = Lcd_Ctx[Instance].PixelFormat;
+   return BSP_ERROR_NONE;
+}
+
+/* Board ---------------------------------------------------------------------*/
+
+void host_start(const uint32_t calendar)
+{
+   TS_Init_t ts = {TS_MAX_WIDTH, TS_MAX_HEIGHT, TS_SWAP_NONE, 2};
+
+   host_init();
+   core_clock_init();
+   core_share_init();
+   core_snapshot_init();
+   core_lock_clear_stats();
+   core_lock_init();
+   core_notify_init();
+
+   /* Notifications of both cores, as by core_notify_init() on each */
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_NVIC_EnableIRQ(HSEM1_IRQn);
+   host_core(CM4_CPUID);
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   host_core(CM7_CPUID);
+
+   BSP_LED_Init(LED3);
+   BSP_LED_Init(LED4);
+
+   RTC_Init();
+   host_rtc_set(calendar);
+   APP_ScheduleRestore(APP_RtcNow());
+
+   BSP_SDRAM_Init(0);
+   BSP_TS_Init(TS_INSTANCE, &ts);
+   BSP_TS_EnableIT(TS_INSTANCE);
+
+   Lcd_Ctx[0].ActiveLayer = 0;
+   Lcd_Ctx[0].PixelFormat = LCD_PIXEL_FORMAT_ARGB8888;
+   Lcd_Ctx[0].BppFactor = 4;
+   Lcd_Ctx[0].XSize = HACT;
+   Lcd_Ctx[0].YSize = VACT;
+   LCD_DrawInit();
+   hlcd_ltdc.LayerCfg[0].FBStartAdress = LCD_FRAME_BUFFER;
+   UTIL_LCD_SetFuncDriver(&LCD_UTIL_Driver);
+}
@@ -0,0 +1,130 @@
+/*
+ * host_dsi.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "host.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Time of the refresh of the whole panel */
+#define DSI_FRAME_US (16000U)
+
+static uint32_t panel[HACT * VACT];
+static host_dsi_stats_t stats;
+static uint32_t dsi_buffer;       /* buffer of the running frame */
+static uint32_t dsi_frame_pixels; /* refreshed pixels of the running frame */
+static uint8_t dsi_busy;
+static uint64_t dsi_end;
+
+/**
+ * @brief Count the finished frame
+ */
+static void dsi_frame_end(void)
+{
+   if (dsi_frame_pixels == 0)
+      return;
+   stats.frames++;
+   if (dsi_frame_pixels > stats.max_pixels)
+      stats.max_pixels = dsi_frame_pixels;
+   dsi_frame_pixels = 0;
+}
+
+/**
+ * @brief Refresh the region of the panel from the buffer. The region is
+ * copied at once, its end of refresh comes after the time the DSI link would
+ * take. A refresh from the other buffer begins the next frame.
+ * @param buffer Frame buffer address
+ * @param rect   Region
+ * @retval None
+ */
+void LCD_RefreshRegion(uint32_t buffer, const app_rect_t *rect)
+{
+   const uint32_t *const pixels = (const uint32_t *)(uintptr_t)buffer;
+   const uint32_t width = rect->x1 - rect->x0;
+   const uint32_t count = width * (rect->y1 - rect->y0);
+
+   if (buffer != dsi_buffer) {
+      dsi_frame_end();
+      dsi_buffer = buffer;
+   }
+   for (uint32_t y = rect->y0; y < rect->y1; y++)
+      memcpy(&panel[y * HACT + rect->x0], &pixels[y * HACT + rect->x0],
+             4U * width);
+
+   dsi_frame_pixels += count;
+   stats.regions++;
+   stats.pixels += count;
+   dsi_busy = 1;
+   dsi_end = host_clock_get() + 1U +
+             (uint64_t)count * DSI_FRAME_US / (HACT * VACT);
+}
+
+int host_dsi_busy(uint64_t *const us)
+{
+   if (!dsi_busy)
+      return -1;
+   *us = dsi_end;
+   return 0;
+}
+
+int host_dsi_done(void)
+{
+   const uint32_t frames = stats.frames;
+
+   dsi_busy = 0;
+   LCD_RefreshDone();
+   if (!dsi_busy)
+      dsi_frame_end();
+   return stats.frames != frames;
+}
+
+const uint32_t *host_dsi_panel(void) { return panel; }
+
+const host_dsi_stats_t *host_dsi_stats(void) { return &stats; }
+
+int host_dsi_ppm(const char *const path)
+{
+   static uint8_t row[HACT * 3U];
+   FILE *const file = fopen(path, "wb");
+
+   if (file == NULL)
+      return -1;
+   fprintf(file, "P6\n%u %u\n255\n", HACT, VACT);
+   for (uint32_t y = 0; y < VACT; y++) {
+      for (uint32_t x = 0; x < HACT; x++) {
+         const uint32_t pixel = panel[y * HACT + x];
+         row[3U * x] = (uint8_t)(pixel >> 16);
+         row[3U * x + 1U] = (uint8_t)(pixel >> 8);
+         row[3U * x + 2U] = (uint8_t)pixel;
+      }
+      fwrite(row, 1, sizeof(row), file);
+   }
+   return fclose(file) == 0 ? 0 : -1;
+}
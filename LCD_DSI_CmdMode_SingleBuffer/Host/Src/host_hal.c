@@ -0,0 +1,648 @@
+/*
+ * host_hal.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define _GNU_SOURCE
+#include "host.h"
+#include "main.h"
+#include "stm32h7xx_it.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Index of the core in the per-core state */
+#define CORE_M7 (0U)
+#define CORE_M4 (1U)
+#define HSEM_COUNT (32U)
+
+/* Days from 2000-01-01 to the first day of the month, not leap year */
+static const uint16_t month_days[13] = {0,   31,  59,  90,  120, 151, 181,
+                                        212, 243, 273, 304, 334, 365};
+
+uint32_t SystemCoreClock = 400000000UL;
+CoreDebug_Type host_core_debug;
+RCC_TypeDef host_rcc;
+RTC_TypeDef host_rtc;
+
+static _Thread_local uint32_t thread_cpuid = CM7_CPUID;
+static _Thread_local uint32_t thread_primask;
+static _Thread_local uint8_t thread_in_irq;
+static _Thread_local DWT_Type thread_dwt;
+
+/* Events of the cores, HSEM notification wakes up a core waiting for them */
+static pthread_mutex_t event_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t event_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t core_event[2];
+
+static atomic_uint hsem_owner[HSEM_COUNT];
+static atomic_uint hsem_ier[2];
+static atomic_uint hsem_misr[2];
+static atomic_uint nvic_enabled[2];
+
+/* Core clock, TIM2 and its flags set by the hardware */
+static _Atomic uint64_t clock_us;
+static uint8_t clock_wall;
+static uint64_t wall_offset;
+static TIM_TypeDef tim2;
+static uint32_t tim2_sr;
+
+/* RTC calendar, its alarm A and backup registers */
+static int64_t rtc_offset_us;
+static RTC_HandleTypeDef *rtc_handle;
+static uint8_t rtc_alarm_armed;
+static uint8_t rtc_alarm_flag;
+static uint32_t rtc_alarm_time; /* second of the day */
+static uint8_t rtc_alarm_weekday;
+static uint32_t rtc_bkp[RTC_BKP_NUMBER];
+
+/**
+ * @brief Index of the calling core
+ */
+static uint32_t core_self(void)
+{
+   return thread_cpuid == CM7_CPUID ? CORE_M7 : CORE_M4;
+}
+
+/**
+ * @brief Read the monotonic clock of the host
+ * @return uint64_t ns
+ */
+static uint64_t monotonic_ns(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Map the memory at its address of the board
+ */
+static void map_fixed(const uintptr_t address, const size_t size)
+{
+   void *const p = mmap((void *)address, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                        -1, 0);
+   if (p != (void *)address) {
+      fprintf(stderr, "host: cannot map 0x%08lx\n", (unsigned long)address);
+      exit(EXIT_FAILURE);
+   }
+}
+
+void host_init(void)
+{
+   static uint8_t mapped;
+
+   if (!mapped) {
+      map_fixed(LCD_FRAME_BUFFER, HOST_SDRAM_SIZE);
+      map_fixed(D1_AXISRAM_BASE, D1_AXISRAM_SIZE);
+      mapped = 1;
+   }
+   host_core(CM7_CPUID);
+}
+
+void host_core(const uint32_t cpuid) { thread_cpuid = cpuid; }
+
+int host_axi_load(const char *const path)
+{
+   FILE *const file = fopen(path, "rb");
+
+   if (file == NULL)
+      return -1;
+   const size_t size =
+       fread((void *)D1_AXISRAM_BASE, 1, D1_AXISRAM_SIZE, file);
+   fclose(file);
+   return size == D1_AXISRAM_SIZE ? 0 : -1;
+}
+
+int host_axi_save(const char *const path)
+{
+   FILE *const file = fopen(path, "wb");
+
+   if (file == NULL)
+      return -1;
+   const size_t size =
+       fwrite((const void *)D1_AXISRAM_BASE, 1, D1_AXISRAM_SIZE, file);
+   return fclose(file) == 0 && size == D1_AXISRAM_SIZE ? 0 : -1;
+}
+
+int host_pin(const uint32_t cpu)
+{
+   const long count = sysconf(_SC_NPROCESSORS_ONLN);
+   cpu_set_t set;
+
+   CPU_ZERO(&set);
+   CPU_SET(count > 0 ? cpu % (uint32_t)count : 0U, &set);
+   return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0
+                                                                         : -1;
+}
+
+/* Cortex-M ------------------------------------------------------------------*/
+
+uint32_t HAL_GetCurrentCPUID(void) { return thread_cpuid; }
+
+uint32_t HAL_GetTick(void) { return (uint32_t)(host_clock_get() / 1000U); }
+
+void HAL_SuspendTick(void) {}
+
+void HAL_ResumeTick(void) {}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority,
+                          uint32_t SubPriority)
+{
+   (void)IRQn;
+   (void)PreemptPriority;
+   (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+   atomic_fetch_or(&nvic_enabled[core_self()],
+                   IRQn == TIM2_IRQn ? 1U : 2U);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+   atomic_fetch_and(&nvic_enabled[core_self()],
+                    IRQn == TIM2_IRQn ? ~1U : ~2U);
+}
+
+uint32_t __get_PRIMASK(void) { return thread_primask; }
+
+/* Interrupts pending meanwhile run once they are enabled */
+void __set_PRIMASK(const uint32_t priMask)
+{
+   thread_primask = priMask;
+   if (!priMask)
+      host_irq_poll();
+}
+
+void __disable_irq(void) { thread_primask = 1; }
+
+void __enable_irq(void) { __set_PRIMASK(0); }
+
+/**
+ * @brief Check the HSEM interrupt of the core
+ */
+static uint32_t hsem_pending(const uint32_t core)
+{
+   return (atomic_load(&hsem_misr[core]) & atomic_load(&hsem_ier[core])) &&
+          (atomic_load(&nvic_enabled[core]) & 2U);
+}
+
+/* The core sleeps until its HSEM interrupt, other interrupts are run by the
+   thread which moves the clock */
+void __WFI(void)
+{
+   const uint32_t self = core_self();
+
+   pthread_mutex_lock(&event_mutex);
+   while (!hsem_pending(self))
+      pthread_cond_wait(&event_cond, &event_mutex);
+   pthread_mutex_unlock(&event_mutex);
+}
+
+/* A spin loop of one core gives the CPU to the other one, the host may have
+   less CPUs than the cores */
+void __NOP(void) { sched_yield(); }
+
+DWT_Type *host_dwt(void)
+{
+   /* Cycles of SystemCoreClock by the monotonic clock */
+   thread_dwt.CYCCNT =
+       (uint32_t)(monotonic_ns() * (SystemCoreClock / 1000000U) / 1000U);
+   return &thread_dwt;
+}
+
+/* RCC -----------------------------------------------------------------------*/
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) { return SystemCoreClock / 4U; }
+
+/* TIM -----------------------------------------------------------------------*/
+
+/**
+ * @brief Apply writes to the registers since the last access and update the
+ * counter. Writing 0 into SR clears the flag, 1 is ignored.
+ */
+static void tim2_sync(void)
+{
+   tim2_sr &= tim2.SR;
+   if (tim2.EGR & TIM_EGR_CC1G)
+      tim2_sr |= TIM_SR_CC1IF;
+   tim2.EGR = 0;
+   tim2.SR = tim2_sr;
+   tim2.CNT = (uint32_t)atomic_load(&clock_us);
+}
+
+/**
+ * @brief Move the counter, the flags are set by the wrap and the compare
+ */
+static void tim2_advance(const uint64_t us)
+{
+   const uint64_t from = atomic_load(&clock_us);
+
+   if (us <= from)
+      return;
+   tim2_sync();
+   if ((from >> 32) != (us >> 32))
+      tim2_sr |= TIM_SR_UIF;
+   /* The compare matches when the counter passes the register */
+   if (us - from >= (1ULL << 32) ||
+       (uint32_t)(tim2.CCR1 - (uint32_t)from - 1U) <
+           (uint32_t)(us - from))
+      tim2_sr |= TIM_SR_CC1IF;
+   atomic_store(&clock_us, us);
+   tim2.SR = tim2_sr;
+   tim2.CNT = (uint32_t)us;
+}
+
+TIM_TypeDef *host_tim2(void)
+{
+   if (clock_wall)
+      tim2_advance(wall_offset + monotonic_ns() / 1000U);
+   tim2_sync();
+   return &tim2;
+}
+
+void host_clock_wall(const uint8_t wall)
+{
+   if (wall)
+      wall_offset = atomic_load(&clock_us) - monotonic_ns() / 1000U;
+   clock_wall = wall;
+}
+
+uint64_t host_clock_get(void)
+{
+   if (clock_wall)
+      host_tim2();
+   return atomic_load(&clock_us);
+}
+
+/**
+ * @brief Second of the RTC calendar
+ */
+static uint32_t rtc_seconds(void)
+{
+   return (uint32_t)(((int64_t)host_clock_get() + rtc_offset_us) / 1000000);
+}
+
+void host_clock_set(const uint64_t us)
+{
+   uint64_t alarm;
+
+   /* The alarm is looked up before the calendar passes it */
+   if (host_rtc_alarm(&alarm) == 0 && alarm <= us)
+      rtc_alarm_flag = 1;
+   /* The core clock counts one wrap per interrupt */
+   while ((us >> 32) > (atomic_load(&clock_us) >> 32) + 1U) {
+      tim2_advance(((atomic_load(&clock_us) >> 32) + 1U) << 32);
+      host_irq_poll();
+   }
+   tim2_advance(us);
+   host_irq_poll();
+}
+
+void host_clock_reset(void)
+{
+   /* RTC runs on over the reset */
+   rtc_offset_us += (int64_t)atomic_load(&clock_us);
+   atomic_store(&clock_us, 0);
+   memset(&tim2, 0, sizeof(tim2));
+   tim2_sr = 0;
+}
+
+int host_irq_poll(void)
+{
+   const uint32_t self = core_self();
+   int served = 0;
+
+   if (thread_primask || thread_in_irq)
+      return 0;
+   thread_in_irq = 1;
+   if (self == CORE_M7) {
+      tim2_sync();
+      if ((atomic_load(&nvic_enabled[self]) & 1U) &&
+          (tim2.SR & tim2.DIER & (TIM_SR_UIF | TIM_SR_CC1IF))) {
+         TIM2_IRQHandler();
+         served = 1;
+      }
+      if (rtc_alarm_flag && rtc_handle != NULL) {
+         HAL_RTC_AlarmIRQHandler(rtc_handle);
+         served = 1;
+      }
+   }
+   if (hsem_pending(self)) {
+      HSEM1_IRQHandler();
+      served = 1;
+   }
+   thread_in_irq = 0;
+   return served;
+}
+
+/* HSEM ----------------------------------------------------------------------*/
+
+/* A failed take and a release yield, the host may have less CPUs than the
+   cores */
+HAL_StatusTypeDef HAL_HSEM_FastTake(const uint32_t SemID)
+{
+   unsigned int owner = 0;
+
+   if (atomic_compare_exchange_strong(&hsem_owner[SemID], &owner,
+                                      thread_cpuid) ||
+       owner == thread_cpuid)
+      return HAL_OK;
+   sched_yield();
+   return HAL_ERROR;
+}
+
+void HAL_HSEM_Release(const uint32_t SemID, const uint32_t ProcessID)
+{
+   const uint32_t mask = __HAL_HSEM_SEMID_TO_MASK(SemID);
+   unsigned int owner = thread_cpuid;
+
+   (void)ProcessID;
+   if (!atomic_compare_exchange_strong(&hsem_owner[SemID], &owner, 0U))
+      return;
+
+   /* Every core with the notification gets the interrupt and the event */
+   pthread_mutex_lock(&event_mutex);
+   for (uint32_t core = 0; core < 2U; core++) {
+      if (atomic_load(&hsem_ier[core]) & mask) {
+         atomic_fetch_or(&hsem_misr[core], mask);
+         core_event[core] = 1;
+      }
+   }
+   pthread_cond_broadcast(&event_cond);
+   pthread_mutex_unlock(&event_mutex);
+
+   /* A core spinning for the semaphore would take it now */
+   sched_yield();
+}
+
+void HAL_HSEM_ActivateNotification(const uint32_t SemMask)
+{
+   atomic_fetch_or(&hsem_ier[core_self()], SemMask);
+}
+
+void HAL_HSEM_DeactivateNotification(const uint32_t SemMask)
+{
+   atomic_fetch_and(&hsem_ier[core_self()], ~SemMask);
+}
+
+void host_hsem_clear(const uint32_t SemMask)
+{
+   atomic_fetch_and(&hsem_misr[core_self()], ~SemMask);
+}
+
+/* As by the HAL, the interrupt of the released semaphores is disabled */
+void HAL_HSEM_IRQHandler(void)
+{
+   const uint32_t self = core_self();
+   const uint32_t mask =
+       atomic_load(&hsem_misr[self]) & atomic_load(&hsem_ier[self]);
+
+   atomic_fetch_and(&hsem_ier[self], ~mask);
+   atomic_fetch_and(&hsem_misr[self], ~mask);
+   HAL_HSEM_FreeCallback(mask);
+}
+
+__attribute__((weak)) void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+   (void)SemMask;
+}
+
+int host_m4_event(void)
+{
+   pthread_mutex_lock(&event_mutex);
+   const int event = core_event[CORE_M4] != 0;
+   pthread_mutex_unlock(&event_mutex);
+   return event;
+}
+
+/* PWR -----------------------------------------------------------------------*/
+
+void HAL_PWREx_ClearPendingEvent(void)
+{
+   pthread_mutex_lock(&event_mutex);
+   core_event[core_self()] = 0;
+   pthread_mutex_unlock(&event_mutex);
+}
+
+/* STOP mode entered by WFE, the event is consumed on wakeup */
+void HAL_PWREx_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry,
+                             uint32_t Domain)
+{
+   const uint32_t self = core_self();
+
+   (void)Regulator;
+   (void)STOPEntry;
+   (void)Domain;
+   pthread_mutex_lock(&event_mutex);
+   while (!core_event[self])
+      pthread_cond_wait(&event_cond, &event_mutex);
+   core_event[self] = 0;
+   pthread_mutex_unlock(&event_mutex);
+}
+
+/* RTC -----------------------------------------------------------------------*/
+
+/**
+ * @brief Day of the week, 2000-01-01 was Saturday
+ */
+static uint8_t rtc_weekday(const uint32_t seconds)
+{
+   return (uint8_t)(1U + (seconds / 86400U + 5U) % 7U);
+}
+
+void host_rtc_set(const uint32_t seconds)
+{
+   rtc_offset_us = (int64_t)seconds * 1000000 - (int64_t)host_clock_get();
+}
+
+int host_rtc_alarm(uint64_t *const us)
+{
+   const uint32_t now = rtc_seconds();
+
+   if (!rtc_alarm_armed)
+      return -1;
+   /* The alarm matches when the calendar enters its second */
+   for (uint32_t day = 0; day <= 7U; day++) {
+      const uint32_t second = (now / 86400U + day) * 86400U + rtc_alarm_time;
+      if (second > now && rtc_weekday(second) == rtc_alarm_weekday) {
+         *us = (uint64_t)((int64_t)second * 1000000 - rtc_offset_us);
+         return 0;
+      }
+   }
+   return -1;
+}
+
+HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc)
+{
+   rtc_handle = hrtc;
+   return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc,
+                                  RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+   const uint32_t seconds = rtc_seconds() % 86400U;
+
+   (void)hrtc;
+   (void)Format;
+   sTime->Hours = (uint8_t)(seconds / 3600U);
+   sTime->Minutes = (uint8_t)(seconds / 60U % 60U);
+   sTime->Seconds = (uint8_t)(seconds % 60U);
+   sTime->TimeFormat = 0;
+   sTime->SubSeconds = 0;
+   return HAL_OK;
+}
+
+/* Every 4th year is leap in 2000 .. 2099 */
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc,
+                                  RTC_DateTypeDef *sDate, uint32_t Format)
+{
+   const uint32_t seconds = rtc_seconds();
+   uint32_t days = seconds / 86400U;
+   uint32_t year = 0;
+   uint32_t month = 1;
+
+   (void)hrtc;
+   (void)Format;
+   while (days >= (year % 4U == 0 ? 366U : 365U)) {
+      days -= year % 4U == 0 ? 366U : 365U;
+      year++;
+   }
+   const uint32_t leap = year % 4U == 0 ? 1U : 0U;
+   while (month < 12U &&
+          days >= month_days[month] + (month >= 2U ? leap : 0U))
+      month++;
+   days -= month_days[month - 1U] + (month > 2U ? leap : 0U);
+
+   sDate->Year = (uint8_t)year;
+   sDate->Month = (uint8_t)month;
+   sDate->Date = (uint8_t)(days + 1U);
+   sDate->WeekDay = rtc_weekday(seconds);
+   return HAL_OK;
+}
+
+/* The date is kept, only the time of the day changes */
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc,
+                                  RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+   const uint32_t day = rtc_seconds() / 86400U;
+
+   (void)hrtc;
+   (void)Format;
+   host_rtc_set(day * 86400U + sTime->Hours * 3600U + sTime->Minutes * 60U +
+                sTime->Seconds);
+   return HAL_OK;
+}
+
+/* The time of the day is kept. The RTC keeps the week day as it is given,
+   the alarm would match a wrong day, so it has to fit the date. */
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc,
+                                  RTC_DateTypeDef *sDate, uint32_t Format)
+{
+   const uint32_t year = sDate->Year;
+   const uint32_t leap = year % 4U == 0 && sDate->Month > 2U ? 1U : 0U;
+   const uint32_t days = year * 365U + (year + 3U) / 4U +
+                         month_days[sDate->Month - 1U] + leap +
+                         sDate->Date - 1U;
+
+   (void)hrtc;
+   (void)Format;
+   if (rtc_weekday(days * 86400U) != sDate->WeekDay)
+      return HAL_ERROR;
+   host_rtc_set(days * 86400U + rtc_seconds() % 86400U);
+   return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc,
+                                      RTC_AlarmTypeDef *sAlarm,
+                                      uint32_t Format)
+{
+   (void)Format;
+   rtc_handle = hrtc;
+   rtc_alarm_time = sAlarm->AlarmTime.Hours * 3600U +
+                    sAlarm->AlarmTime.Minutes * 60U +
+                    sAlarm->AlarmTime.Seconds;
+   rtc_alarm_weekday = sAlarm->AlarmDateWeekDay;
+   rtc_alarm_flag = 0;
+   rtc_alarm_armed = 1;
+   return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc,
+                                          uint32_t Alarm)
+{
+   (void)hrtc;
+   (void)Alarm;
+   rtc_alarm_armed = 0;
+   rtc_alarm_flag = 0;
+   return HAL_OK;
+}
+
+void HAL_RTC_AlarmIRQHandler(RTC_HandleTypeDef *hrtc)
+{
+   if (rtc_alarm_flag) {
+      rtc_alarm_flag = 0;
+      HAL_RTC_AlarmAEventCallback(hrtc);
+   }
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc,
+                            uint32_t BackupRegister)
+{
+   (void)hrtc;
+   return BackupRegister < RTC_BKP_NUMBER ? rtc_bkp[BackupRegister] : 0U;
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister,
+                         uint32_t Data)
+{
+   (void)hrtc;
+   if (BackupRegister < RTC_BKP_NUMBER)
+      rtc_bkp[BackupRegister] = Data;
+}
+
+/**
+ * @brief  This function is executed in case of error occurrence, the host
+ * build stops.
+ * @retval None
+ */
+void Error_Handler(void)
+{
+   fprintf(stderr, "host: Error_Handler\n");
+   abort();
+}
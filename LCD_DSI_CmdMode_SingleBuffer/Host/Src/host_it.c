@@ -0,0 +1,59 @@
+/*
+ * host_it.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "main.h"
+#include "stm32h7xx_it.h"
+
+/*
+ * Interrupt handlers of M7 in the host build, the same as in
+ * stm32h7xx_it.c. They are run by host_irq_poll(), which serves RTC alarm by
+ * the HAL handler directly.
+ */
+
+/**
+ * @brief  This function handles HSEM interrupt request of Cortex-M7.
+ * @param  None
+ * @retval None
+ */
+void HSEM1_IRQHandler(void) { HAL_HSEM_IRQHandler(); }
+
+/**
+ * @brief  This function handles TIM2 interrupt request, TIM2 is the core
+ *         clock and its compare is the deadline of the main loop.
+ * @param  None
+ * @retval None
+ */
+void TIM2_IRQHandler(void)
+{
+   core_clock_irq();
+   if (core_clock_alarm_irq())
+      app_event_tick((uint32_t)core_clock_ms());
+}
+
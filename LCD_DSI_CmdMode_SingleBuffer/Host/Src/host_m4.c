@@ -0,0 +1,84 @@
+/*
+ * host_m4.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "host.h"
+#include "main.h"
+
+/*
+ * M4 of the host build, run in the thread of M7 by the simulator and by the
+ * replay. It confirms heater requests as CM4 main.c does and keeps the heater
+ * state, so the commands sent by M7 can be checked.
+ */
+
+static int m4_heater = -1;
+static uint32_t m4_commands;
+
+int host_m4_run(void)
+{
+   int state = -1;
+   int ret;
+   core_msg_t msg;
+
+   if (!host_m4_event())
+      return 0;
+
+   host_core(CM4_CPUID);
+   HAL_PWREx_ClearPendingEvent();
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+
+   while ((ret = core_msg_receive_from_m7(&msg)) != -1) {
+      if (ret != 0 || msg.header.type != CORE_MSG_HEATER)
+         continue;
+      state = msg.payload.heater.on;
+      core_rpc_reply_m7(&msg, 0);
+   }
+
+   /* The periodic publish is left out, it would stop the fast-forward every
+    100 ms, a changed state is published at once, before M7 is notified */
+   if (state >= 0) {
+      if (state != m4_heater) {
+         const core_snapshot_t snapshot = {
+             .heater = (uint32_t)state,
+             .temperature = CORE_SNAPSHOT_NO_TEMPERATURE,
+             .faults = CORE_FAULT_SENSOR,
+             .uptime_ms = (uint32_t)core_clock_ms()};
+         m4_heater = state;
+         m4_commands++;
+         core_snapshot_write(&snapshot);
+      }
+      core_notify_m7();
+   }
+   host_core(CM7_CPUID);
+   return 1;
+}
+
+int host_m4_heater(void) { return m4_heater; }
+
+uint32_t host_m4_commands(void) { return m4_commands; }
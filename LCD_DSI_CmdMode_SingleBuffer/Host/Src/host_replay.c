@@ -0,0 +1,272 @@
+/*
+ * host_replay.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "host.h"
+#include "main.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Replay of the recording of app_record.c. AXI SRAM is loaded from its image,
+ * dumped from the board by debugger, e.g. by gdb
+ *    dump binary memory rec.bin 0x24000000 0x24080000
+ * or written by sim -w. The main loop of app_loop.c runs as on the board and
+ * app_event_idle() feeds it the recorded steps: the core clock is moved to
+ * the time of the step, the touch is set to the recorded read and the
+ * recorded events are posted. The timer event comes from app_event_tick() by
+ * the deadline the loop armed itself, TIM2 interrupt is enabled only while
+ * the clock is moved, so a deadline armed in the past fires with the step
+ * recorded for it. Time between steps is skipped, so a day
+ * of the recording takes milliseconds. Reset of the board restarts the clock
+ * and the state is loaded from the keyframe of the new session.
+ *
+ * After every step the heater state of the scene and the one requested from
+ * M4 are compared with the recorded output, at the end the state of the scene
+ * logic is compared with the recorded one.
+ */
+
+typedef struct {
+   uint32_t sessions;    /* boots in the recording */
+   uint32_t steps;       /* replayed steps of the scene logic */
+   uint64_t duration_us; /* replayed time of all sessions */
+   uint32_t commands;    /* changes of the recorded heater state */
+   uint32_t mismatches;  /* heater state differs from the recorded one */
+   uint32_t deadlines;   /* timer events not matching the loop's deadline */
+} replay_result_t;
+
+static App_t *replay_app;
+static App_keyframe_t keyframe;
+static app_record_cursor_t cursor;
+static replay_result_t result;
+static uint64_t last_us;
+static int expected = -1; /* recorded heater state after the fed step */
+static int recorded = -1; /* recorded heater state */
+static uint8_t restored;  /* state was just loaded from a keyframe */
+static jmp_buf replay_exit;
+
+/**
+ * @brief Compare the replayed state with the recorded one, the fields which
+ * depend on display and M4 timing are left out.
+ *
+ * @param a
+ * @param b
+ * @return 1 if the same
+ */
+static uint32_t replay_compare(const App_t *a, const App_t *b)
+{
+   return a->scene == b->scene && a->_delay == b->_delay &&
+          a->delay_start == b->delay_start && a->timer == b->timer &&
+          a->config_timer == b->config_timer &&
+          a->timer_left == b->timer_left &&
+          a->timer_start_time == b->timer_start_time &&
+          (a->delayed_start != 0) == (b->delayed_start != 0);
+}
+
+/**
+ * @brief Reset of the board, the core clock starts again and the scene logic
+ * is loaded from the keyframe
+ */
+static void replay_session(void)
+{
+   host_clock_reset();
+   core_clock_init();
+   HAL_NVIC_DisableIRQ(TIM2_IRQn);
+   app_event_deadline_cancel();
+   APP_KeyframeRestore(replay_app, &keyframe);
+   APP_InvalidateScene();
+   restored = 1;
+}
+
+/**
+ * @brief Check the heater state after the fed step, the loop has processed it
+ * and M4 has got the request
+ */
+static void replay_check(void)
+{
+   const int m4 = host_m4_heater();
+
+   if (expected < 0)
+      return;
+   if ((replay_app->scene == TURNON_SCENE) != expected ||
+       (m4 >= 0 && m4 != expected))
+      result.mismatches++;
+   if (expected != recorded) {
+      recorded = expected;
+      result.commands++;
+   }
+   expected = -1;
+}
+
+/**
+ * @brief Move the core clock, TIM2 interrupt runs meanwhile
+ * @param us
+ */
+static void replay_clock(const uint64_t us)
+{
+   HAL_NVIC_EnableIRQ(TIM2_IRQn);
+   host_clock_set(us);
+   HAL_NVIC_DisableIRQ(TIM2_IRQn);
+}
+
+/**
+ * @brief Feed the next step of the recording, once the loop has nothing else
+ * to do. The replay ends after the last one.
+ */
+void app_event_idle(void)
+{
+   app_record_entry_t entry;
+   uint32_t deadline;
+   uint64_t at;
+   int ret;
+
+   /* M4, the interrupts and the refresh run first */
+   host_m4_run();
+   if (host_irq_poll())
+      return;
+   if (host_dsi_busy(&at) == 0) {
+      host_dsi_done();
+      return;
+   }
+
+   replay_check();
+   ret = app_record_next(&cursor, &entry, &keyframe, sizeof(keyframe));
+   if (ret < 0)
+      longjmp(replay_exit, 1);
+   if (ret == 1) {
+      result.sessions++;
+      replay_session();
+   } else {
+      result.duration_us += cursor.time_us - last_us;
+   }
+   last_us = cursor.time_us;
+
+   /* The timer event has to come by the deadline, which is due now */
+   const uint32_t now = (uint32_t)(cursor.time_us / 1000U);
+   const uint32_t timer = (entry.input & APP_EVENT_TIMER) != 0;
+   const uint32_t due = app_event_deadline_get(&deadline) == 0 &&
+                        (int32_t)(now - deadline) >= 0;
+   if (due != timer && !restored)
+      result.deadlines++;
+   if (due && !timer)
+      app_event_deadline_cancel();
+
+   if ((entry.input & ~APP_RECORD_HEATER) == 0) {
+      /* Only the time goes on */
+      replay_clock(cursor.time_us);
+      return;
+   }
+
+   if (entry.input & APP_RECORD_SAMPLED)
+      host_touch((entry.input & APP_RECORD_TOUCHED) != 0,
+                 (entry.input >> APP_RECORD_X_Pos) & APP_RECORD_COORD_Msk,
+                 (entry.input >> APP_RECORD_Y_Pos) & APP_RECORD_COORD_Msk);
+   APP_RtcReplayDue((entry.input >> APP_RECORD_ALARMS_Pos) &
+                    APP_RECORD_ALARMS_Msk);
+
+   /* TIM2 compare passes the deadline, its handler calls app_event_tick() */
+   replay_clock(cursor.time_us);
+   if (timer && !due)
+      app_event_post(APP_EVENT_TIMER);
+   app_event_post(entry.input & APP_RECORD_EVENTS_Msk & ~APP_EVENT_TIMER);
+
+   expected = (entry.input & APP_RECORD_HEATER) != 0;
+   restored = 0;
+   result.steps++;
+}
+
+/**
+ * @brief  Touch controller EXTI callback, touch events are taken from the
+ *         recording.
+ * @param  Instance TS instance
+ * @retval None
+ */
+void BSP_TS_Callback(uint32_t Instance) { (void)Instance; }
+
+int main(int argc, char **argv)
+{
+   App_keyframe_t last;
+   struct timespec begin;
+   struct timespec end;
+   App_t app;
+
+   if (argc != 2) {
+      fprintf(stderr, "usage: %s recording\n", argv[0]);
+      return EXIT_FAILURE;
+   }
+
+   APP_RtcReplay(1);
+   host_start(0);
+   if (host_axi_load(argv[1]) != 0) {
+      fprintf(stderr, "replay: cannot read %s\n", argv[1]);
+      return EXIT_FAILURE;
+   }
+   if (app_record_first(&cursor, &keyframe, sizeof(keyframe)) != 0) {
+      fprintf(stderr, "replay: no recording in %s\n", argv[1]);
+      return EXIT_FAILURE;
+   }
+
+   clock_gettime(CLOCK_MONOTONIC, &begin);
+   replay_app = &app;
+   APP_Start(&app);
+   /* Events of the first step are fed from the recording */
+   (void)app_event_wait();
+   replay_session();
+   result.sessions = 1;
+   last_us = cursor.time_us;
+   if (setjmp(replay_exit) == 0) {
+      for (;;)
+         APP_Loop(&app);
+   }
+   clock_gettime(CLOCK_MONOTONIC, &end);
+
+   app_record_last_state(&last, sizeof(last));
+   const uint32_t state_ok = replay_compare(&app, &last.app);
+   const uint32_t commands_ok = host_m4_commands() == result.commands;
+   const int64_t wall_us =
+       ((int64_t)(end.tv_sec - begin.tv_sec) * 1000000000 +
+        (end.tv_nsec - begin.tv_nsec)) /
+       1000;
+
+   printf("sessions      %10u\n", result.sessions);
+   printf("steps         %10u\n", result.steps);
+   printf("replayed      %10.3f s\n", (double)result.duration_us / 1e6);
+   printf("host          %10.3f s\n", (double)wall_us / 1e6);
+   printf("heater        %10u commands (M4 got %u)\n", result.commands,
+          host_m4_commands());
+   printf("mismatches    %10u\n", result.mismatches);
+   printf("deadlines     %10u\n", result.deadlines);
+   printf("final state   %10s (scene %u, timer left %u ms)\n",
+          state_ok ? "ok" : "differs", app.scene, app.timer_left);
+
+   return result.mismatches == 0 && state_ok && commands_ok ? EXIT_SUCCESS
+                                                            : EXIT_FAILURE;
+}
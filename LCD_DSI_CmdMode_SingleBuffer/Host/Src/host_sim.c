@@ -0,0 +1,269 @@
+/*
+ * host_sim.c
+ *
+ *  Created on: 16. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "host.h"
+#include "main.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Simulator of the CM7 application on the host. The main loop of app_loop.c
+ * runs as on the board, app_event_idle() is replaced: instead of sleeping it
+ * fast-forwards the core clock to the next deadline, end of refresh, RTC
+ * alarm or touch of the script, so minutes of the toaster take milliseconds.
+ * M4 is simulated in the same thread by host_m4.c. Finished frames are
+ * counted and can be dumped as PPM images. The recording of the inputs is
+ * kept in AXI SRAM, its image can be written for the replay. Loading the image
+ * of a previous run is a reset of the board, the recording goes on.
+ *
+ * Script lines, times in ms of the core clock:
+ *    <ms> down <x> <y>
+ *    <ms> up
+ */
+
+#define SIM_SCRIPT_SIZE (256U)
+#define SIM_TAIL_MS (1000U) /* simulated after the last line of the script */
+
+typedef struct {
+   uint32_t ms;
+   uint32_t touched;
+   uint32_t x;
+   uint32_t y;
+} sim_touch_t;
+
+static sim_touch_t script[SIM_SCRIPT_SIZE];
+static uint32_t script_count;
+static uint32_t script_next;
+static uint64_t sim_end_us;
+static const char *sim_out; /* directory of the frame images */
+static const char *sim_reset;  /* recording kept over reset */
+static const char *sim_record; /* file of the recording */
+static jmp_buf sim_exit;
+
+/**
+ * @brief Load the touch script
+ * @param path
+ * @return 0 on success, -1 on error
+ */
+static int sim_load(const char *const path)
+{
+   FILE *const file = fopen(path, "r");
+   char line[128];
+
+   if (file == NULL)
+      return -1;
+   while (fgets(line, sizeof(line), file) != NULL &&
+          script_count < SIM_SCRIPT_SIZE) {
+      sim_touch_t *const touch = &script[script_count];
+      char action[8];
+
+      if (line[0] == '#' ||
+          sscanf(line, "%u %7s %u %u", &touch->ms, action, &touch->x,
+                 &touch->y) < 2)
+         continue;
+      touch->touched = strcmp(action, "down") == 0;
+      script_count++;
+   }
+   fclose(file);
+   return 0;
+}
+
+/**
+ * @brief Write the panel into the next image
+ */
+static void sim_dump(void)
+{
+   char path[512];
+
+   if (sim_out == NULL)
+      return;
+   snprintf(path, sizeof(path), "%s/frame_%05u.ppm", sim_out,
+            host_dsi_stats()->frames);
+   if (host_dsi_ppm(path) != 0)
+      fprintf(stderr, "sim: cannot write %s\n", path);
+}
+
+/**
+ * @brief Fast-forward to the next event source instead of sleeping. The
+ * simulation ends when the end time is reached.
+ */
+void app_event_idle(void)
+{
+   enum { SIM_END, SIM_TIMER, SIM_REFRESH, SIM_TOUCH } source = SIM_END;
+   uint64_t next = sim_end_us;
+   uint64_t at;
+   uint32_t deadline;
+
+   /* M4 and the interrupts pending now run first */
+   host_m4_run();
+   if (host_irq_poll())
+      return;
+
+   if (app_event_deadline_get(&deadline) == 0) {
+      const uint64_t now_ms = host_clock_get() / 1000U;
+      const int32_t left = (int32_t)(deadline - (uint32_t)now_ms);
+      at = 1000U * (left > 0 ? now_ms + (uint64_t)left : now_ms);
+      if (at <= next) {
+         next = at;
+         source = SIM_TIMER;
+      }
+   }
+   if (host_rtc_alarm(&at) == 0 && at <= next) {
+      next = at;
+      source = SIM_TIMER;
+   }
+   if (host_dsi_busy(&at) == 0 && at <= next) {
+      next = at;
+      source = SIM_REFRESH;
+   }
+   if (script_next < script_count &&
+       1000ULL * script[script_next].ms <= next) {
+      next = 1000ULL * script[script_next].ms;
+      source = SIM_TOUCH;
+   }
+
+   if (source == SIM_END)
+      longjmp(sim_exit, 1);
+
+   host_clock_set(next);
+   if (source == SIM_REFRESH && host_dsi_done())
+      sim_dump();
+   if (source == SIM_TOUCH) {
+      const sim_touch_t *const touch = &script[script_next++];
+      host_touch(touch->touched, touch->x, touch->y);
+   }
+}
+
+/**
+ * @brief  Touch controller EXTI callback.
+ * @param  Instance TS instance
+ * @retval None
+ */
+void BSP_TS_Callback(uint32_t Instance)
+{
+   (void)Instance;
+   app_event_post(APP_EVENT_TOUCH);
+}
+
+/**
+ * @brief Print the counters of the run
+ * @param wall_us host time of the run
+ */
+static void sim_report(const uint64_t wall_us)
+{
+   const host_dsi_stats_t *const dsi = host_dsi_stats();
+   const uint64_t sim_us = host_clock_get();
+
+   printf("simulated     %10.3f s\n", (double)sim_us / 1e6);
+   printf("host          %10.3f s\n", (double)wall_us / 1e6);
+   printf("frames        %10u\n", dsi->frames);
+   printf("regions       %10u\n", dsi->regions);
+   printf("fps host      %10.1f\n",
+          wall_us ? dsi->frames * 1e6 / (double)wall_us : 0.0);
+   printf("fps simulated %10.1f\n",
+          sim_us ? dsi->frames * 1e6 / (double)sim_us : 0.0);
+   printf("pixels/frame  %10.0f (max %u)\n",
+          dsi->frames ? (double)dsi->pixels / dsi->frames : 0.0,
+          dsi->max_pixels);
+   printf("heater LED    %10u\n", host_led(LED4));
+}
+
+int main(int argc, char **argv)
+{
+   uint32_t end_ms = 0;
+   uint32_t calendar = 0;
+   struct timespec begin;
+   struct timespec end;
+   App_t app;
+   int opt;
+
+   while ((opt = getopt(argc, argv, "s:o:t:r:i:w:")) != -1) {
+      switch (opt) {
+      case 's':
+         if (sim_load(optarg) != 0) {
+            fprintf(stderr, "sim: cannot read %s\n", optarg);
+            return EXIT_FAILURE;
+         }
+         break;
+      case 'o':
+         sim_out = optarg;
+         break;
+      case 't':
+         end_ms = (uint32_t)strtoul(optarg, NULL, 0);
+         break;
+      case 'r':
+         calendar = (uint32_t)strtoul(optarg, NULL, 0);
+         break;
+      case 'i':
+         sim_reset = optarg;
+         break;
+      case 'w':
+         sim_record = optarg;
+         break;
+      default:
+         fprintf(stderr,
+                 "usage: %s [-s script] [-o dir] [-t end ms] [-r rtc s] "
+                 "[-i recording] [-w recording]\n",
+                 argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+   if (end_ms == 0)
+      end_ms = (script_count ? script[script_count - 1U].ms : 0) + SIM_TAIL_MS;
+   sim_end_us = 1000ULL * end_ms;
+
+   clock_gettime(CLOCK_MONOTONIC, &begin);
+   host_start(calendar);
+   if (sim_reset != NULL && host_axi_load(sim_reset) != 0) {
+      fprintf(stderr, "sim: cannot read %s\n", sim_reset);
+      return EXIT_FAILURE;
+   }
+   app_record_start();
+   APP_Start(&app);
+   if (setjmp(sim_exit) == 0) {
+      for (;;)
+         APP_Loop(&app);
+   }
+   clock_gettime(CLOCK_MONOTONIC, &end);
+
+   sim_report((uint64_t)(((int64_t)(end.tv_sec - begin.tv_sec) *
+                              1000000000 +
+                          (end.tv_nsec - begin.tv_nsec)) /
+                         1000));
+   if (sim_record != NULL && host_axi_save(sim_record) != 0) {
+      fprintf(stderr, "sim: cannot write %s\n", sim_record);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
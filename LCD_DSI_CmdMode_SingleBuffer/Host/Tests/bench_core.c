@@ -0,0 +1,86 @@
+/*
+ * bench_core.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_bench.h"
+#include "cores_communication.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+
+/*
+ * The inter-core benchmark of core_bench.c, as it runs on the board, with M7
+ * and M4 as threads pinned to two CPUs. The cycle counters of both cores run
+ * at SystemCoreClock by the monotonic clock of the host.
+ */
+
+/**
+ * @brief M4 echoes until M7 is done
+ */
+static void *m4_run(void *const arg)
+{
+   (void)arg;
+   host_pin(1);
+   host_core(CM4_CPUID);
+   core_bench_run_m4();
+   return NULL;
+}
+
+int main(void)
+{
+   pthread_t thread;
+
+   test_watchdog(120);
+   host_pin(0);
+   core_share_init();
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+   core_bench_run_m7();
+   CHECK(pthread_join(thread, NULL) == 0);
+
+   const core_bench_table_t *const table = core_bench_results();
+   CHECK(table->done);
+   printf("core: %u round trips, %u messages streamed of every size\n",
+          CORE_BENCH_ROUNDS, CORE_BENCH_STREAM);
+   printf("%5s %8s %8s %8s %8s %8s %8s %10s %6s\n", "items", "rtt min",
+          "avg", "max", "1-way", "avg", "max", "messages/s", "full");
+   for (uint32_t i = 0; i < CORE_BENCH_SIZES; i++) {
+      const core_bench_result_t *const r = &table->result[i];
+
+      CHECK(r->size == BUFFSHAREDSIZE >> (CORE_BENCH_SIZES - 1U - i));
+      CHECK(r->rtt_min <= r->rtt_avg && r->rtt_avg <= r->rtt_max);
+      CHECK(r->msgs_per_s > 0);
+      printf("%5u %8u %8u %8u %8u %8u %8u %10u %5.1f%%\n", r->size,
+             r->rtt_min, r->rtt_avg, r->rtt_max, r->one_way_min,
+             r->one_way_avg, r->one_way_max, r->msgs_per_s,
+             r->full_permille / 10.0);
+   }
+   printf("times in ns\n");
+   return EXIT_SUCCESS;
+}
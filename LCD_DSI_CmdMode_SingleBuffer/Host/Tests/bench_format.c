@@ -0,0 +1,104 @@
+/*
+ * bench_format.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_format.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Cost of the texts of the scenes by sprintf() and by app_format.c: the
+ * countdown of the status message and the time of the timer button. The
+ * texts are compared after the timing, so the compiler keeps both.
+ */
+
+#define BENCH_TEXTS (2000000U)
+#define BENCH_SLOTS (4096U) /* texts kept for the comparison */
+
+static char libc[BENCH_SLOTS][24];
+static char text[BENCH_SLOTS][24];
+
+/**
+ * @brief Print the rate of both ways
+ */
+static void bench_print(const char *const name, const uint64_t libc_ns,
+                        const uint64_t format_ns)
+{
+   printf("%-8s %10.1f %10.1f %8.1fx\n", name, (double)libc_ns / BENCH_TEXTS,
+          (double)format_ns / BENCH_TEXTS, (double)libc_ns / format_ns);
+}
+
+/**
+ * @brief The last texts written by both ways are the same
+ */
+static void bench_compare(void)
+{
+   for (uint32_t i = 0; i < BENCH_SLOTS; i++)
+      CHECK(strcmp(libc[i], text[i]) == 0);
+}
+
+int main(void)
+{
+   uint64_t start, libc_ns, format_ns;
+
+   printf("format: %u texts each\n", BENCH_TEXTS);
+   printf("%-8s %10s %10s %9s\n", "", "sprintf ns", "format ns", "speedup");
+
+   start = test_ns();
+   for (uint32_t i = 0; i < BENCH_TEXTS; i++)
+      sprintf(libc[i % BENCH_SLOTS], "  Start in %ld min", (long)(i % 600U));
+   libc_ns = test_ns() - start;
+   start = test_ns();
+   for (uint32_t i = 0; i < BENCH_TEXTS; i++) {
+      char *end = app_format_str(text[i % BENCH_SLOTS], "  Start in ");
+      end = app_format_uint(end, i % 600U, 1, ' ');
+      end = app_format_str(end, " min");
+      *end = '\0';
+   }
+   format_ns = test_ns() - start;
+   bench_compare();
+   bench_print("status", libc_ns, format_ns);
+
+   start = test_ns();
+   for (uint32_t i = 0; i < BENCH_TEXTS; i++) {
+      const uint32_t seconds = i * 37U % 86400U;
+      sprintf(libc[i % BENCH_SLOTS], "%02ld:%02ld:%02ld",
+              (long)(seconds / 3600U), (long)(seconds / 60U % 60U),
+              (long)(seconds % 60U));
+   }
+   libc_ns = test_ns() - start;
+   start = test_ns();
+   for (uint32_t i = 0; i < BENCH_TEXTS; i++)
+      *app_format_hms(text[i % BENCH_SLOTS], i * 37U % 86400U) = '\0';
+   format_ns = test_ns() - start;
+   bench_compare();
+   bench_print("hms", libc_ns, format_ns);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/*
+ * bench_frame.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_view.h"
+#include "host.h"
+#include "main.h"
+#include "test.h"
+
+/*
+ * Frames drawn on the LCD by APP_UpdateScene() with the soft DMA2D engine,
+ * timed by APP_RENDER_STATS on the monotonic clock of the host. make bench
+ * builds it with LCD_DMA2D_QUEUE 1 and 0, queued DMA2D operations against
+ * BSP drawing waiting for each. Every scene is drawn whole, then with the
+ * countdown running, where only changed widgets are drawn. The refresh of
+ * the panel ends right away, so only the CPU time of drawing is measured.
+ */
+
+#define BENCH_FRAMES (200U) /* frames of every scene and kind */
+
+/**
+ * @brief End the running refresh of the panel and draw the frame
+ * @param app
+ */
+static void bench_frame(App_t *const app)
+{
+   uint64_t us;
+
+   while (host_dsi_busy(&us) == 0)
+      (void)host_dsi_done();
+   APP_UpdateScene(app);
+   CHECK(!APP_RenderDeferred());
+}
+
+/**
+ * @brief Print the stats of the frames since the previous ones
+ * @param name
+ * @param stats
+ * @param last updated
+ */
+static void bench_print(const char *const name,
+                        const App_render_stats_t *const stats,
+                        App_render_stats_t *const last)
+{
+   const uint32_t frames = stats->frames - last->frames;
+   const double render = (double)(stats->render_us - last->render_us);
+   const double flush = (double)(stats->flush_us - last->flush_us);
+
+   CHECK(frames == SCENE_COUNT * BENCH_FRAMES);
+   printf("%-8s %9.1f %9.1f %9.1f\n", name, render / frames, flush / frames,
+          (render + flush) / frames);
+   *last = *stats;
+}
+
+int main(void)
+{
+   static App_t app;
+   const App_render_stats_t *const stats = APP_RenderStats();
+   App_render_stats_t last;
+
+   host_start(0);
+   APP_Start(&app);
+   app.timer = 10 * 60 * SECOND;
+   host_clock_wall(1);
+
+   printf("frame: LCD_DMA2D_QUEUE %u, %u frames of every scene\n",
+          LCD_DMA2D_QUEUE, BENCH_FRAMES);
+   printf("%-8s %9s %9s %9s\n", "", "render us", "flush us", "frame us");
+   last = *stats;
+   for (uint32_t i = 0; i < SCENE_COUNT; i++) {
+      APP_SceneLook(&app, (Scene_t)i);
+      app.timer_left = app.timer / 2;
+      for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+         APP_InvalidateScene();
+         bench_frame(&app);
+      }
+   }
+   bench_print("whole", stats, &last);
+
+   for (uint32_t i = 0; i < SCENE_COUNT; i++) {
+      APP_SceneLook(&app, (Scene_t)i);
+      app.timer_left = app.timer / 2;
+      for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+         app.timer_left -= SECOND;
+         bench_frame(&app);
+      }
+   }
+   bench_print("changes", stats, &last);
+   host_clock_wall(0);
+   printf("average frame_us %u\n", stats->frame_us);
+   return EXIT_SUCCESS;
+}
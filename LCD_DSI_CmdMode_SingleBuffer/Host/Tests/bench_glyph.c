@@ -0,0 +1,69 @@
+/*
+ * bench_glyph.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_bench.h"
+#include "host.h"
+#include "main.h"
+#include "test.h"
+
+/*
+ * Text drawn by APP_GlyphBench() of the application with the fonts of the
+ * scenes, row by row by the LCD utility and from the glyph cache by the soft
+ * DMA2D engine, timed by the monotonic clock of the host. The engine blends
+ * on the CPU here, on the board the cache leaves it to DMA2D.
+ */
+
+int main(void)
+{
+   static const char *const names[APP_GLYPH_BENCH_FONTS] = {
+       "Font16", "AvenirNext20", "Menlo32"};
+
+   host_start(0);
+   host_clock_wall(1);
+   APP_GlyphBench();
+   host_clock_wall(0);
+
+   const App_glyph_bench_t *const result = APP_GlyphBenchResults();
+   CHECK(result->done);
+   printf("glyph: %u screens of text with every font\n",
+          APP_GLYPH_BENCH_SCREENS);
+   printf("%-14s %9s %12s %12s %7s\n", "", "glyphs", "rows/s", "cached/s",
+          "ratio");
+   for (uint32_t i = 0; i < APP_GLYPH_BENCH_FONTS; i++) {
+      const App_glyph_font_t *const font = &result->font[i];
+
+      CHECK(font->rows_per_s != 0 && font->cached_per_s != 0);
+      printf("%-14s %9u %12u %12u %6.2fx\n", names[i], font->glyphs,
+             font->rows_per_s, font->cached_per_s,
+             (double)font->cached_per_s / font->rows_per_s);
+   }
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/*
+ * bench_notify.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_notify.h"
+#include "cores_communication.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+
+/*
+ * Latency of the notification of M4 on the host emulation. M7 posts a time
+ * stamp and notifies M4 sleeping in STOP mode, M4 takes the latency to its
+ * wakeup and answers, M7 sleeps in WFI until the answer. The threads are
+ * pinned to two CPUs, the latency includes the wakeup of a host thread.
+ */
+
+#define BENCH_ROUNDS (20000U)
+
+static uint64_t wake_ns[BENCH_ROUNDS];
+static uint64_t round_ns[BENCH_ROUNDS];
+
+/**
+ * @brief M4 answers every message by the latency of its wakeup
+ */
+static void *m4_run(void *const arg)
+{
+   uint32_t rounds = 0;
+   int msg[2];
+
+   (void)arg;
+   host_pin(1);
+   host_core(CM4_CPUID);
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   while (rounds < BENCH_ROUNDS) {
+      core_wait_m7();
+      while (get_from_m7(msg, 2) == 2) {
+         const uint64_t stamp =
+             (uint64_t)(uint32_t)msg[0] | (uint64_t)(uint32_t)msg[1] << 32;
+         wake_ns[rounds++] = test_ns() - stamp;
+         CHECK(put_to_m7(msg, 2) == 2);
+         core_notify_m7();
+      }
+   }
+   return NULL;
+}
+
+/**
+ * @brief The notification is disabled by the IRQ handler, it is activated
+ * again as by the application. The interrupt may run in any critical section
+ * of M7 too.
+ */
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+   if (SemMask & __HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7))
+      HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+}
+
+/**
+ * @brief M7 sleeps until the HSEM interrupt of the answer
+ */
+static void m7_wait(void)
+{
+   while (pending_from_m4() == 0) {
+      __WFI();
+      host_irq_poll();
+   }
+}
+
+int main(void)
+{
+   pthread_t thread;
+   int msg[2];
+
+   test_watchdog(60);
+   host_pin(0);
+   core_share_init();
+   core_notify_init();
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_NVIC_EnableIRQ(HSEM1_IRQn);
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+
+   for (uint32_t r = 0; r < BENCH_ROUNDS; r++) {
+      const uint64_t start = test_ns();
+
+      msg[0] = (int)(uint32_t)start;
+      msg[1] = (int)(uint32_t)(start >> 32);
+      CHECK(put_to_m4(msg, 2) == 2);
+      core_notify_m4();
+      m7_wait();
+      CHECK(get_from_m4(msg, 2) == 2);
+      round_ns[r] = test_ns() - start;
+   }
+   CHECK(pthread_join(thread, NULL) == 0);
+
+   printf("notify: %u rounds M7 -> M4 -> M7\n", BENCH_ROUNDS);
+   printf("%-12s %10s %10s %10s\n", "", "p50 ns", "p99 ns", "max ns");
+   printf("%-12s %10llu %10llu %10llu\n", "M4 wakeup",
+          (unsigned long long)test_percentile(wake_ns, BENCH_ROUNDS, 50),
+          (unsigned long long)test_percentile(wake_ns, BENCH_ROUNDS, 99),
+          (unsigned long long)test_percentile(wake_ns, BENCH_ROUNDS, 100));
+   printf("%-12s %10llu %10llu %10llu\n", "round trip",
+          (unsigned long long)test_percentile(round_ns, BENCH_ROUNDS, 50),
+          (unsigned long long)test_percentile(round_ns, BENCH_ROUNDS, 99),
+          (unsigned long long)test_percentile(round_ns, BENCH_ROUNDS, 100));
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+/*
+ * bench_protocol.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_protocol.h"
+#include "cores_communication.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Throughput of the message codec of core_protocol.c on one thread: encode
+ * and decode of every type, then the whole path of a message through the
+ * ring, encoded in the slot by core_msg_send_to_m4() and decoded from it by
+ * core_msg_receive_from_m7().
+ */
+
+#define BENCH_MESSAGES (2000000U)
+
+#define BENCH_NAME(id, member, type) [id] = #member,
+static const char *const names[CORE_MSG_COUNT] = {CORE_MSG_TABLE(BENCH_NAME)};
+#undef BENCH_NAME
+
+/**
+ * @brief Print the rate of the measured messages
+ */
+static void bench_print(const char *const name, const uint64_t elapsed)
+{
+   printf("%-12s %12llu %8.1f\n", name,
+          (unsigned long long)((uint64_t)BENCH_MESSAGES * 1000000000ULL /
+                               elapsed),
+          (double)elapsed / BENCH_MESSAGES);
+}
+
+int main(void)
+{
+   static int buffer[BUFFSHAREDSIZE];
+   volatile uint32_t sink = 0;
+   core_msg_t msg, out;
+
+   printf("protocol: %u messages each\n", BENCH_MESSAGES);
+   printf("%-12s %12s %8s\n", "", "messages/s", "ns");
+   for (uint8_t type = 0; type < CORE_MSG_COUNT; type++) {
+      memset(&msg, 0, sizeof(msg));
+      msg.header.type = type;
+
+      const uint64_t start = test_ns();
+      for (uint32_t m = 0; m < BENCH_MESSAGES; m++) {
+         msg.header.seq = m;
+         const int size = core_msg_encode(&msg, buffer, BUFFSHAREDSIZE);
+         CHECK(core_msg_decode(buffer, (unsigned int)size, &out) == 0);
+         sink += out.header.seq;
+      }
+      bench_print(names[type], test_ns() - start);
+   }
+
+   /* Through the ring, a slot at a time as the heater requests go */
+   core_share_init();
+   memset(&msg, 0, sizeof(msg));
+   msg.header.type = CORE_MSG_HEATER;
+   const uint64_t start = test_ns();
+   for (uint32_t m = 0; m < BENCH_MESSAGES; m++) {
+      msg.payload.heater.on = (int32_t)(m & 1U);
+      CHECK(core_msg_send_to_m4(&msg) == 0);
+      CHECK(core_msg_receive_from_m7(&out) == 0);
+      sink += (uint32_t)out.payload.heater.on;
+   }
+   bench_print("ring heater", test_ns() - start);
+   (void)sink;
+   return EXIT_SUCCESS;
+}
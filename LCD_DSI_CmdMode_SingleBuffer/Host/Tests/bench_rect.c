@@ -0,0 +1,65 @@
+/*
+ * bench_rect.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_rect.h"
+#include "stm32h7xx_hal.h"
+#include "test.h"
+
+/*
+ * Coalescing of the dirty rectangles on the update patterns of the UI by
+ * app_rect_bench_run() of the application. The cycles are counted at
+ * SystemCoreClock of the host DWT, which runs by the monotonic clock.
+ */
+
+int main(void)
+{
+   static const char *const names[APP_RECT_PATTERN_COUNT] = {
+       [APP_RECT_PATTERN_PROGRESS] = "progress",
+       [APP_RECT_PATTERN_COUNTDOWN] = "countdown",
+       [APP_RECT_PATTERN_DIAL] = "dial",
+       [APP_RECT_PATTERN_SCENE] = "scene"};
+
+   app_rect_bench_run();
+
+   const app_rect_bench_t *const result = app_rect_bench_results();
+   CHECK(result->done);
+   printf("rect: %u updates of every pattern\n", APP_RECT_BENCH_COUNT);
+   printf("%-10s %8s %8s %8s %8s %8s\n", "", "adds", "cycles", "ns",
+          "regions", "area");
+   for (uint32_t i = 0; i < APP_RECT_PATTERN_COUNT; i++) {
+      const app_rect_bench_pattern_t *const p = &result->pattern[i];
+
+      printf("%-10s %8u %8u %8.1f %8u %7.1f%%\n", names[i], p->adds,
+             p->add_avg, p->add_avg * 1000.0 / (SystemCoreClock / 1000000U),
+             p->regions, p->area * 100.0 / (800.0 * 480.0));
+   }
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/*
+ * bench_render.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "host.h"
+#include "main.h"
+#include "test.h"
+
+/*
+ * Rendering of the scenes into the software frame buffer by APP_FbBench() of
+ * the application, timed by the monotonic clock of the host. The columns with
+ * caches off are filled in on the board only, the host has no switch for its
+ * caches.
+ */
+
+int main(void)
+{
+   static const char *const names[SCENE_COUNT] = {
+       [FRONT_SCREEN] = "front", [TURNON_SCENE] = "turn on",
+       [TIMER_CONFIG_SCENE] = "timer", [WAITING_SCENE] = "waiting"};
+
+   host_init();
+   core_clock_init();
+   host_clock_wall(1);
+   APP_FbBench();
+   host_clock_wall(0);
+
+   const App_fb_bench_t *const result = APP_FbBenchResults();
+   CHECK(result->done);
+   printf("render: %u frames of every scene\n", result->frames);
+   printf("%-10s %9s %9s %9s %9s\n", "", "full us", "pixels", "frame us",
+          "pixels");
+   for (uint32_t i = 0; i < SCENE_COUNT; i++) {
+      const App_fb_scene_t *const scene = &result->scene[i];
+
+      printf("%-10s %9u %9u %9u %9u\n", names[i], scene->full_us,
+             scene->full_pixels, scene->frame_us, scene->pixels);
+   }
+   printf("changed widgets: %u fps\n", result->fps);
+   return EXIT_SUCCESS;
+}
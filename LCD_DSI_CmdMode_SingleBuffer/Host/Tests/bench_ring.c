@@ -0,0 +1,246 @@
+/*
+ * bench_ring.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cores_communication.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+#include <sched.h>
+
+/*
+ * Throughput and latency of one ring, M7 to M4, by the copying API one message
+ * at a time and in batches, and by the zero-copy API. The producer and the
+ * consumer are threads pinned to two CPUs. The producer writes every item of
+ * the message and stamps it by the host clock, the consumer reads every item
+ * and takes the latency. The ring is kept full, so the latency includes
+ * waiting in the queue.
+ */
+
+#define BENCH_MESSAGES (200000U)
+#define BENCH_BATCH (4U)
+#define BENCH_STAMP (2U) /* items of the time stamp at the message start */
+
+/* Way of sending and receiving */
+typedef struct {
+   const char *name;
+   /* Send up to count messages, return how many were sent */
+   uint32_t (*send)(uint32_t count);
+   /* Receive messages, return how many were received */
+   uint32_t (*receive)(uint32_t m);
+} bench_mode_t;
+
+typedef struct {
+   unsigned int size; /* items of the message */
+   uint64_t sum;      /* of the received items, so they are read */
+   uint64_t latency[BENCH_MESSAGES];
+} bench_t;
+
+static bench_t bench;
+
+/**
+ * @brief Wait for the other thread, the host may have a single CPU
+ */
+static void bench_wait(void) { sched_yield(); }
+
+/**
+ * @brief Write the message with the time stamp
+ */
+static void bench_fill(int *const msg, const uint64_t now)
+{
+   msg[0] = (int)(uint32_t)now;
+   msg[1] = (int)(uint32_t)(now >> 32);
+   for (unsigned int i = BENCH_STAMP; i < bench.size; i++)
+      msg[i] = (int)i;
+}
+
+/**
+ * @brief Read the message, take latency of its time stamp
+ */
+static void bench_read(const int *const msg, const uint32_t m,
+                       const uint64_t now)
+{
+   const uint64_t stamp =
+       (uint64_t)(uint32_t)msg[0] | (uint64_t)(uint32_t)msg[1] << 32;
+   uint64_t sum = 0;
+
+   for (unsigned int i = BENCH_STAMP; i < bench.size; i++)
+      sum += (uint32_t)msg[i];
+   bench.sum += sum;
+   bench.latency[m] = now - stamp;
+}
+
+/* Copy, one message ---------------------------------------------------------*/
+
+static uint32_t copy_send(const uint32_t count)
+{
+   static int buffer[BUFFSHAREDSIZE];
+
+   (void)count;
+   bench_fill(buffer, test_ns());
+   return put_to_m4(buffer, bench.size) == (int)bench.size ? 1U : 0U;
+}
+
+static uint32_t copy_receive(const uint32_t m)
+{
+   static int buffer[BUFFSHAREDSIZE];
+
+   if (get_from_m7(buffer, BUFFSHAREDSIZE) < 0)
+      return 0;
+   bench_read(buffer, m, test_ns());
+   return 1;
+}
+
+/* Copy, batch of messages ---------------------------------------------------*/
+
+static uint32_t batch_send(const uint32_t count)
+{
+   static int buffer[BENCH_BATCH * BUFFSHAREDSIZE];
+   const uint32_t n = count < BENCH_BATCH ? count : BENCH_BATCH;
+   const uint64_t now = test_ns();
+
+   for (uint32_t m = 0; m < n; m++)
+      bench_fill(&buffer[m * bench.size], now);
+   return (uint32_t)put_batch_to_m4(buffer, bench.size, n);
+}
+
+static uint32_t batch_receive(const uint32_t m)
+{
+   static int buffer[BENCH_BATCH * BUFFSHAREDSIZE];
+   const int n = get_batch_from_m7(buffer, BUFFSHAREDSIZE, BENCH_BATCH);
+   const uint64_t now = test_ns();
+
+   for (int i = 0; i < n; i++)
+      bench_read(&buffer[i * BUFFSHAREDSIZE], m + (uint32_t)i, now);
+   return (uint32_t)n;
+}
+
+/* Zero-copy, in the slot of the ring -------------------------------------*/
+
+static uint32_t slot_send(const uint32_t count)
+{
+   int *const slot = reserve_to_m4();
+
+   (void)count;
+   if (slot == NULL)
+      return 0;
+   bench_fill(slot, test_ns());
+   commit_to_m4(bench.size);
+   return 1;
+}
+
+static uint32_t slot_receive(const uint32_t m)
+{
+   unsigned int size;
+   const int *const msg = peek_from_m7(&size);
+
+   if (msg == NULL)
+      return 0;
+   bench_read(msg, m, test_ns());
+   release_from_m7();
+   return 1;
+}
+
+static const bench_mode_t modes[] = {
+    {"copy", copy_send, copy_receive},
+    {"batch", batch_send, batch_receive},
+    {"zero-copy", slot_send, slot_receive},
+};
+static const bench_mode_t *mode;
+
+/**
+ * @brief Producer, M4 side is the consumer
+ */
+static void *bench_producer(void *const arg)
+{
+   (void)arg;
+   host_pin(0);
+   for (uint32_t m = 0; m < BENCH_MESSAGES;) {
+      const uint32_t sent = mode->send(BENCH_MESSAGES - m);
+
+      m += sent;
+      if (sent == 0)
+         bench_wait();
+   }
+   return NULL;
+}
+
+/**
+ * @brief Consumer, takes the latency of every message
+ */
+static void bench_consumer(void)
+{
+   host_pin(1);
+   for (uint32_t m = 0; m < BENCH_MESSAGES;) {
+      const uint32_t received = mode->receive(m);
+
+      m += received;
+      if (received == 0)
+         bench_wait();
+   }
+}
+
+int main(void)
+{
+   static const unsigned int sizes[] = {BENCH_STAMP, 16U, BUFFSHAREDSIZE};
+
+   printf("ring: %u messages M7 -> M4, %u slots, batch of %u\n",
+          BENCH_MESSAGES, CORE_RING_DEPTH, BENCH_BATCH);
+   printf("%-10s %6s %12s %10s %10s\n", "", "items", "messages/s", "p50 ns",
+          "p99 ns");
+   for (size_t k = 0; k < sizeof(modes) / sizeof(modes[0]); k++) {
+      mode = &modes[k];
+      for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+         pthread_t thread;
+
+         core_share_init();
+         bench.size = sizes[i];
+         bench.sum = 0;
+         const uint64_t start = test_ns();
+         CHECK(pthread_create(&thread, NULL, bench_producer, NULL) == 0);
+         bench_consumer();
+         CHECK(pthread_join(thread, NULL) == 0);
+         const uint64_t elapsed = test_ns() - start;
+
+         /* Every item arrived */
+         const uint64_t items = bench.size - BENCH_STAMP;
+         CHECK(bench.sum ==
+               BENCH_MESSAGES * (items * (BENCH_STAMP + bench.size - 1U) / 2U));
+
+         const uint64_t p99 =
+             test_percentile(bench.latency, BENCH_MESSAGES, 99);
+         const uint64_t p50 =
+             test_percentile(bench.latency, BENCH_MESSAGES, 50);
+         printf("%-10s %6u %12llu %10llu %10llu\n", mode->name, bench.size,
+                (unsigned long long)((uint64_t)BENCH_MESSAGES * 1000000000ULL /
+                                     elapsed),
+                (unsigned long long)p50, (unsigned long long)p99);
+      }
+   }
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/*
+ * bench_rpc.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_clock.h"
+#include "core_notify.h"
+#include "core_rpc.h"
+#include "cores_communication.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+
+/*
+ * Latency of a heater request confirmed by M4, as APP_TurnPeripheries() makes
+ * it: M7 calls, notifies M4 and sleeps in WFI, M4 wakes up from STOP mode,
+ * answers and notifies M7. The time is taken from the call to the poll which
+ * returns its status. The threads are pinned to two CPUs.
+ */
+
+#define BENCH_CALLS (20000U)
+#define BENCH_TIMEOUT (100U) /* ms, as HEATER_RPC_TIMEOUT */
+
+static uint64_t call_ns[BENCH_CALLS];
+
+/**
+ * @brief The notification is disabled by the IRQ handler, it is activated
+ * again as by the application
+ */
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+   if (SemMask & __HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7))
+      HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+}
+
+/**
+ * @brief M4 confirms every heater request
+ */
+static void *m4_run(void *const arg)
+{
+   uint32_t answered = 0;
+   core_msg_t msg;
+
+   (void)arg;
+   host_pin(1);
+   host_core(CM4_CPUID);
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   while (answered < BENCH_CALLS) {
+      core_wait_m7();
+      while (core_msg_receive_from_m7(&msg) == 0) {
+         CHECK(core_rpc_reply_m7(&msg, 0) == 0);
+         answered++;
+      }
+      core_notify_m7();
+   }
+   return NULL;
+}
+
+int main(void)
+{
+   pthread_t thread;
+
+   test_watchdog(60);
+   host_pin(0);
+   host_init();
+   core_clock_init();
+   host_clock_wall(1);
+   core_share_init();
+   core_notify_init();
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M7));
+   HAL_NVIC_EnableIRQ(HSEM1_IRQn);
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+
+   for (uint32_t c = 0; c < BENCH_CALLS; c++) {
+      core_msg_t msg = {.header.type = CORE_MSG_HEATER,
+                        .payload.heater.on = (int32_t)(c & 1U)};
+      const uint64_t start = test_ns();
+      int32_t status = -1;
+      int ret;
+
+      const int call = core_rpc_call_m4(&msg, BENCH_TIMEOUT);
+      CHECK(call >= 0);
+      core_notify_m4();
+      for (;;) {
+         core_rpc_process();
+         ret = core_rpc_poll(call, &status);
+         if (ret != CORE_RPC_PENDING)
+            break;
+         __WFI();
+         host_irq_poll();
+      }
+      CHECK(ret == CORE_RPC_DONE && status == 0);
+      call_ns[c] = test_ns() - start;
+   }
+   CHECK(pthread_join(thread, NULL) == 0);
+
+   printf("rpc: %u heater calls confirmed by M4\n", BENCH_CALLS);
+   printf("p50 %llu ns, p99 %llu ns, max %llu ns\n",
+          (unsigned long long)test_percentile(call_ns, BENCH_CALLS, 50),
+          (unsigned long long)test_percentile(call_ns, BENCH_CALLS, 99),
+          (unsigned long long)test_percentile(call_ns, BENCH_CALLS, 100));
+   return EXIT_SUCCESS;
+}
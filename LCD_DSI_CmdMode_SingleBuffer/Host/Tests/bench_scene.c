@@ -0,0 +1,96 @@
+/*
+ * bench_scene.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_scene.h"
+#include "host.h"
+#include "test.h"
+
+/*
+ * Cost of APP_Dispatch() with the entry actions, by the cycles of scenes the
+ * buttons go through. The manual start sets the software timer and the front
+ * scene cancels it, the waiting scene adds the delayed start into the
+ * schedule, which is stored in the RTC backup registers and armed as the
+ * alarm. An event without transition is only the look up in the table.
+ */
+
+#define BENCH_ROUNDS (200000U)
+
+/* Cycles back to the front scene */
+static const struct {
+   const char *name;
+   uint32_t count;
+   Event_t event[4];
+} cycle[] = {
+    {"manual", 2, {EVENT_LEFT_BUTTON, EVENT_LEFT_BUTTON}},
+    {"delayed", 3,
+     {EVENT_RIGHT_BUTTON, EVENT_RIGHT_BUTTON, EVENT_LEFT_BUTTON}},
+    {"scheduled", 4,
+     {EVENT_RIGHT_BUTTON, EVENT_RIGHT_BUTTON, EVENT_SCHEDULED_START,
+      EVENT_LEFT_BUTTON}},
+};
+
+int main(void)
+{
+   static App_t app;
+
+   host_start(0);
+   app_schedule_init();
+   APP_Init(&app);
+
+   printf("scene: %u rounds each\n", BENCH_ROUNDS);
+   printf("%-12s %12s %8s\n", "", "dispatch/s", "ns");
+   for (uint32_t c = 0; c < sizeof(cycle) / sizeof(cycle[0]); c++) {
+      const uint64_t start = test_ns();
+      for (uint32_t round = 0; round < BENCH_ROUNDS; round++)
+         for (uint32_t i = 0; i < cycle[c].count; i++)
+            APP_Dispatch(&app, cycle[c].event[i]);
+      const uint64_t elapsed = test_ns() - start;
+      CHECK(app.scene == FRONT_SCREEN);
+
+      const uint64_t events = (uint64_t)BENCH_ROUNDS * cycle[c].count;
+      printf("%-12s %12llu %8.1f\n", cycle[c].name,
+             (unsigned long long)(events * 1000000000ULL / elapsed),
+             (double)elapsed / (double)events);
+   }
+
+   /* No transition, the right button of the manual start */
+   APP_Dispatch(&app, EVENT_LEFT_BUTTON);
+   const uint64_t start = test_ns();
+   for (uint32_t round = 0; round < BENCH_ROUNDS; round++)
+      APP_Dispatch(&app, EVENT_RIGHT_BUTTON);
+   const uint64_t elapsed = test_ns() - start;
+   CHECK(app.scene == TURNON_SCENE);
+   printf("%-12s %12llu %8.1f\n", "none",
+          (unsigned long long)((uint64_t)BENCH_ROUNDS * 1000000000ULL /
+                               elapsed),
+          (double)elapsed / BENCH_ROUNDS);
+   return EXIT_SUCCESS;
+}
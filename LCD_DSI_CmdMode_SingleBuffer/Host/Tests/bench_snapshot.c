@@ -0,0 +1,122 @@
+/*
+ * bench_snapshot.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_snapshot.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*
+ * Throughput of the seqlock snapshot of core_snapshot.c: the writer and the
+ * reader alone on one thread, then both at once on two pinned threads, where
+ * the reader may have to retry or give up while the writer is updating.
+ */
+
+#define BENCH_OPS (20000000U)
+#define BENCH_NS (1000000000ULL) /* how long the threads run together */
+
+static atomic_uint writer_done;
+static uint64_t writes;
+
+/**
+ * @brief Print the rate of the operations
+ */
+static void bench_print(const char *const name, const uint64_t ops,
+                        const uint64_t elapsed)
+{
+   printf("%-16s %12llu %8.1f\n", name,
+          (unsigned long long)(ops * 1000000000ULL / elapsed),
+          (double)elapsed / (double)ops);
+}
+
+/**
+ * @brief M4 publishes as fast as it can until the time is up
+ */
+static void *m4_run(void *const arg)
+{
+   const uint64_t end = test_ns() + BENCH_NS;
+   core_snapshot_t snapshot = {0};
+
+   (void)arg;
+   host_pin(1);
+   do {
+      for (uint32_t i = 0; i < 1000U; i++) {
+         snapshot.uptime_ms++;
+         core_snapshot_write(&snapshot);
+      }
+      writes += 1000U;
+   } while (test_ns() < end);
+   atomic_store(&writer_done, 1U);
+   return NULL;
+}
+
+int main(void)
+{
+   core_snapshot_t snapshot = {0};
+   uint64_t reads = 0, busy = 0;
+   pthread_t thread;
+
+   host_pin(0);
+   core_snapshot_init();
+   printf("snapshot: %zu bytes\n", sizeof(snapshot));
+   printf("%-16s %12s %8s\n", "", "ops/s", "ns");
+
+   uint64_t start = test_ns();
+   for (uint32_t i = 0; i < BENCH_OPS; i++) {
+      snapshot.uptime_ms = i;
+      core_snapshot_write(&snapshot);
+   }
+   bench_print("write alone", BENCH_OPS, test_ns() - start);
+
+   start = test_ns();
+   for (uint32_t i = 0; i < BENCH_OPS; i++)
+      reads += (uint64_t)(core_snapshot_read(&snapshot) == 0);
+   bench_print("read alone", BENCH_OPS, test_ns() - start);
+   CHECK(reads == BENCH_OPS);
+
+   reads = 0;
+   start = test_ns();
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+   while (!atomic_load(&writer_done)) {
+      if (core_snapshot_read(&snapshot) == 0)
+         reads++;
+      else
+         busy++;
+   }
+   CHECK(pthread_join(thread, NULL) == 0);
+   const uint64_t elapsed = test_ns() - start;
+   bench_print("write, shared", writes, elapsed);
+   bench_print("read, shared", reads, elapsed);
+   printf("reads gave up: %llu (%.2f %%)\n", (unsigned long long)busy,
+          100.0 * (double)busy / (double)(reads + busy));
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/*
+ * bench_timer.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_timer.h"
+#include "core_clock.h"
+#include "host.h"
+#include "test.h"
+
+/*
+ * The timer wheel by app_timer_bench_run() of the application with 10k and
+ * 100k timers restarted on expiry, timed by the monotonic clock of the host.
+ * The cost of one tick should not grow with the count of the timers, only
+ * the callbacks do.
+ */
+
+#define BENCH_TIMERS_MAX (100000U)
+
+/* Storage of the timers, the board passes AXI SRAM instead */
+static app_timer_t timers[BENCH_TIMERS_MAX];
+
+int main(void)
+{
+   static const uint32_t counts[] = {10000U, BENCH_TIMERS_MAX};
+
+   host_init();
+   core_clock_init();
+   host_clock_wall(1);
+
+   printf("timer: %u ticks of 1 ms\n", APP_TIMER_BENCH_TICKS);
+   printf("%8s %9s %9s %9s %9s %9s\n", "timers", "expired", "start ns",
+          "cancel ns", "tick ns", "max us");
+   for (uint32_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+      app_timer_bench_run(timers, counts[i]);
+
+      const app_timer_bench_t *const result = app_timer_bench_results();
+      CHECK(result->done);
+      CHECK(result->timers == counts[i]);
+      printf("%8u %9u %9u %9u %9u %9u\n", result->timers, result->expired,
+             result->start_ns, result->cancel_ns, result->tick_ns,
+             result->tick_max_us);
+   }
+
+   host_clock_wall(0);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/*
+ * test.h
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Helpers of the host tests and benchmarks. A test is a program, which exits
+ * with failure at the first failed check.
+ */
+
+/* Stop the test if the condition does not hold */
+#define CHECK(cond)                                                            \
+   do {                                                                        \
+      if (!(cond)) {                                                           \
+         fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,      \
+                 #cond);                                                       \
+         exit(EXIT_FAILURE);                                                   \
+      }                                                                        \
+   } while (0)
+
+/**
+ * @brief Fail the test stuck on a lost wakeup or in a deadlock
+ */
+static void test_timeout(int sig)
+{
+   static const char text[] = "test: timed out\n";
+
+   (void)sig;
+   (void)!write(STDERR_FILENO, text, sizeof(text) - 1U);
+   _exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Start the watchdog of the test
+ * @param seconds the test fails when it does not finish until then
+ */
+static inline void test_watchdog(const unsigned int seconds)
+{
+   signal(SIGALRM, test_timeout);
+   alarm(seconds);
+}
+
+/**
+ * @brief Pseudo-random number, xorshift32, the same sequence on every run
+ * @param state non-zero seed, updated
+ * @return uint32_t
+ */
+static inline uint32_t test_random(uint32_t *const state)
+{
+   uint32_t x = *state;
+
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *state = x;
+   return x;
+}
+
+/**
+ * @brief Read the monotonic clock of the host
+ * @return uint64_t ns
+ */
+static inline uint64_t test_ns(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Compare for qsort()
+ */
+static inline int test_compare_u64(const void *a, const void *b)
+{
+   const uint64_t x = *(const uint64_t *)a;
+   const uint64_t y = *(const uint64_t *)b;
+
+   return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentile of the samples, they are sorted
+ * @param samples
+ * @param count
+ * @param percent 0 .. 100
+ * @return uint64_t
+ */
+static inline uint64_t test_percentile(uint64_t *const samples,
+                                       const size_t count,
+                                       const unsigned int percent)
+{
+   if (count == 0)
+      return 0;
+   qsort(samples, count, sizeof(samples[0]), test_compare_u64);
+   return samples[(count - 1U) * percent / 100U];
+}
+
+#endif /* TEST_H_ */
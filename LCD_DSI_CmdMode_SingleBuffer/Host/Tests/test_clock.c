@@ -0,0 +1,203 @@
+/*
+ * test_clock.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_clock.h"
+#include "host.h"
+#include "stm32h7xx_hal.h"
+#include "test.h"
+
+/*
+ * Test of the 64-bit clock of core_clock.c over the wraps of the 32-bit TIM2
+ * counter, which the host moves by host_clock_set(). The clock is read on M7
+ * and on M4 around every wrap, also while the wrap is pending because the
+ * interrupt is masked or M4 reads it before M7 counts it, and then on a walk
+ * of random steps through a few wraps. The alarm is checked with the
+ * interrupt handler called by the test, so it is known when it fires.
+ */
+
+#define TEST_WRAP (1ULL << 32)
+#define TEST_WRAPS (6U)
+#define TEST_STEPS (2000000U)
+
+static uint64_t last_us;
+
+/**
+ * @brief Read the clock on the core, it has to be the host clock
+ */
+static void check_read(const uint32_t cpuid)
+{
+   host_core(cpuid);
+   const uint64_t us = core_clock_us();
+   host_core(CM7_CPUID);
+
+   CHECK(us == host_clock_get());
+   CHECK(us >= last_us);
+   CHECK(core_clock_ms() == us / 1000U);
+   last_us = us;
+}
+
+/**
+ * @brief Reads around the wraps, the interrupt counts them in time
+ */
+static void test_wraps(void)
+{
+   for (uint32_t wrap = 1; wrap <= TEST_WRAPS; wrap++) {
+      const uint64_t at = wrap * TEST_WRAP;
+
+      for (uint64_t us = at - 3U; us <= at + 3U; us++) {
+         host_clock_set(us);
+         check_read(CM7_CPUID);
+         check_read(CM4_CPUID);
+      }
+   }
+}
+
+/**
+ * @brief The wrap is pending while the interrupt is masked, or until M7 runs
+ */
+static void test_pending(void)
+{
+   const uint64_t at = (host_clock_get() / TEST_WRAP + 1U) * TEST_WRAP;
+
+   host_clock_set(at - 1U);
+   __disable_irq();
+   host_clock_set(at + 1U);
+   CHECK(TIM2->SR & TIM_SR_UIF);
+   check_read(CM7_CPUID);
+   check_read(CM4_CPUID);
+   __enable_irq();
+   CHECK((TIM2->SR & TIM_SR_UIF) == 0);
+   check_read(CM7_CPUID);
+
+   /* M4 moves the clock, M7 does not take the interrupt meanwhile */
+   host_core(CM4_CPUID);
+   host_clock_set(at + TEST_WRAP - 1U);
+   host_clock_set(at + TEST_WRAP + 1U);
+   host_core(CM7_CPUID);
+   CHECK(TIM2->SR & TIM_SR_UIF);
+   check_read(CM4_CPUID);
+   CHECK(host_irq_poll() == 1);
+   check_read(CM4_CPUID);
+   check_read(CM7_CPUID);
+}
+
+/**
+ * @brief Random steps, the short ones mostly, some up to the next wrap
+ * @return wraps passed
+ */
+static uint32_t test_walk(void)
+{
+   const uint64_t begin = host_clock_get();
+   uint32_t seed = 0x13579BDFU;
+
+   for (uint32_t step = 0; step < TEST_STEPS; step++) {
+      const uint32_t r = test_random(&seed);
+      uint64_t us = host_clock_get();
+
+      if ((r & 0xFFFU) == 0)
+         us = (us / TEST_WRAP + 1U) * TEST_WRAP - (r >> 28);
+      else
+         us += (r >> 12) % 1000000U + 1U;
+      host_clock_set(us);
+      check_read((r & 0x100U) ? CM4_CPUID : CM7_CPUID);
+   }
+   return (uint32_t)(host_clock_get() / TEST_WRAP - begin / TEST_WRAP);
+}
+
+/**
+ * @brief Interrupt of TIM2 as TIM2_IRQHandler runs it
+ * @return 1 if the alarm fired
+ */
+static int tim2_irq(void)
+{
+   core_clock_irq();
+   return core_clock_alarm_irq();
+}
+
+/**
+ * @brief Move the clock, the interrupt runs after it
+ */
+static int move(const uint64_t us)
+{
+   host_clock_set(us);
+   return tim2_irq();
+}
+
+/**
+ * @brief Alarm over the wrap, a wrap ahead, in the past and cancelled
+ */
+static void test_alarm(void)
+{
+   const uint64_t at = (host_clock_get() / TEST_WRAP + 1U) * TEST_WRAP;
+
+   HAL_NVIC_DisableIRQ(TIM2_IRQn);
+
+   /* Over the wrap, the compare register holds 100 */
+   CHECK(move(at - 50U) == 0);
+   core_clock_alarm(at + 100U);
+   CHECK(move(at + 99U) == 0);
+   CHECK(move(at + 100U) == 1);
+   CHECK(move(at + 200U) == 0);
+
+   /* The low word matches a wrap before the alarm */
+   core_clock_alarm(at + TEST_WRAP + 300U);
+   CHECK(move(at + 300U) == 0);
+   CHECK(move(at + TEST_WRAP - 1U) == 0);
+   CHECK(move(at + TEST_WRAP + 299U) == 0);
+   CHECK(move(at + TEST_WRAP + 300U) == 1);
+
+   /* In the past it fires at once */
+   core_clock_alarm(at);
+   CHECK(tim2_irq() == 1);
+   CHECK(tim2_irq() == 0);
+
+   /* Cancelled, it does not fire at its time */
+   core_clock_alarm(at + 2U * TEST_WRAP);
+   core_clock_alarm_cancel();
+   CHECK(move(at + 2U * TEST_WRAP + 1U) == 0);
+   check_read(CM7_CPUID);
+
+   HAL_NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+int main(void)
+{
+   test_watchdog(60);
+   host_init();
+   core_clock_init();
+   test_wraps();
+   test_pending();
+   const uint32_t walked = test_walk();
+   test_alarm();
+   printf("clock: %u wraps read on both cores, %u wraps walked, at %llu us\n",
+          TEST_WRAPS, walked, (unsigned long long)host_clock_get());
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,263 @@
+/*
+ * test_dma2d.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_dma2d.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the DMA2D queue of app_dma2d.c with its software engine. Random
+ * fills, copies and blends of overlapping rectangles are queued, and the
+ * transfer complete interrupt comes at random times in between, so the queue
+ * is sometimes empty, sometimes full. The same operations are done at once
+ * on a reference canvas. After every flush both canvases have to be equal,
+ * which fails if an operation runs out of order, twice or not at all. Staged
+ * sources are scribbled over once their operation is done, and a new staging
+ * slot must not overlap the source of an operation still waiting.
+ */
+
+#define TEST_OPS (100000U)
+#define TEST_WIDTH (96U)
+#define TEST_HEIGHT (64U)
+#define TEST_MAX_W (40U) /* even, A4 lines are whole bytes */
+#define TEST_MAX_H (30U)
+#define TEST_SOURCE (0x100000U) /* bytes */
+
+static uint32_t canvas[TEST_WIDTH * TEST_HEIGHT];
+static uint32_t reference[TEST_WIDTH * TEST_HEIGHT];
+
+/* Sources kept by the caller until the flush */
+static uint32_t source[TEST_SOURCE / 4U];
+static uint32_t source_used;
+
+/* Staged sources of the queued operations, to scribble over once done */
+static struct {
+   uint8_t *at;
+   uint32_t size;
+   uint32_t op; /* count of operations queued before */
+} staged[APP_DMA2D_QUEUE + 1U];
+static uint32_t staged_count;
+static uint32_t queued;
+
+/**
+ * @brief Channel of the source over the destination
+ */
+static uint32_t mix(const uint32_t fg, const uint32_t bg, const uint32_t alpha,
+                    const uint32_t shift)
+{
+   const uint32_t f = (fg >> shift) & 0xFFU;
+   const uint32_t b = (bg >> shift) & 0xFFU;
+
+   return ((f * alpha + b * (255U - alpha)) / 255U) << shift;
+}
+
+/**
+ * @brief Pixel blended as by DMA2D, alpha of the result is the union
+ */
+static uint32_t blend(const uint32_t fg, const uint32_t alpha,
+                      const uint32_t bg)
+{
+   const uint32_t a = alpha + (bg >> 24) - alpha * (bg >> 24) / 255U;
+
+   return a << 24 | mix(fg, bg, alpha, 16) | mix(fg, bg, alpha, 8) |
+          mix(fg, bg, alpha, 0);
+}
+
+/**
+ * @brief Alpha of the pixel of the mask
+ */
+static uint32_t mask_alpha(const uint8_t *const src, const uint32_t format,
+                           const uint32_t stride, const uint32_t x,
+                           const uint32_t y, const uint32_t color)
+{
+   if (format == APP_DMA2D_A8)
+      return src[y * stride + x] * (color >> 24) / 255U;
+   const uint8_t byte = src[(y * stride + x) / 2U];
+   return ((x & 1U) ? byte >> 4 : byte & 0xFU) * 17U * (color >> 24) / 255U;
+}
+
+/**
+ * @brief Scribble over the staged sources of the done operations
+ */
+static void release_staged(void)
+{
+   const uint32_t ops = queued - app_dma2d_pending();
+   uint32_t done = 0;
+
+   while (done < staged_count && staged[done].op < ops)
+      done++;
+   for (uint32_t i = 0; i < done; i++)
+      memset(staged[i].at, 0xA5, staged[i].size);
+   memmove(staged, staged + done, (staged_count - done) * sizeof(staged[0]));
+   staged_count -= done;
+}
+
+/**
+ * @brief Transfer complete interrupts come at random times
+ */
+static void interrupts(uint32_t *const seed)
+{
+   const uint32_t r = test_random(seed);
+
+   /* Less than one an operation, so the queue fills up at times */
+   for (uint32_t n = (r & 3U) == 0 ? 2U + (r >> 2) % 3U : 0; n > 0; n--)
+      app_dma2d_irq();
+   release_staged();
+}
+
+/**
+ * @brief Queue a random operation and do it on the reference
+ */
+static void random_op(uint32_t *const seed)
+{
+   const uint32_t r = test_random(seed);
+   const uint32_t w = 2U * (1U + (r >> 4) % (TEST_MAX_W / 2U));
+   const uint32_t h = 1U + (r >> 10) % TEST_MAX_H;
+   const uint32_t x = (r >> 16) % (TEST_WIDTH - w + 1U);
+   const uint32_t y = (r >> 24) % (TEST_HEIGHT - h + 1U);
+   const uint32_t color = test_random(seed);
+   const uint32_t back = test_random(seed);
+   const uint32_t type = r % 5U;
+   const uint32_t offset = TEST_WIDTH - w;
+   uint32_t *const dst = &canvas[y * TEST_WIDTH + x];
+   uint32_t *const ref = &reference[y * TEST_WIDTH + x];
+
+   if (type == 0) {
+      app_dma2d_fill(dst, offset, w, h, color);
+      queued++;
+      for (uint32_t j = 0; j < h; j++)
+         for (uint32_t i = 0; i < w; i++)
+            ref[j * TEST_WIDTH + i] = color;
+      return;
+   }
+
+   /* ARGB source of the caller or staged, mask in A8 or A4 */
+   const uint32_t format = type == 4U ? APP_DMA2D_A4
+                           : type == 3U ? APP_DMA2D_A8
+                                        : APP_DMA2D_ARGB8888;
+   const uint32_t bytes = format == APP_DMA2D_A4   ? w * h / 2U
+                          : format == APP_DMA2D_A8 ? w * h
+                                                   : 4U * w * h;
+   const uint32_t stage = (color & 1U) != 0;
+   uint8_t *src;
+   if (!stage) {
+      if (source_used + bytes > TEST_SOURCE) {
+         app_dma2d_flush();
+         release_staged();
+         source_used = 0;
+      }
+      src = (uint8_t *)source + source_used;
+      source_used += (bytes + 3U) & ~3U;
+   } else {
+      src = app_dma2d_stage(bytes);
+      CHECK(src != NULL);
+
+      /* It may have waited for operations, their slots can be given again */
+      release_staged();
+      for (uint32_t i = 0; i < staged_count; i++)
+         CHECK(src + bytes <= staged[i].at ||
+               staged[i].at + staged[i].size <= src);
+      CHECK(staged_count <= APP_DMA2D_QUEUE);
+      staged[staged_count].at = src;
+      staged[staged_count].op = queued;
+      staged[staged_count++].size = bytes;
+   }
+   for (uint32_t i = 0; i < bytes; i++)
+      src[i] = (uint8_t)test_random(seed);
+
+   const uint32_t *const argb = (const uint32_t *)src;
+   const uint32_t with_back = (back & 1U) != 0;
+   for (uint32_t j = 0; j < h; j++) {
+      for (uint32_t i = 0; i < w; i++) {
+         uint32_t *const p = &ref[j * TEST_WIDTH + i];
+         const uint32_t bg = with_back ? back : *p;
+
+         if (format == APP_DMA2D_ARGB8888 && type == 1U)
+            *p = argb[j * w + i];
+         else if (format == APP_DMA2D_ARGB8888)
+            *p = blend(argb[j * w + i], argb[j * w + i] >> 24, bg);
+         else
+            *p = blend(color, mask_alpha(src, format, w, i, j, color), bg);
+      }
+   }
+
+   if (type == 1U)
+      app_dma2d_copy(dst, offset, argb, 0, w, h);
+   else if (with_back)
+      app_dma2d_blend_color(dst, offset, src, 0, w, h, format, color, back);
+   else
+      app_dma2d_blend(dst, offset, src, 0, w, h, format, color);
+   queued++;
+}
+
+/**
+ * @brief Wait for the queue, the sources of the caller are free then
+ */
+static void flush(void)
+{
+   app_dma2d_flush();
+   release_staged();
+   source_used = 0;
+   CHECK(app_dma2d_pending() == 0);
+   CHECK(memcmp(canvas, reference, sizeof(canvas)) == 0);
+}
+
+int main(void)
+{
+   uint32_t seed = 0xD3A2D00DU;
+   uint32_t flushes = 0;
+
+   test_watchdog(60);
+   app_dma2d_init();
+   const uint32_t ops_before = app_dma2d_stats()->ops;
+
+   for (uint32_t op = 0; op < TEST_OPS; op++) {
+      random_op(&seed);
+      interrupts(&seed);
+      CHECK(app_dma2d_pending() <= APP_DMA2D_QUEUE);
+      if ((test_random(&seed) % 512U) == 0) {
+         flush();
+         flushes++;
+      }
+   }
+   flush();
+
+   /* Empty operations are not queued */
+   app_dma2d_fill(canvas, 0, 0, 4, 0);
+   app_dma2d_copy(canvas, 0, source, 0, 4, 0);
+   CHECK(app_dma2d_pending() == 0);
+
+   const app_dma2d_stats_t *const stats = app_dma2d_stats();
+   CHECK(stats->ops - ops_before == TEST_OPS && stats->errors == 0);
+   printf("dma2d: %u operations in order, %u flushes, %u waits for the queue\n",
+          TEST_OPS, flushes, stats->waits);
+   return EXIT_SUCCESS;
+}
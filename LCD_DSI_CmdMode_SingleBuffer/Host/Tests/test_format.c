@@ -0,0 +1,163 @@
+/*
+ * test_format.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_format.h"
+#include "app_scene.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the formatter of app_format.c against snprintf() of the C library.
+ * Every value up to 10^5 and random ones up to UINT32_MAX are written with
+ * each width and pad, times of the timer button up to 100 hours and random
+ * ones, and the countdown of the status message. Nothing may be written past
+ * the returned end. The status message is formatted again only when the
+ * minutes change.
+ */
+
+#define TEST_RANDOM (100000U)
+#define TEST_WIDTH (12U)
+#define TEST_CANARY ('#')
+
+/**
+ * @brief Buffer filled with the canary, the text is terminated at its end
+ */
+static char *text_start(char *const buf, const size_t size)
+{
+   memset(buf, TEST_CANARY, size);
+   return buf;
+}
+
+/**
+ * @brief Terminate the text, the rest of the buffer is untouched
+ */
+static void text_end(char *const buf, const size_t size, char *const end)
+{
+   CHECK(end >= buf && end < buf + size);
+   for (char *p = end; p < buf + size; p++)
+      CHECK(*p == TEST_CANARY);
+   *end = '\0';
+}
+
+/**
+ * @brief A value with every width and pad
+ */
+static void check_uint(const uint32_t value)
+{
+   char expected[32];
+   char buf[32];
+
+   for (uint32_t width = 0; width <= TEST_WIDTH; width++) {
+      snprintf(expected, sizeof(expected), "%0*u", (int)width, value);
+      char *end = app_format_uint(text_start(buf, sizeof(buf)), value, width,
+                                  '0');
+      text_end(buf, sizeof(buf), end);
+      CHECK(strcmp(buf, expected) == 0);
+
+      snprintf(expected, sizeof(expected), "%*u", (int)width, value);
+      end = app_format_uint(text_start(buf, sizeof(buf)), value, width, ' ');
+      text_end(buf, sizeof(buf), end);
+      CHECK(strcmp(buf, expected) == 0);
+   }
+}
+
+/**
+ * @brief Time of the timer button
+ */
+static void check_hms(const uint32_t seconds)
+{
+   char expected[32];
+   char buf[32];
+
+   snprintf(expected, sizeof(expected), "%02u:%02u:%02u", seconds / 3600U,
+            seconds / 60U % 60U, seconds % 60U);
+   char *const end = app_format_hms(text_start(buf, sizeof(buf)), seconds);
+   CHECK(end - buf <= (ptrdiff_t)APP_FORMAT_HMS_MAX);
+   text_end(buf, sizeof(buf), end);
+   CHECK(strcmp(buf, expected) == 0);
+}
+
+/**
+ * @brief The countdown of the status message is written on change only
+ */
+static void test_status(void)
+{
+   static App_t app;
+   char expected[sizeof(app.status_message)];
+
+   app.status_minutes = UINT32_MAX;
+   for (uint32_t minutes = 0; minutes < 10000U; minutes++) {
+      const uint32_t version = app.status_version;
+
+      APP_FormatStatus(&app, minutes);
+      CHECK(app.status_version == version + 1U);
+      snprintf(expected, sizeof(expected), "  Start in %u min%26s", minutes,
+               "");
+      CHECK(strcmp(app.status_message, expected) == 0);
+
+      strcpy(app.status_message, "");
+      APP_FormatStatus(&app, minutes);
+      CHECK(app.status_version == version + 1U);
+      CHECK(app.status_message[0] == '\0');
+      strcpy(app.status_message, expected);
+   }
+}
+
+int main(void)
+{
+   char buf[64];
+   uint32_t seed = 0x5EED1234U;
+
+   for (uint32_t value = 0; value <= 100000U; value++)
+      check_uint(value);
+   for (uint32_t p = 1; p <= 1000000000U; p *= 10U) {
+      check_uint(p - 1U);
+      check_uint(p + 1U);
+   }
+   check_uint(UINT32_MAX);
+   for (uint32_t i = 0; i < TEST_RANDOM; i++)
+      check_uint(test_random(&seed));
+
+   for (uint32_t seconds = 0; seconds <= 100U * 3600U; seconds++)
+      check_hms(seconds);
+   check_hms(UINT32_MAX);
+   for (uint32_t i = 0; i < TEST_RANDOM; i++)
+      check_hms(test_random(&seed));
+
+   char *const end = app_format_str(text_start(buf, sizeof(buf)), "toast");
+   text_end(buf, sizeof(buf), end);
+   CHECK(strcmp(buf, "toast") == 0);
+   CHECK(app_format_str(buf, "") == buf);
+
+   test_status();
+   printf("format: matches snprintf, widths 0 .. %u\n", TEST_WIDTH);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/*
+ * test_glyph.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "host.h"
+#include "main.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the glyph cache of app_glyph.c against the LCD utility. Every
+ * character of every 1 bpp font is drawn by LCD_DisplayChar row by row by
+ * UTIL_LCD_DisplayChar, then from its A8 mask by the DMA2D queue, at varying
+ * positions and in random opaque colors, as the scenes use. A translucent
+ * text color is blended by DMA2D but written as it is by the utility. Both
+ * ways have to give the same pixels and leave the pixels around the cell
+ * alone. A pool too small for the font and more fonts than the cache holds
+ * fall back to the utility.
+ */
+
+#define TEST_BORDER (0x12345678U) /* around the cell, drawn by neither */
+#define TEST_MAX_W (24U)          /* widest cell drawn by the utility */
+#define TEST_MAX_H (32U)
+#define TEST_CELL ((TEST_MAX_W + 2U) * (TEST_MAX_H + 2U))
+
+static sFONT *const fonts[] = {&Font8,       &Font12,
+                               &Font16,      &Font20,
+                               &Font24,      &FontAvenirNext20,
+                               &FontMenlo32, &FontComicSansMS20};
+#define TEST_FONTS (sizeof(fonts) / sizeof(fonts[0]))
+
+static uint32_t seed = 0x61C8U;
+
+/**
+ * @brief Draw the character of the current font, read it back with a border
+ *        of one pixel
+ * @param cell (Width + 2) * (Height + 2) pixels
+ */
+static void draw(const uint8_t glyphs, const uint32_t x, const uint32_t y,
+                 const uint8_t ascii, uint32_t *const cell)
+{
+   const sFONT *const font = UTIL_LCD_GetFont();
+   const uint32_t width = font->Width + 2U;
+   const uint32_t height = font->Height + 2U;
+
+   for (uint32_t row = 0; row < height; row++) {
+      uint32_t *const line = LCD_DrawAddress(x - 1U, y - 1U + row);
+
+      for (uint32_t col = 0; col < width; col++)
+         line[col] = TEST_BORDER;
+   }
+
+   LCD_SetGlyphs(glyphs);
+   LCD_DisplayChar(x, y, ascii);
+   app_dma2d_flush();
+
+   for (uint32_t row = 0; row < height; row++)
+      memcpy(&cell[row * width], LCD_DrawAddress(x - 1U, y - 1U + row),
+             width * sizeof(cell[0]));
+}
+
+/**
+ * @brief Draw every character both ways and compare
+ * @return uint32_t characters drawn from the cache
+ */
+static uint32_t compare_font(sFONT *const font)
+{
+   static uint32_t rows[TEST_CELL];
+   static uint32_t cached[TEST_CELL];
+   const uint32_t pixels = (font->Width + 2U) * (font->Height + 2U);
+   uint32_t hits = 0;
+
+   CHECK(font->Width <= TEST_MAX_W && font->Height <= TEST_MAX_H);
+   UTIL_LCD_SetFont(font);
+
+   for (uint32_t i = 0; i < APP_GLYPH_COUNT; i++) {
+      const uint8_t ascii = (uint8_t)(APP_GLYPH_FIRST + i);
+      /* Odd and even columns, the same for both ways */
+      const uint32_t x = 1U + test_random(&seed) % (HACT - TEST_MAX_W - 2U);
+      const uint32_t y = 1U + test_random(&seed) % (VACT - TEST_MAX_H - 2U);
+      const app_glyph_stats_t before = *app_glyph_stats();
+
+      UTIL_LCD_SetTextColor(0xFF000000U | test_random(&seed));
+      UTIL_LCD_SetBackColor(0xFF000000U | test_random(&seed));
+      draw(0, x, y, ascii, rows);
+      draw(1, x, y, ascii, cached);
+      CHECK(memcmp(rows, cached, pixels * sizeof(rows[0])) == 0);
+
+      /* The border is left as it was */
+      const uint32_t width = font->Width + 2U;
+      for (uint32_t p = 0; p < pixels; p++)
+         if (p < width || p >= pixels - width || p % width == 0 ||
+             p % width == width - 1U)
+            CHECK(cached[p] == TEST_BORDER);
+      hits += app_glyph_stats()->hits + app_glyph_stats()->misses -
+              before.hits - before.misses;
+   }
+   return hits;
+}
+
+int main(void)
+{
+   uint8_t *const pool = (uint8_t *)LCD_GLYPH_POOL;
+
+   test_watchdog(60);
+   host_start(0);
+
+   /* Every font in an empty cache, each mask is expanded once */
+   for (uint32_t i = 0; i < TEST_FONTS; i++) {
+      const sFONT *const font = fonts[i];
+
+      app_glyph_init(pool, LCD_GLYPH_POOL_SIZE);
+      CHECK(compare_font(fonts[i]) == APP_GLYPH_COUNT);
+      CHECK(app_glyph_stats()->used ==
+            APP_GLYPH_COUNT * font->Width * font->Height);
+      CHECK(compare_font(fonts[i]) == APP_GLYPH_COUNT);
+      CHECK(app_glyph_get(font, APP_GLYPH_FIRST - 1U) == NULL);
+      CHECK(app_glyph_get(font, APP_GLYPH_FIRST + APP_GLYPH_COUNT) == NULL);
+   }
+
+   /* Pool for a few masks, the rest is drawn by the utility */
+   app_glyph_init(pool, 10U * Font24.Width * Font24.Height + 1U);
+   const uint32_t full = app_glyph_stats()->full;
+   CHECK(compare_font(&Font24) == 10U);
+   CHECK(app_glyph_stats()->full - full == APP_GLYPH_COUNT - 10U);
+
+   /* Fonts over the slots of the cache */
+   app_glyph_init(pool, LCD_GLYPH_POOL_SIZE);
+   for (uint32_t i = 0; i < TEST_FONTS; i++)
+      CHECK(compare_font(fonts[i]) ==
+            (i < APP_GLYPH_FONTS ? APP_GLYPH_COUNT : 0U));
+
+   printf("glyph: %u fonts, %u characters alike from the cache and by rows\n",
+          (unsigned)TEST_FONTS, (unsigned)(TEST_FONTS * APP_GLYPH_COUNT));
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/*
+ * test_lock.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_lock.h"
+#include "host.h"
+#include "stm32h7xx_hal.h"
+#include "test.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/*
+ * Test of core_lock.c on the HSEM of the host HAL, where a semaphore is an
+ * atomic owner word. On one thread the core is switched by host_core() to
+ * check the exclusion and the statistics step by step. Then M7 and M4 are
+ * threads updating the same unprotected record under the lock, partly by
+ * core_lock_try(), and yielding while they hold it, so the other one really
+ * waits. A core which starves stops the test by its watchdog.
+ */
+
+#define TEST_LOCK (1U)
+#define TEST_TAKES (100000U)
+#define TEST_SECONDS (60U)
+
+/* Updated under the lock only, its fields always agree */
+static struct {
+   uint32_t count;
+   uint32_t twice;
+   uint32_t by[2];
+} shared;
+
+static atomic_uint inside;
+
+/**
+ * @brief One core takes the lock TEST_TAKES times
+ */
+static void *core_run(void *const arg)
+{
+   const unsigned int core = *(const unsigned int *)arg;
+   uint32_t seed = 0x9E3779B9U + core;
+   uint32_t taken = 0;
+
+   host_core(core == CORE_LOCK_M7 ? CM7_CPUID : CM4_CPUID);
+   while (taken < TEST_TAKES) {
+      if (test_random(&seed) & 1U)
+         core_lock_take(TEST_LOCK);
+      else if (core_lock_try(TEST_LOCK) != 0) {
+         sched_yield();
+         continue;
+      }
+
+      CHECK(atomic_fetch_add(&inside, 1U) == 0);
+      CHECK(__get_PRIMASK() == 1U);
+      CHECK(shared.twice == 2U * shared.count);
+      shared.count++;
+      if ((test_random(&seed) & 15U) == 0)
+         sched_yield();
+      shared.twice += 2U;
+      shared.by[core]++;
+      atomic_fetch_sub(&inside, 1U);
+
+      core_lock_release(TEST_LOCK);
+      CHECK(__get_PRIMASK() == 0U);
+      taken++;
+   }
+   return NULL;
+}
+
+/**
+ * @brief Exclusion and statistics, the cores take turns on one thread
+ */
+static void test_steps(void)
+{
+   core_lock_stats_t stats;
+
+   core_lock_clear_stats();
+   host_core(CM7_CPUID);
+   CHECK(core_lock_try(TEST_LOCK) == 0);
+   CHECK(__get_PRIMASK() == 1U);
+
+   /* M4 cannot get it, a failed try counts as contention. The interrupt mask
+      belongs to the thread, it is left as it was. */
+   host_core(CM4_CPUID);
+   CHECK(core_lock_try(TEST_LOCK) == -1);
+   CHECK(__get_PRIMASK() == 1U);
+   core_lock_get_stats(TEST_LOCK, CORE_LOCK_M4, &stats);
+   CHECK(stats.acquisitions == 0 && stats.contentions == 1U);
+
+   /* Other locks are independent */
+   CHECK(core_lock_try(TEST_LOCK + 1U) == 0);
+   core_lock_release(TEST_LOCK + 1U);
+
+   host_core(CM7_CPUID);
+   core_lock_release(TEST_LOCK);
+   CHECK(__get_PRIMASK() == 0U);
+
+   host_core(CM4_CPUID);
+   core_lock_take(TEST_LOCK);
+   core_lock_release(TEST_LOCK);
+   core_lock_get_stats(TEST_LOCK, CORE_LOCK_M4, &stats);
+   CHECK(stats.acquisitions == 1U && stats.contentions == 1U);
+
+   host_core(CM7_CPUID);
+   core_lock_get_stats(TEST_LOCK, CORE_LOCK_M7, &stats);
+   CHECK(stats.acquisitions == 1U && stats.contentions == 0);
+}
+
+int main(void)
+{
+   static const unsigned int cores[2] = {CORE_LOCK_M7, CORE_LOCK_M4};
+   core_lock_stats_t stats[2];
+   pthread_t thread;
+
+   test_watchdog(TEST_SECONDS);
+   core_lock_init();
+   test_steps();
+
+   core_lock_clear_stats();
+   CHECK(pthread_create(&thread, NULL, core_run, (void *)&cores[1]) == 0);
+   core_run((void *)&cores[0]);
+   CHECK(pthread_join(thread, NULL) == 0);
+   host_core(CM7_CPUID);
+
+   CHECK(shared.count == 2U * TEST_TAKES);
+   CHECK(shared.by[0] == TEST_TAKES && shared.by[1] == TEST_TAKES);
+   for (unsigned int core = 0; core < 2U; core++) {
+      core_lock_get_stats(TEST_LOCK, core, &stats[core]);
+      CHECK(stats[core].acquisitions == TEST_TAKES);
+   }
+   CHECK(stats[0].contentions + stats[1].contentions > 0);
+
+   printf("lock: %u takes each, contended M7 %u M4 %u, max hold %u cycles\n",
+          TEST_TAKES, stats[0].contentions, stats[1].contentions,
+          stats[0].max_hold_cycles > stats[1].max_hold_cycles
+              ? stats[0].max_hold_cycles
+              : stats[1].max_hold_cycles);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/*
+ * test_lockout.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_event.h"
+#include "app_record.h"
+#include "app_scene.h"
+#include "host.h"
+#include "test.h"
+
+/*
+ * Test of the input lockout after a scene transition in app_scene.c. The tick
+ * is faked by setting the time of the step in App_t, as the main loop takes
+ * it from the core clock, so the steps can be put anywhere, also across the
+ * wrap of the 32-bit tick. A tap is ignored until INPUT_LOCKOUT has passed
+ * since the transition, while the timer keeps being updated, and a touch held
+ * over the end of the lockout is not taken as a new tap.
+ */
+
+#define TEST_LOCKOUT (800U) /* ms, INPUT_LOCKOUT */
+#define TEST_POLL (20U)     /* ms, TOUCH_POLL */
+
+/* Centres of the buttons and of + in the timer configuration */
+#define TEST_LEFT_X (240U)
+#define TEST_LEFT_Y (200U)
+#define TEST_RIGHT_Y (600U)
+#define TEST_PLUS_X (350U)
+
+static App_t app;
+
+/**
+ * @brief Step of the scene logic at the tick
+ * @param now ms
+ * @param touched
+ * @param x
+ * @param y
+ * @param events APP_EVENT_* of the step besides the touch
+ */
+static void step(const uint32_t now, const uint32_t touched, const uint32_t x,
+                 const uint32_t y, const uint32_t events)
+{
+   TS_State_t ts = {.TouchDetected = touched, .TouchX = x, .TouchY = y};
+
+   app.now_us += (uint64_t)(uint32_t)(now - app.now) * 1000U;
+   app.now = now;
+   APP_Step(&app, APP_RECORD_SAMPLED | events, &ts);
+}
+
+/**
+ * @brief Press and release the point, the release is read TEST_POLL later
+ */
+static void tap(const uint32_t now, const uint32_t x, const uint32_t y)
+{
+   step(now, 1, x, y, 0);
+   step(now + TEST_POLL, 0, 0, 0, 0);
+}
+
+/**
+ * @brief Start in the front scene at the tick
+ */
+static void reset(const uint32_t now)
+{
+   app_schedule_init();
+   APP_Init(&app);
+   app.now = now;
+   app_timer_init(now);
+}
+
+/**
+ * @brief Taps are ignored until the lockout ends, the timer keeps running
+ */
+static void test_lockout(const uint32_t t0)
+{
+   reset(t0);
+   tap(t0, TEST_LEFT_X, TEST_LEFT_Y);
+   CHECK(app.scene == TURNON_SCENE);
+   CHECK(app._delay == 1U && app.delay_start == t0);
+
+   step(t0 + 500U, 0, 0, 0, APP_EVENT_TIMER);
+   CHECK(app.timer_left == app.timer - 500U);
+
+   tap(t0 + TEST_LOCKOUT - 1U, TEST_LEFT_X, TEST_LEFT_Y);
+   CHECK(app.scene == TURNON_SCENE);
+   tap(t0 + TEST_LOCKOUT, TEST_LEFT_X, TEST_LEFT_Y);
+   CHECK(app.scene == FRONT_SCREEN);
+   CHECK(app.delay_start == t0 + TEST_LOCKOUT);
+}
+
+/**
+ * @brief A touch held over the end of the lockout is not a new tap
+ */
+static void test_held(const uint32_t t0)
+{
+   uint32_t now = t0;
+
+   reset(t0);
+   step(now, 1, TEST_LEFT_X, TEST_LEFT_Y, 0);
+   CHECK(app.scene == TURNON_SCENE);
+   for (now += TEST_POLL; now - t0 < 3U * TEST_LOCKOUT; now += TEST_POLL)
+      step(now, 1, TEST_LEFT_X, TEST_LEFT_Y, 0);
+   CHECK(app.scene == TURNON_SCENE && app._delay == 0);
+
+   step(now, 0, 0, 0, 0);
+   tap(now + TEST_POLL, TEST_LEFT_X, TEST_LEFT_Y);
+   CHECK(app.scene == FRONT_SCREEN);
+}
+
+/**
+ * @brief The lockout covers the buttons of the timer configuration as well
+ */
+static void test_config(const uint32_t t0)
+{
+   reset(t0);
+   tap(t0, TEST_LEFT_X, TEST_RIGHT_Y);
+   CHECK(app.scene == TIMER_CONFIG_SCENE);
+   const uint32_t config = app.config_timer;
+
+   tap(t0 + 100U, TEST_PLUS_X, TEST_LEFT_Y);
+   CHECK(app.config_timer == config);
+   tap(t0 + TEST_LOCKOUT, TEST_PLUS_X, TEST_LEFT_Y);
+   CHECK(app.config_timer == config + SECOND);
+   CHECK(app.scene == TIMER_CONFIG_SCENE);
+}
+
+int main(void)
+{
+   /* From the start, then with the lockout over the wrap of the tick */
+   static const uint32_t start[] = {0, 1000U, UINT32_MAX - TEST_LOCKOUT / 2U,
+                                    UINT32_MAX - TEST_POLL};
+
+   test_watchdog(30);
+   host_start(0);
+   for (uint32_t i = 0; i < sizeof(start) / sizeof(start[0]); i++) {
+      test_lockout(start[i]);
+      test_held(start[i]);
+      test_config(start[i]);
+   }
+   printf("lockout: %u ms at %u ticks, also over the wrap\n", TEST_LOCKOUT,
+          (unsigned int)(sizeof(start) / sizeof(start[0])));
+   return EXIT_SUCCESS;
+}
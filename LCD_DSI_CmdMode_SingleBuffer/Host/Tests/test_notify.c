@@ -0,0 +1,145 @@
+/*
+ * test_notify.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_notify.h"
+#include "cores_communication.h"
+#include "host.h"
+#include "test.h"
+#include <pthread.h>
+#include <sched.h>
+
+/*
+ * Test of the notify/wait contract of core_notify.c on the host emulation,
+ * where STOP mode of M4 waits on a condition variable until the HSEM event.
+ * A message posted before M4 goes to sleep must not be slept through and
+ * every notification has to wake M4 up, a lost wakeup stops the test by its
+ * watchdog.
+ */
+
+#define TEST_MESSAGES (20000U)
+#define TEST_SECONDS (30U)
+
+/**
+ * @brief Make the calling thread M4 with its notification activated
+ */
+static void m4_core(void)
+{
+   host_core(CM4_CPUID);
+   __HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+}
+
+/**
+ * @brief M4 does not sleep while a message or the flag of its peripheral
+ * waits, even without any notification
+ */
+static void test_pending(void)
+{
+   volatile uint32_t flag = 0;
+   int msg = 1;
+
+   core_share_init();
+   m4_core();
+   CHECK(put_to_m4(&msg, 1) == 1);
+   core_wait_m7();
+   CHECK(get_from_m7(&msg, 1) == 1 && msg == 1);
+
+   flag = 4U;
+   core_wait_m7_or(&flag, 4U);
+
+   /* The next test activates it again on its own M4 thread */
+   HAL_HSEM_DeactivateNotification(__HAL_HSEM_SEMID_TO_MASK(CORE_HSEM_TO_M4));
+   host_core(CM7_CPUID);
+}
+
+/**
+ * @brief M4 sleeps until every message arrives, they are checked in order
+ */
+static void *m4_run(void *const arg)
+{
+   uint32_t received = 0;
+   int msg;
+
+   (void)arg;
+   m4_core();
+   while (received < TEST_MESSAGES) {
+      core_wait_m7();
+      while (get_from_m7(&msg, 1) == 1) {
+         CHECK(msg == (int)received);
+         received++;
+      }
+   }
+   return NULL;
+}
+
+/**
+ * @brief M7 posts the messages with random gaps, so M4 is woken up when it
+ * sleeps already, when it goes to sleep and when it reads the ring
+ */
+static void test_wakeups(void)
+{
+   uint32_t seed = 0x2545F491U;
+   pthread_t thread;
+
+   core_share_init();
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+   for (uint32_t m = 0; m < TEST_MESSAGES;) {
+      const int msg = (int)m;
+
+      if (put_to_m4(&msg, 1) == 1)
+         m++;
+      core_notify_m4();
+      switch (test_random(&seed) % 4U) {
+      case 0:
+         break;
+      case 1:
+         sched_yield();
+         break;
+      default: {
+         const struct timespec gap = {0, (long)(test_random(&seed) % 20000U)};
+         nanosleep(&gap, NULL);
+         break;
+      }
+      }
+   }
+   CHECK(pthread_join(thread, NULL) == 0);
+   CHECK(pending_from_m7() == 0);
+}
+
+int main(void)
+{
+   test_watchdog(TEST_SECONDS);
+   core_notify_init();
+   test_pending();
+   test_wakeups();
+   printf("notify: %u messages woke M4, no wakeup lost\n", TEST_MESSAGES);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+/*
+ * test_present.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_present.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the presentation state machine of app_present.c on a model of the
+ * frame buffers and of the panel. Frames of random rectangles are drawn and
+ * queued, refreshes end at random times, also in the middle of drawing.
+ * Nothing may be drawn into a buffer while it is refreshed, the back buffer
+ * has to hold the last presented frame once its stale areas are copied, and
+ * the panel has to show the whole frame after its refresh, though only the
+ * dirty regions were sent. It runs with one and with two buffers.
+ */
+
+#define TEST_STEPS (100000U)
+#define TEST_WIDTH (100U)
+#define TEST_HEIGHT (60U)
+#define TEST_PIXELS (TEST_WIDTH * TEST_HEIGHT)
+
+typedef uint32_t image_t[TEST_PIXELS];
+
+static image_t buffer[2];
+static image_t panel;
+static image_t frame;     /* everything drawn so far */
+static image_t presented; /* frame in the front buffer */
+static image_t queued;    /* frame waiting for the refresh */
+static image_t sent;      /* front buffer when its refresh started */
+
+/**
+ * @brief Copy the regions between images
+ */
+static void copy_rects(uint32_t *const to, const uint32_t *const from,
+                       const app_rect_set_t *const set)
+{
+   for (uint32_t i = 0; i < set->count; i++) {
+      const app_rect_t *const r = &set->rect[i];
+
+      for (uint32_t y = r->y0; y < r->y1; y++)
+         memcpy(&to[y * TEST_WIDTH + r->x0], &from[y * TEST_WIDTH + r->x0],
+                (r->x1 - r->x0) * sizeof(to[0]));
+   }
+}
+
+/**
+ * @brief The refresh of the front buffer starts
+ */
+static void refresh_start(const app_present_t *const present)
+{
+   CHECK(present->busy && present->refresh.count > 0);
+   memcpy(presented, queued, sizeof(presented));
+   memcpy(sent, buffer[present->front], sizeof(sent));
+}
+
+/**
+ * @brief The refresh ends, the regions are on the panel
+ */
+static uint32_t refresh_end(app_present_t *const present)
+{
+   /* The front buffer was not drawn into meanwhile */
+   CHECK(memcmp(sent, buffer[present->front], sizeof(sent)) == 0);
+   copy_rects(panel, buffer[present->front], &present->refresh);
+   CHECK(memcmp(panel, presented, sizeof(panel)) == 0);
+   return app_present_done(present);
+}
+
+/**
+ * @brief Draw a frame of random rectangles and queue it
+ * @return 1 if drawn, 0 if drawing had to wait
+ */
+static uint32_t draw(app_present_t *const present, uint32_t *const seed,
+                     const uint32_t color)
+{
+   app_rect_set_t copy;
+
+   if (app_present_begin(present, &copy) != 0) {
+      CHECK(present->queued || (present->buffers == 1U && present->busy));
+      return 0;
+   }
+   uint32_t *const back = buffer[present->back];
+   CHECK(!present->busy || present->back != present->front);
+   copy_rects(back, buffer[present->front], &copy);
+   CHECK(memcmp(back, frame, sizeof(frame)) == 0);
+
+   const uint32_t rects = test_random(seed) % 4U;
+   for (uint32_t i = 0; i < rects; i++) {
+      const uint32_t r = test_random(seed);
+      const uint32_t x = r % TEST_WIDTH, y = (r >> 8) % TEST_HEIGHT;
+      const uint32_t w = 1U + (r >> 16) % (TEST_WIDTH - x);
+      const uint32_t h = 1U + (r >> 24) % (TEST_HEIGHT - y);
+
+      for (uint32_t j = y; j < y + h; j++)
+         for (uint32_t k = x; k < x + w; k++)
+            back[j * TEST_WIDTH + k] = frame[j * TEST_WIDTH + k] = color;
+      app_rect_add(&present->dirty, x, y, w, h);
+
+      /* The refresh may end while drawing, nothing is swapped then */
+      if (present->busy && (r & 3U) == 0)
+         CHECK(refresh_end(present) == 0);
+   }
+
+   memcpy(queued, frame, sizeof(queued));
+   if (app_present_queue(present))
+      refresh_start(present);
+   return 1;
+}
+
+/**
+ * @brief Random frames and ends of refresh
+ * @return drawn frames
+ */
+static uint32_t test_buffers(const uint32_t buffers)
+{
+   app_present_t present;
+   uint32_t seed = 0xFACE0FFU + buffers;
+   uint32_t frames = 0;
+
+   memset(buffer, 0, sizeof(buffer));
+   memset(panel, 0, sizeof(panel));
+   memset(frame, 0, sizeof(frame));
+   app_present_init(&present, buffers);
+   CHECK(present.buffers == buffers);
+
+   for (uint32_t step = 1; step <= TEST_STEPS; step++) {
+      if (present.busy && (test_random(&seed) % 3U) == 0) {
+         if (refresh_end(&present))
+            refresh_start(&present);
+         continue;
+      }
+      frames += draw(&present, &seed, step);
+   }
+   while (present.busy)
+      if (refresh_end(&present))
+         refresh_start(&present);
+   CHECK(!present.queued);
+   CHECK(memcmp(panel, frame, sizeof(panel)) == 0);
+   return frames;
+}
+
+int main(void)
+{
+   test_watchdog(60);
+   const uint32_t single = test_buffers(1);
+   const uint32_t doubled = test_buffers(2);
+   printf("present: %u steps, %u frames drawn by one buffer, %u by two\n",
+          TEST_STEPS, single, doubled);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,227 @@
+/*
+ * test_protocol.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_protocol.h"
+#include "cores_communication.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the message codec of core_protocol.c. Every type is encoded and
+ * decoded back, buffers too small for a message are refused. Then the decoder
+ * is fed by random words and by valid messages with random bits flipped. Each
+ * input is in a heap block of its exact size, so ASan reports any read beyond
+ * it. An accepted input has to encode back into the same words, and the
+ * decoder must not write past the payload of its type.
+ */
+
+#define TEST_FUZZ (200000U)
+#define TEST_FILL (0xA5U)
+
+/* Payload items of every type, as the encoder writes them */
+#define TEST_LENGTH(id, member, type) [id] = sizeof(type) / sizeof(int),
+static const unsigned int length[CORE_MSG_COUNT] = {
+    CORE_MSG_TABLE(TEST_LENGTH)};
+#undef TEST_LENGTH
+
+static uint32_t seed = 0x1234567U;
+
+/**
+ * @brief Random message of the type
+ */
+static void message_random(core_msg_t *const msg, const uint8_t type)
+{
+   int payload[BUFFSHAREDSIZE];
+
+   memset(msg, 0, sizeof(*msg));
+   msg->header.type = type;
+   msg->header.seq = test_random(&seed);
+   for (unsigned int i = 0; i < length[type]; i++)
+      payload[i] = (int)test_random(&seed);
+   memcpy(&msg->payload, payload, length[type] * sizeof(int));
+}
+
+/**
+ * @brief Every type is decoded as it was encoded
+ */
+static void test_round_trip(void)
+{
+   int buffer[BUFFSHAREDSIZE];
+
+   for (uint8_t type = 0; type < CORE_MSG_COUNT; type++) {
+      const unsigned int size = length[type] + CORE_MSG_HEADER_SIZE;
+      core_msg_t msg, out;
+
+      message_random(&msg, type);
+      CHECK(core_msg_encode(&msg, buffer, BUFFSHAREDSIZE) == (int)size);
+      CHECK(core_msg_decode(buffer, size, &out) == 0);
+      CHECK(out.header.version == CORE_MSG_VERSION);
+      CHECK(out.header.type == type && out.header.seq == msg.header.seq);
+      CHECK(out.header.length == length[type]);
+      CHECK(memcmp(&out.payload, &msg.payload, length[type] * sizeof(int)) ==
+            0);
+
+      /* Longer input is fine, the message is at its start */
+      CHECK(core_msg_decode(buffer, BUFFSHAREDSIZE, &out) == 0);
+
+      /* Nothing is written into a small buffer, a short input is refused */
+      for (unsigned int small = 0; small < size; small++) {
+         memset(buffer, TEST_FILL, sizeof(buffer));
+         CHECK(core_msg_encode(&msg, buffer, small) == -1);
+         CHECK(((uint8_t *)buffer)[0] == TEST_FILL);
+      }
+      CHECK(core_msg_encode(&msg, buffer, size) == (int)size);
+      for (unsigned int small = 0; small < size; small++)
+         CHECK(core_msg_decode(buffer, small, &out) == -1);
+   }
+
+   core_msg_t msg;
+   message_random(&msg, 0);
+   msg.header.type = CORE_MSG_COUNT;
+   CHECK(core_msg_encode(&msg, buffer, BUFFSHAREDSIZE) == -1);
+}
+
+/**
+ * @brief Decode the input of its exact size and check the result
+ * @return 1 if the input was accepted
+ */
+static int fuzz_one(const int *const input, const unsigned int size)
+{
+   int *const block = malloc(size > 0 ? size * sizeof(int) : 1U);
+   int encoded[BUFFSHAREDSIZE];
+   core_msg_t msg;
+
+   CHECK(block != NULL);
+   memcpy(block, input, size * sizeof(int));
+   memset(&msg, TEST_FILL, sizeof(msg));
+   const int ret = core_msg_decode(block, size, &msg);
+   free(block);
+   if (ret != 0) {
+      CHECK(ret == -1);
+      return 0;
+   }
+
+   /* Only a valid header is accepted */
+   const uint32_t word = (uint32_t)input[0];
+   CHECK(word >> 24 == CORE_MSG_VERSION);
+   CHECK(msg.header.type == (uint8_t)(word >> 16));
+   CHECK(msg.header.type < CORE_MSG_COUNT);
+   CHECK(msg.header.length == length[msg.header.type]);
+   CHECK(msg.header.length + CORE_MSG_HEADER_SIZE <= size);
+
+   /* The payload of other types is left alone */
+   const uint8_t *const rest =
+       (const uint8_t *)&msg.payload + msg.header.length * sizeof(int);
+   const uint8_t *const end = (const uint8_t *)(&msg + 1);
+   for (const uint8_t *p = rest; p < end; p++)
+      CHECK(*p == TEST_FILL);
+
+   /* Accepted words are encoded back the same */
+   const int items = core_msg_encode(&msg, encoded, BUFFSHAREDSIZE);
+   CHECK(items == (int)(msg.header.length + CORE_MSG_HEADER_SIZE));
+   CHECK(memcmp(encoded, input, (size_t)items * sizeof(int)) == 0);
+   return 1;
+}
+
+/**
+ * @brief Random words and mutated valid messages
+ */
+static void test_fuzz(uint32_t *const accepted)
+{
+   int input[BUFFSHAREDSIZE];
+
+   for (uint32_t n = 0; n < TEST_FUZZ; n++) {
+      unsigned int size;
+
+      if (n & 1U) {
+         /* Random words, half of them with the right version */
+         size = test_random(&seed) % (BUFFSHAREDSIZE + 1U);
+         for (unsigned int i = 0; i < size; i++)
+            input[i] = (int)test_random(&seed);
+         if (size > 0 && (n & 2U))
+            input[0] = (int)(((uint32_t)input[0] & 0x00FFFFFFU) |
+                             (CORE_MSG_VERSION << 24));
+      } else {
+         /* Valid message, a few bits flipped, cut short or padded */
+         core_msg_t msg;
+
+         message_random(&msg, (uint8_t)(test_random(&seed) % CORE_MSG_COUNT));
+         size = (unsigned int)core_msg_encode(&msg, input, BUFFSHAREDSIZE);
+         const uint32_t flips = test_random(&seed) % 3U;
+         for (uint32_t f = 0; f < flips; f++) {
+            const uint32_t bit = test_random(&seed) % (size * 32U);
+            input[bit / 32U] ^= (int)(1U << (bit % 32U));
+         }
+         const uint32_t resize = test_random(&seed) % 4U;
+         if (resize == 0)
+            size = test_random(&seed) % size;
+         else if (resize == 1) {
+            const unsigned int pad = test_random(&seed) % 4U;
+            for (unsigned int i = 0; i < pad; i++)
+               input[size + i] = (int)test_random(&seed);
+            size += pad;
+         }
+      }
+      *accepted += (uint32_t)fuzz_one(input, size);
+   }
+}
+
+/**
+ * @brief An invalid message in the ring is dropped, the next one is read
+ */
+static void test_receive(void)
+{
+   const int junk[3] = {0x7F000000, 0, 0};
+   core_msg_t msg;
+
+   core_share_init();
+   CHECK(put_to_m4(junk, 3) == 3);
+   message_random(&msg, CORE_MSG_HEATER);
+   CHECK(core_msg_send_to_m4(&msg) == 0);
+   const uint32_t seq = msg.header.seq;
+
+   CHECK(core_msg_receive_from_m7(&msg) == -2);
+   CHECK(core_msg_receive_from_m7(&msg) == 0);
+   CHECK(msg.header.type == CORE_MSG_HEATER && msg.header.seq == seq);
+   CHECK(core_msg_receive_from_m7(&msg) == -1);
+}
+
+int main(void)
+{
+   uint32_t accepted = 0;
+
+   test_round_trip();
+   test_fuzz(&accepted);
+   test_receive();
+   printf("protocol: %u types, %u fuzzed inputs, %u accepted\n",
+          CORE_MSG_COUNT, TEST_FUZZ, accepted);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+/*
+ * test_rect.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_rect.h"
+#include "test.h"
+
+/*
+ * Test of the coalescing of dirty rectangles of app_rect.c. Frames of random
+ * rectangles, mostly small ones near each other as text and buttons are
+ * drawn, are added to a set. Every pixel added in the frame has to be in a
+ * region, the regions stay in the screen and in their slots, and no two of
+ * them are left that the union would waste less than APP_RECT_SLACK on. A few
+ * fixed cases check the merges of the progress bar and of far apart widgets.
+ */
+
+#define TEST_FRAMES (5000U)
+#define TEST_ADDS (40U) /* at most in one frame */
+#define TEST_WIDTH (800U)
+#define TEST_HEIGHT (480U)
+
+typedef struct {
+   uint32_t x, y, width, height;
+} test_rect_t;
+
+/**
+ * @brief Check the pixel is in a region
+ */
+static uint32_t covered(const app_rect_set_t *const set, const uint32_t x,
+                        const uint32_t y)
+{
+   for (uint32_t i = 0; i < set->count; i++) {
+      const app_rect_t *const r = &set->rect[i];
+      if (x >= r->x0 && x < r->x1 && y >= r->y0 && y < r->y1)
+         return 1;
+   }
+   return 0;
+}
+
+/**
+ * @brief Pixels of the union of two regions, which are in neither of them
+ */
+static int64_t waste(const app_rect_t *const a, const app_rect_t *const b)
+{
+   const int64_t x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+   const int64_t y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+   const int64_t x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+   const int64_t y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+
+   return (x1 - x0) * (y1 - y0) -
+          (int64_t)(a->x1 - a->x0) * (a->y1 - a->y0) -
+          (int64_t)(b->x1 - b->x0) * (b->y1 - b->y0);
+}
+
+/**
+ * @brief The set covers the rectangles and its regions are coalesced
+ */
+static void check_set(const app_rect_set_t *const set,
+                      const test_rect_t *const added, const uint32_t count)
+{
+   CHECK(set->count <= APP_RECT_MAX);
+   for (uint32_t i = 0; i < set->count; i++) {
+      const app_rect_t *const r = &set->rect[i];
+
+      CHECK(r->x0 < r->x1 && r->x1 <= TEST_WIDTH);
+      CHECK(r->y0 < r->y1 && r->y1 <= TEST_HEIGHT);
+      for (uint32_t j = i + 1U; j < set->count; j++)
+         CHECK(waste(r, &set->rect[j]) > (int64_t)APP_RECT_SLACK);
+   }
+   for (uint32_t i = 0; i < count; i++)
+      for (uint32_t y = added[i].y; y < added[i].y + added[i].height; y++)
+         for (uint32_t x = added[i].x; x < added[i].x + added[i].width; x++)
+            CHECK(covered(set, x, y));
+}
+
+/**
+ * @brief Random rectangle, often near the previous one
+ */
+static test_rect_t random_rect(uint32_t *const seed,
+                               const test_rect_t *const previous)
+{
+   const uint32_t r = test_random(seed);
+   test_rect_t rect;
+
+   rect.width = (r >> 8) % 120U;
+   rect.height = (r >> 16) % 40U;
+   if (previous != NULL && (r & 3U) != 0) {
+      rect.x = previous->x + previous->width + r % 8U;
+      rect.y = previous->y + (r >> 4) % 4U;
+   } else {
+      rect.x = test_random(seed) % TEST_WIDTH;
+      rect.y = test_random(seed) % TEST_HEIGHT;
+   }
+   if (rect.x >= TEST_WIDTH)
+      rect.x = 0;
+   if (rect.y >= TEST_HEIGHT)
+      rect.y = 0;
+   if (rect.x + rect.width > TEST_WIDTH)
+      rect.width = TEST_WIDTH - rect.x;
+   if (rect.y + rect.height > TEST_HEIGHT)
+      rect.height = TEST_HEIGHT - rect.y;
+   return rect;
+}
+
+/**
+ * @brief Frames of random rectangles
+ * @return regions of all frames
+ */
+static uint32_t test_random_frames(void)
+{
+   test_rect_t added[TEST_ADDS];
+   uint32_t seed = 0xDEC0DE5U;
+   uint32_t regions = 0;
+   app_rect_set_t set;
+
+   for (uint32_t frame = 0; frame < TEST_FRAMES; frame++) {
+      const uint32_t adds = 1U + test_random(&seed) % TEST_ADDS;
+
+      app_rect_clear(&set);
+      for (uint32_t i = 0; i < adds; i++) {
+         added[i] = random_rect(&seed, i > 0 ? &added[i - 1U] : NULL);
+
+         const app_rect_set_t before = set;
+         app_rect_add(&set, added[i].x, added[i].y, added[i].width,
+                      added[i].height);
+         if (added[i].width == 0 || added[i].height == 0) {
+            CHECK(set.count == before.count);
+            CHECK(app_rect_area(&set) == app_rect_area(&before));
+         }
+         check_set(&set, &added[i], 1);
+      }
+      /* Regions only grow, the rectangles added before are still covered */
+      check_set(&set, added, adds);
+      regions += set.count;
+   }
+   return regions;
+}
+
+/**
+ * @brief Merges of the widgets of the scenes
+ */
+static void test_cases(void)
+{
+   app_rect_set_t set;
+
+   /* Progress bar, its frame and its fill are one region */
+   app_rect_clear(&set);
+   app_rect_add(&set, 0, 440, 800, 20);
+   app_rect_add(&set, 19, 439, 762, 22);
+   app_rect_add(&set, 20, 440, 380, 20);
+   CHECK(set.count == 1U);
+   CHECK(set.rect[0].x0 == 0 && set.rect[0].y0 == 439);
+   CHECK(set.rect[0].x1 == 800 && set.rect[0].y1 == 461);
+
+   /* Inside of a region, nothing changes */
+   app_rect_add(&set, 100, 445, 10, 10);
+   CHECK(set.count == 1U && app_rect_area(&set) == 800U * 22U);
+
+   /* Lines of a glyph are one region */
+   app_rect_clear(&set);
+   for (uint32_t y = 0; y < 20U; y++)
+      app_rect_add(&set, 300, 100 + y, 17, 1);
+   CHECK(set.count == 1U && app_rect_area(&set) == 17U * 20U);
+
+   /* Far apart corners take the slots, the fifth one is merged */
+   app_rect_clear(&set);
+   app_rect_add(&set, 0, 0, 10, 10);
+   app_rect_add(&set, 790, 0, 10, 10);
+   app_rect_add(&set, 0, 470, 10, 10);
+   app_rect_add(&set, 790, 470, 10, 10);
+   CHECK(set.count == 4U && app_rect_area(&set) == 400U);
+   app_rect_add(&set, 400, 0, 10, 10);
+   CHECK(set.count == APP_RECT_MAX);
+   CHECK(covered(&set, 405, 5) && covered(&set, 5, 5));
+   CHECK(covered(&set, 795, 5) && covered(&set, 795, 475));
+}
+
+int main(void)
+{
+   test_watchdog(60);
+   test_cases();
+   const uint32_t regions = test_random_frames();
+   printf("rect: %u frames, %.2f regions a frame\n", TEST_FRAMES,
+          (double)regions / TEST_FRAMES);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,299 @@
+/*
+ * test_ring.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "cores_communication.h"
+#include "test.h"
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+/*
+ * Test of the M7 <-> M4 rings of core_communication.c. First the limits on
+ * one thread, then each core is a thread, which sends to the other one and
+ * reads from it at the same time, by every API of the ring in random order.
+ * Every message carries its sequence number and size, so a lost, repeated or
+ * torn message is found.
+ */
+
+#define TEST_MESSAGES (200000U)
+#define TEST_BATCH (4U)
+
+/* API of one direction, the producer and the consumer side */
+typedef struct {
+   int (*put)(const int *restrict, unsigned int);
+   int (*put_batch)(const int *restrict, unsigned int, unsigned int);
+   int *(*reserve)(void);
+   void (*commit)(unsigned int);
+   void (*cancel)(void);
+   int (*get)(int *restrict, unsigned int);
+   int (*get_batch)(int *restrict, unsigned int, unsigned int);
+   const int *(*peek)(unsigned int *);
+   void (*release)(void);
+} ring_api_t;
+
+typedef struct {
+   const ring_api_t *out; /* sent by this core */
+   const ring_api_t *in;  /* read by this core */
+   uint32_t seed;
+   uint32_t full; /* sends refused by the full ring */
+} core_t;
+
+static const ring_api_t to_m4 = {put_to_m4,      put_batch_to_m4,
+                                 reserve_to_m4,  commit_to_m4,
+                                 cancel_to_m4,   get_from_m7,
+                                 get_batch_from_m7, peek_from_m7,
+                                 release_from_m7};
+static const ring_api_t to_m7 = {put_to_m7,      put_batch_to_m7,
+                                 reserve_to_m7,  commit_to_m7,
+                                 cancel_to_m7,   get_from_m4,
+                                 get_batch_from_m4, peek_from_m4,
+                                 release_from_m4};
+
+/**
+ * @brief Build message of the sequence number
+ */
+static void message_fill(int *const msg, const uint32_t seq,
+                         const unsigned int size)
+{
+   msg[0] = (int)seq;
+   msg[1] = (int)size;
+   for (unsigned int i = 2; i < size; i++)
+      msg[i] = (int)(seq ^ (i * 0x9E3779B9U));
+}
+
+/**
+ * @brief Check message of the sequence number
+ */
+static void message_check(const int *const msg, const uint32_t seq,
+                          const unsigned int size)
+{
+   CHECK(msg[0] == (int)seq);
+   CHECK(msg[1] == (int)size);
+   for (unsigned int i = 2; i < size; i++)
+      CHECK(msg[i] == (int)(seq ^ (i * 0x9E3779B9U)));
+}
+
+/**
+ * @brief Size of the next message, 2 .. BUFFSHAREDSIZE items
+ */
+static unsigned int message_size(uint32_t *const seed)
+{
+   return 2U + test_random(seed) % (BUFFSHAREDSIZE - 1U);
+}
+
+/**
+ * @brief Try to send a few messages by a random API
+ * @return count of sent messages
+ */
+static uint32_t core_send(core_t *const core, const uint32_t seq,
+                          const uint32_t left)
+{
+   static _Thread_local int buffer[TEST_BATCH * BUFFSHAREDSIZE];
+   const unsigned int size = message_size(&core->seed);
+   uint32_t sent = 0;
+   int *slot;
+
+   switch (test_random(&core->seed) % 4U) {
+   case 0:
+      message_fill(buffer, seq, size);
+      sent = core->out->put(buffer, size) == (int)size ? 1U : 0U;
+      break;
+   case 1: {
+      const uint32_t count = left < TEST_BATCH ? left : TEST_BATCH;
+      for (uint32_t m = 0; m < count; m++)
+         message_fill(&buffer[m * size], seq + m, size);
+      sent = (uint32_t)core->out->put_batch(buffer, size, count);
+      break;
+   }
+   case 2:
+      slot = core->out->reserve();
+      if (slot != NULL) {
+         message_fill(slot, seq, size);
+         core->out->commit(size);
+         sent = 1;
+      }
+      break;
+   default:
+      /* A cancelled slot is never seen by the consumer */
+      slot = core->out->reserve();
+      if (slot != NULL) {
+         message_fill(slot, UINT32_MAX, size);
+         core->out->cancel();
+      }
+      break;
+   }
+   if (sent == 0)
+      core->full++;
+   return sent;
+}
+
+/**
+ * @brief Try to read a few messages by a random API
+ * @return count of read messages
+ */
+static uint32_t core_receive(core_t *const core, const uint32_t seq)
+{
+   static _Thread_local int buffer[TEST_BATCH * BUFFSHAREDSIZE];
+   uint32_t count = 0;
+   unsigned int size;
+   const int *msg;
+   int ret;
+
+   switch (test_random(&core->seed) % 3U) {
+   case 0:
+      ret = core->in->get(buffer, BUFFSHAREDSIZE);
+      if (ret >= 0) {
+         message_check(buffer, seq, (unsigned int)ret);
+         count = 1;
+      }
+      break;
+   case 1:
+      count = (uint32_t)core->in->get_batch(buffer, BUFFSHAREDSIZE,
+                                             TEST_BATCH);
+      for (uint32_t m = 0; m < count; m++) {
+         const int *const next = &buffer[m * BUFFSHAREDSIZE];
+         message_check(next, seq + m, (unsigned int)next[1]);
+      }
+      break;
+   default:
+      msg = core->in->peek(&size);
+      if (msg != NULL) {
+         message_check(msg, seq, size);
+         core->in->release();
+         count = 1;
+      }
+      break;
+   }
+   return count;
+}
+
+/**
+ * @brief One core sends and reads TEST_MESSAGES messages
+ */
+static void *core_run(void *const arg)
+{
+   core_t *const core = arg;
+   uint32_t sent = 0;
+   uint32_t received = 0;
+
+   while (sent < TEST_MESSAGES || received < TEST_MESSAGES) {
+      uint32_t done = 0;
+
+      if (sent < TEST_MESSAGES)
+         done += core_send(core, sent, TEST_MESSAGES - sent);
+      sent += done;
+      if (received < TEST_MESSAGES) {
+         const uint32_t count = core_receive(core, received);
+         received += count;
+         done += count;
+      }
+      /* The host may have less CPUs than the test has cores */
+      if (done == 0)
+         sched_yield();
+   }
+   CHECK(sent == TEST_MESSAGES);
+   return NULL;
+}
+
+/**
+ * @brief Limits of the ring on one thread
+ */
+static void test_limits(void)
+{
+   int buffer[(CORE_RING_DEPTH + 1U) * 4U];
+   int out[BUFFSHAREDSIZE + 4U];
+   unsigned int size;
+
+   core_share_init();
+   CHECK(get_from_m7(out, BUFFSHAREDSIZE) == -1);
+   CHECK(peek_from_m7(&size) == NULL);
+   CHECK(pending_from_m7() == 0);
+
+   /* A full ring refuses, nothing is overwritten */
+   for (uint32_t m = 0; m < CORE_RING_DEPTH; m++) {
+      message_fill(buffer, m, 4);
+      CHECK(put_to_m4(buffer, 4) == 4);
+   }
+   message_fill(buffer, CORE_RING_DEPTH, 4);
+   CHECK(put_to_m4(buffer, 4) == -1);
+   CHECK(reserve_to_m4() == NULL);
+   CHECK(put_batch_to_m4(buffer, 4, 1) == 0);
+   CHECK(pending_from_m7() == CORE_RING_DEPTH);
+
+   /* A batch takes only the free slots */
+   CHECK(get_batch_from_m7(buffer, 4, 3) == 3);
+   for (uint32_t m = 0; m < 3; m++)
+      message_check(&buffer[m * 4U], m, 4);
+   for (uint32_t m = 0; m < 4; m++)
+      message_fill(&buffer[m * 4U], CORE_RING_DEPTH + m, 4);
+   CHECK(put_batch_to_m4(buffer, 4, 4) == 3);
+   for (uint32_t m = 3; m < CORE_RING_DEPTH + 3U; m++) {
+      CHECK(get_from_m7(out, BUFFSHAREDSIZE) == 4);
+      message_check(out, m, 4);
+   }
+   CHECK(get_from_m7(out, BUFFSHAREDSIZE) == -1);
+
+   /* A message is cut to the slot and to the reader's buffer */
+   int big[BUFFSHAREDSIZE + 4U];
+   message_fill(big, 7, BUFFSHAREDSIZE + 4U);
+   CHECK(put_to_m7(big, BUFFSHAREDSIZE + 4U) == BUFFSHAREDSIZE);
+   CHECK(get_from_m4(out, 10) == 10);
+   CHECK(out[0] == 7 && out[9] == big[9]);
+
+   /* A cancelled reservation is given again by the next one */
+   int *const slot = reserve_to_m4();
+   CHECK(slot != NULL);
+   cancel_to_m4();
+   CHECK(pending_from_m7() == 0);
+   CHECK(reserve_to_m4() == slot);
+   commit_to_m4(1);
+   CHECK(peek_from_m7(&size) == slot && size == 1);
+   release_from_m7();
+   CHECK(pending_from_m7() == 0);
+}
+
+int main(void)
+{
+   core_t m7 = {&to_m4, &to_m7, 0x12345678U, 0};
+   core_t m4 = {&to_m7, &to_m4, 0x9ABCDEF0U, 0};
+   pthread_t thread;
+
+   test_limits();
+
+   core_share_init();
+   CHECK(pthread_create(&thread, NULL, core_run, &m4) == 0);
+   core_run(&m7);
+   CHECK(pthread_join(thread, NULL) == 0);
+   CHECK(pending_from_m4() == 0 && pending_from_m7() == 0);
+
+   printf("ring: %u messages each way, %u and %u sends refused by full ring\n",
+          TEST_MESSAGES, m7.full, m4.full);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,356 @@
+/*
+ * test_rpc.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_clock.h"
+#include "core_rpc.h"
+#include "cores_communication.h"
+#include "host.h"
+#include "main.h"
+#include "test.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/*
+ * Test of the RPC of core_rpc.c. On one thread, switched between the cores by
+ * host_core(), a call is answered, times out and its late answer is ignored.
+ * Then M4 is a thread answering the requests of M7, which keeps every slot
+ * busy. Some requests are never answered, they have to time out, every other
+ * call has to get the status sent for it. The simulated clock is moved by M7
+ * only when nothing but the unanswered calls is pending, so an answered call
+ * cannot time out by a slow thread. At last the heater requests of
+ * APP_TurnPeripheries() go to M4 which never answers, they have to be given
+ * up and reported, and sent again once M4 is back.
+ */
+
+#define TEST_CALLS (20000U)
+#define TEST_TIMEOUT (50U) /* ms */
+#define TEST_SECONDS (60U)
+
+/* Duty of a request M4 does not answer */
+#define TEST_DROP (-1)
+
+static atomic_uint m4_stop;
+
+/**
+ * @brief Status M4 sends for the request
+ */
+static int32_t status_of(const uint32_t seq) { return -(int32_t)(seq % 5U); }
+
+/**
+ * @brief Answer the requests waiting for M4 on this thread
+ * @return number of answered requests
+ */
+static uint32_t m4_answer(void)
+{
+   uint32_t answered = 0;
+   core_msg_t msg;
+
+   host_core(CM4_CPUID);
+   while (core_msg_receive_from_m7(&msg) == 0) {
+      if (msg.payload.duty.duty == TEST_DROP)
+         continue;
+      CHECK(core_rpc_reply_m7(&msg, status_of(msg.header.seq)) == 0);
+      answered++;
+   }
+   host_core(CM7_CPUID);
+   return answered;
+}
+
+/**
+ * @brief Send a duty request
+ * @return call handle
+ */
+static int m7_call(const int32_t duty, uint32_t *const seq)
+{
+   core_msg_t msg = {.header.type = CORE_MSG_DUTY, .payload.duty.duty = duty};
+   const int call = core_rpc_call_m4(&msg, TEST_TIMEOUT);
+
+   *seq = msg.header.seq;
+   return call;
+}
+
+/**
+ * @brief Calls step by step on one thread
+ */
+static void test_steps(void)
+{
+   int calls[CORE_RPC_SLOTS];
+   core_msg_t late = {0};
+   int32_t status;
+   uint32_t seq;
+
+   /* Answered call, the slot is freed by the poll */
+   int call = m7_call(0, &seq);
+   CHECK(call >= 0);
+   CHECK(core_rpc_poll(call, &status) == CORE_RPC_PENDING);
+   CHECK(m4_answer() == 1U);
+   core_rpc_process();
+   CHECK(core_rpc_poll(call, &status) == CORE_RPC_DONE);
+   CHECK(status == status_of(seq));
+   CHECK(core_rpc_poll(call, &status) == CORE_RPC_INVALID);
+   CHECK(core_rpc_poll(-1, &status) == CORE_RPC_INVALID);
+   CHECK(core_rpc_poll((int)CORE_RPC_SLOTS, &status) == CORE_RPC_INVALID);
+
+   /* All slots busy */
+   for (unsigned int i = 0; i < CORE_RPC_SLOTS; i++)
+      CHECK((calls[i] = m7_call(0, &seq)) >= 0);
+   CHECK(m7_call(0, &seq) == -1);
+   CHECK(m4_answer() == CORE_RPC_SLOTS);
+   core_rpc_process();
+   for (unsigned int i = 0; i < CORE_RPC_SLOTS; i++)
+      CHECK(core_rpc_poll(calls[i], &status) == CORE_RPC_DONE);
+
+   /* Timeout exactly at its end */
+   call = m7_call(TEST_DROP, &seq);
+   CHECK(call >= 0);
+   CHECK(m4_answer() == 0);
+   host_clock_set(host_clock_get() + (TEST_TIMEOUT - 1U) * 1000U);
+   CHECK(core_rpc_poll(call, &status) == CORE_RPC_PENDING);
+   host_clock_set(host_clock_get() + 1000U);
+   CHECK(core_rpc_poll(call, &status) == CORE_RPC_TIMEOUT);
+
+   /* Its late answer does not complete the next call in the same slot */
+   const int next = m7_call(0, &seq);
+   CHECK(next == call);
+   late.header.seq = seq - 1U;
+   host_core(CM4_CPUID);
+   CHECK(core_rpc_reply_m7(&late, 0) == 0);
+   host_core(CM7_CPUID);
+   core_rpc_process();
+   CHECK(core_rpc_poll(next, &status) == CORE_RPC_PENDING);
+   CHECK(m4_answer() == 1U);
+   core_rpc_process();
+   CHECK(core_rpc_poll(next, &status) == CORE_RPC_DONE);
+   CHECK(status == status_of(seq));
+}
+
+/**
+ * @brief M4 answers until it is stopped
+ */
+static void *m4_run(void *const arg)
+{
+   core_msg_t msg;
+
+   (void)arg;
+   host_core(CM4_CPUID);
+   while (!atomic_load(&m4_stop)) {
+      if (core_msg_receive_from_m7(&msg) != 0) {
+         sched_yield();
+         continue;
+      }
+      if (msg.payload.duty.duty == TEST_DROP)
+         continue;
+      while (core_rpc_reply_m7(&msg, status_of(msg.header.seq)) != 0)
+         sched_yield();
+   }
+   return NULL;
+}
+
+/**
+ * @brief M7 keeps every slot busy until TEST_CALLS calls are done
+ */
+static void test_threads(uint32_t *const dropped)
+{
+   struct {
+      int call;
+      uint32_t seq;
+      uint8_t drop;
+   } flight[CORE_RPC_SLOTS];
+   uint32_t seed = 0xC0FFEEU;
+   uint32_t started = 0, done = 0;
+   unsigned int busy = 0;
+   pthread_t thread;
+
+   CHECK(pthread_create(&thread, NULL, m4_run, NULL) == 0);
+   while (done < TEST_CALLS) {
+      /* Start calls while there are free slots */
+      while (started < TEST_CALLS && busy < CORE_RPC_SLOTS) {
+         const uint8_t drop = (test_random(&seed) % 8U) == 0;
+         uint32_t seq;
+         const int call = m7_call(drop ? TEST_DROP : 1, &seq);
+
+         if (call < 0)
+            break;
+         flight[busy].call = call;
+         flight[busy].seq = seq;
+         flight[busy].drop = drop;
+         busy++;
+         started++;
+      }
+
+      core_rpc_process();
+      unsigned int waiting = 0;
+      for (unsigned int i = 0; i < busy;) {
+         int32_t status;
+         const int ret = core_rpc_poll(flight[i].call, &status);
+
+         if (ret == CORE_RPC_PENDING) {
+            waiting += flight[i].drop ? 0U : 1U;
+            i++;
+            continue;
+         }
+         if (flight[i].drop) {
+            CHECK(ret == CORE_RPC_TIMEOUT);
+            (*dropped)++;
+         } else {
+            CHECK(ret == CORE_RPC_DONE);
+            CHECK(status == status_of(flight[i].seq));
+         }
+         flight[i] = flight[--busy];
+         done++;
+      }
+
+      /* Only the unanswered calls wait, let them time out */
+      if (busy > 0 && waiting == 0)
+         host_clock_set(host_clock_get() + TEST_TIMEOUT * 1000U);
+      else
+         sched_yield();
+   }
+   atomic_store(&m4_stop, 1U);
+   CHECK(pthread_join(thread, NULL) == 0);
+}
+
+/**
+ * @brief Drain the heater requests on M4
+ * @param answer 1 to confirm them, 0 to drop them
+ * @return number of requests
+ */
+static uint32_t m4_heater(const int answer, int *const state)
+{
+   uint32_t requests = 0;
+   core_msg_t msg;
+
+   host_core(CM4_CPUID);
+   while (core_msg_receive_from_m7(&msg) == 0) {
+      CHECK(msg.header.type == CORE_MSG_HEATER);
+      *state = msg.payload.heater.on;
+      if (answer)
+         CHECK(core_rpc_reply_m7(&msg, 0) == 0);
+      requests++;
+   }
+   host_core(CM7_CPUID);
+   return requests;
+}
+
+/**
+ * @brief Run the heater glue as the main loop does, by its deadlines, while
+ *        M4 answers or not
+ * @return number of requests M4 got
+ */
+static uint32_t heater_run(App_t *const app, const int answer, int *state,
+                           const uint32_t ms)
+{
+   const uint64_t end = host_clock_get() + (uint64_t)ms * 1000U;
+   uint32_t requests = 0;
+
+   while (host_clock_get() < end) {
+      const uint32_t wait = APP_TurnPeripheries(app);
+
+      requests += m4_heater(answer, state);
+      /* Nothing waits, the loop would sleep until the next event */
+      if (wait == 0)
+         break;
+      host_clock_set(host_clock_get() + (uint64_t)wait * 1000U);
+   }
+   return requests;
+}
+
+/**
+ * @brief Heater requests M4 does not confirm
+ */
+static void test_heater(void)
+{
+   static App_t app;
+   int state = -1;
+
+   /* The stopped toaster is confirmed */
+   app.scene = FRONT_SCREEN;
+   CHECK(heater_run(&app, 1, &state, 1000U) == 1U);
+   CHECK(heater_run(&app, 1, &state, 1000U) == 0);
+   CHECK(state == 0 && app.heater_confirmed && !app.heater_lost);
+
+   /* M4 never answers, the request is sent the number of tries and given
+    up, nothing is sent for a long time after */
+   app.scene = TURNON_SCENE;
+   CHECK(heater_run(&app, 0, &state, 10000U) == APP_HEATER_TRIES);
+   CHECK(state == 1 && !app.heater_confirmed && app.heater_lost);
+   CHECK(APP_TurnPeripheries(&app) == 0);
+   CHECK(heater_run(&app, 0, &state, 60000U) == 0);
+   CHECK(app.heater_lost);
+
+   /* The other state is tried the same number of times */
+   app.scene = FRONT_SCREEN;
+   CHECK(heater_run(&app, 0, &state, 10000U) == APP_HEATER_TRIES);
+   CHECK(state == 0 && app.heater_lost);
+
+   /* M4 is back, the next state asked by the scene is confirmed */
+   app.scene = TURNON_SCENE;
+   CHECK(heater_run(&app, 1, &state, 1000U) == 1U);
+   CHECK(heater_run(&app, 1, &state, 1000U) == 0);
+   CHECK(state == 1 && app.heater_confirmed && !app.heater_lost);
+
+   /* Missed confirmations of one state do not count for the other */
+   app.scene = FRONT_SCREEN;
+   for (uint32_t i = 0; i + 1U < APP_HEATER_TRIES; i++) {
+      const uint32_t wait = APP_TurnPeripheries(&app);
+
+      CHECK(m4_heater(0, &state) == 1U);
+      host_clock_set(host_clock_get() + (uint64_t)wait * 1000U);
+   }
+   CHECK(!app.heater_lost);
+   app.scene = TURNON_SCENE;
+   CHECK(heater_run(&app, 0, &state, 10000U) == APP_HEATER_TRIES);
+   CHECK(state == 1 && app.heater_lost);
+
+   /* One missed confirmation is sent again without the fault */
+   app.scene = FRONT_SCREEN;
+   CHECK(APP_TurnPeripheries(&app) != 0);
+   CHECK(m4_heater(0, &state) == 1U);
+   CHECK(heater_run(&app, 1, &state, 1000U) == 1U);
+   CHECK(state == 0 && app.heater_confirmed && !app.heater_lost);
+}
+
+int main(void)
+{
+   uint32_t dropped = 0;
+
+   test_watchdog(TEST_SECONDS);
+   host_init();
+   core_clock_init();
+   core_share_init();
+   test_steps();
+   test_threads(&dropped);
+   test_heater();
+   printf("rpc: %u calls on %u slots, %u timed out as expected\n", TEST_CALLS,
+          CORE_RPC_SLOTS, dropped);
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+/*
+ * test_scene.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_event.h"
+#include "app_rtc.h"
+#include "app_scene.h"
+#include "host.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the transition table of app_scene.c. Every scene is reached from
+ * the front scene by its buttons, then every event is dispatched in it and
+ * the next scene is compared with the table written down below, from the
+ * button titles. Then every sequence of TEST_DEPTH events is dispatched from
+ * the front scene. After each event the entry action has to have left the
+ * software timer, the delayed start in the schedule and the input lockout as
+ * the scene needs them.
+ */
+
+#define TEST_DEPTH (6U)
+#define TEST_CALENDAR (845769600U) /* 2026-10-20 00:00:00 */
+#define TEST_SECONDS (30U)
+
+/* Next scene, SCENE_NONE if the event does nothing there */
+static const Scene_t expected[SCENE_COUNT][EVENT_COUNT] = {
+    [FRONT_SCREEN] = {TURNON_SCENE, TIMER_CONFIG_SCENE, FRONT_SCREEN,
+                      TURNON_SCENE},
+    [TURNON_SCENE] = {FRONT_SCREEN, SCENE_NONE, FRONT_SCREEN, SCENE_NONE},
+    [TIMER_CONFIG_SCENE] = {SCENE_NONE, WAITING_SCENE, FRONT_SCREEN,
+                            TURNON_SCENE},
+    [WAITING_SCENE] = {FRONT_SCREEN, TURNON_SCENE, TURNON_SCENE,
+                       TURNON_SCENE},
+};
+
+/* Path of buttons from the front scene */
+static const struct {
+   uint32_t count;
+   Event_t event[2];
+} path[SCENE_COUNT] = {
+    [FRONT_SCREEN] = {0, {EVENT_LEFT_BUTTON}},
+    [TURNON_SCENE] = {1, {EVENT_LEFT_BUTTON}},
+    [TIMER_CONFIG_SCENE] = {1, {EVENT_RIGHT_BUTTON}},
+    [WAITING_SCENE] = {2, {EVENT_RIGHT_BUTTON, EVENT_RIGHT_BUTTON}},
+};
+
+static App_t app;
+
+/**
+ * @brief Start in the front scene with an empty schedule
+ */
+static void scene_reset(void)
+{
+   app_schedule_init();
+   APP_Init(&app);
+}
+
+/**
+ * @brief Check the state the entry action of the scene leaves
+ */
+static void scene_check(const Scene_t scene)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   const unsigned int count = app_schedule_save(entries);
+
+   CHECK(app.scene == scene);
+   CHECK(strcmp(APP_ButtonTitles(app.scene), APP_ButtonTitles(scene)) == 0);
+   switch (scene) {
+   case FRONT_SCREEN:
+      CHECK(app.timer == 0);
+      CHECK(!app_timer_active(&app.timer_expiry));
+      CHECK(app.delayed_start == 0 && count == 0);
+      break;
+   case TURNON_SCENE:
+      CHECK(app.timer == 60U * SECOND && app.timer_left == app.timer);
+      CHECK(app_timer_active(&app.timer_expiry));
+      CHECK(app.timer_expiry.expires == app.now + app.timer);
+      CHECK(app.delayed_start == 0 && count == 0);
+      break;
+   case TIMER_CONFIG_SCENE:
+      CHECK(app.config_timer == 17U * 60U * SECOND + 21U * SECOND);
+      CHECK(!app_timer_active(&app.timer_expiry));
+      CHECK(app.delayed_start == 0 && count == 0);
+      break;
+   case WAITING_SCENE:
+      CHECK(app.timer == app.config_timer && app.timer_left == app.timer);
+      CHECK(!app_timer_active(&app.timer_expiry));
+      CHECK(app.delayed_start != 0 && count == 1U);
+      CHECK(entries[0].id == app.delayed_start && !entries[0].weekly);
+      CHECK(entries[0].fire == APP_RtcNow() + app.config_timer / SECOND);
+      break;
+   default:
+      CHECK(0);
+   }
+}
+
+/**
+ * @brief Dispatch the event and check the next scene
+ */
+static void scene_step(const Event_t event)
+{
+   const Scene_t next = expected[app.scene][event];
+   const Scene_t from = app.scene;
+   const uint32_t version = app.status_version;
+
+   app._delay = 0;
+   APP_Dispatch(&app, event);
+
+   /* A transition locks the input, even one back into the same scene */
+   if (next != SCENE_NONE) {
+      scene_check(next);
+      CHECK(app._delay == 1U && app.delay_start == app.now);
+      CHECK(app.status_version != version);
+   } else {
+      scene_check(from);
+      CHECK(app._delay == 0 && app.status_version == version);
+   }
+}
+
+/**
+ * @brief Every event in every scene
+ */
+static void test_pairs(void)
+{
+   for (uint32_t scene = 0; scene < SCENE_COUNT; scene++) {
+      for (uint32_t event = 0; event < EVENT_COUNT; event++) {
+         scene_reset();
+         for (uint32_t i = 0; i < path[scene].count; i++)
+            scene_step(path[scene].event[i]);
+         scene_check((Scene_t)scene);
+         scene_step((Event_t)event);
+      }
+   }
+}
+
+/**
+ * @brief Every sequence of TEST_DEPTH events from the front scene
+ * @return count of dispatched events
+ */
+static uint32_t test_sequences(void)
+{
+   uint32_t sequences = 1, steps = 0;
+
+   for (uint32_t i = 0; i < TEST_DEPTH; i++)
+      sequences *= EVENT_COUNT;
+   for (uint32_t sequence = 0; sequence < sequences; sequence++) {
+      scene_reset();
+      for (uint32_t i = 0, s = sequence; i < TEST_DEPTH; i++) {
+         scene_step((Event_t)(s % EVENT_COUNT));
+         s /= EVENT_COUNT;
+         steps++;
+      }
+   }
+   return steps;
+}
+
+/**
+ * @brief The expiry of the software timer of the manual start is dispatched
+ *        by the step of the scene logic
+ */
+static void test_expiry(void)
+{
+   scene_reset();
+   scene_step(EVENT_LEFT_BUTTON);
+   app.now += app.timer - 1U;
+   app.now_us += (uint64_t)(app.timer - 1U) * 1000U;
+   APP_Step(&app, APP_EVENT_TIMER, NULL);
+   CHECK(app.scene == TURNON_SCENE && app.timer_left == 1U);
+   app.now++;
+   app.now_us += 1000U;
+   APP_Step(&app, APP_EVENT_TIMER, NULL);
+   scene_check(FRONT_SCREEN);
+}
+
+int main(void)
+{
+   test_watchdog(TEST_SECONDS);
+   host_start(TEST_CALENDAR);
+   test_pairs();
+   const uint32_t steps = test_sequences();
+   test_expiry();
+   printf("scene: %u scenes x %u events, %u events in sequences\n",
+          SCENE_COUNT, EVENT_COUNT, steps);
+   return EXIT_SUCCESS;
+}
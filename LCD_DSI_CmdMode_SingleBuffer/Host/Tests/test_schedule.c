@@ -0,0 +1,383 @@
+/*
+ * test_schedule.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_event.h"
+#include "app_rtc.h"
+#include "app_schedule.h"
+#include "core_clock.h"
+#include "host.h"
+#include "test.h"
+#include <time.h>
+
+/*
+ * Test of the schedule of app_schedule.c and of its RTC side in app_rtc.c.
+ * The heap is run against a plain array by random adds, removes and pops
+ * while the time goes on, and it is saved and loaded as over a reset. The
+ * calendar is compared with gmtime() for every day of 2000 .. 2099. Then the
+ * host RTC runs three weeks by the simulated clock: each wakeup by the alarm
+ * has to come at the time of an entry, or a week earlier for an entry ten
+ * days ahead, and the schedule has to survive a reset in the backup
+ * registers. The calendar is set forth and back with the starts kept.
+ */
+
+#define TEST_OPS (200000U)
+#define TEST_CALENDAR (845769600U) /* Tuesday 2026-10-20 00:00:00 */
+#define TEST_UNIX_2000 (946684800LL)
+
+/* Entries the heap has to hold */
+static app_schedule_entry_t model[APP_SCHEDULE_SIZE];
+static unsigned int model_count;
+
+/**
+ * @brief Index of the entry of the model
+ * @return -1 if there is none
+ */
+static int model_find(const uint16_t id)
+{
+   for (unsigned int i = 0; i < model_count; i++)
+      if (model[i].id == id)
+         return (int)i;
+   return -1;
+}
+
+/**
+ * @brief The first entry of the heap fires when the earliest of the model
+ */
+static void model_check(void)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   app_schedule_entry_t first;
+
+   CHECK(app_schedule_save(entries) == model_count);
+   for (unsigned int i = 0; i < model_count; i++) {
+      const int m = model_find(entries[i].id);
+      CHECK(m >= 0 && model[m].fire == entries[i].fire);
+      CHECK(model[m].weekly == entries[i].weekly);
+   }
+   if (model_count == 0) {
+      CHECK(app_schedule_peek(&first) == -1);
+      return;
+   }
+   CHECK(app_schedule_peek(&first) == 0);
+   for (unsigned int i = 0; i < model_count; i++)
+      CHECK(first.fire <= model[i].fire);
+}
+
+/**
+ * @brief Pop the due entries, they come in the order of firing
+ */
+static uint32_t model_pop(const uint32_t now)
+{
+   app_schedule_entry_t entry;
+   uint32_t popped = 0, last = 0;
+
+   while (app_schedule_pop(now, &entry) == 0) {
+      const int m = model_find(entry.id);
+
+      CHECK(m >= 0 && model[m].fire == entry.fire && entry.fire <= now);
+      CHECK(entry.fire >= last);
+      last = entry.fire;
+      if (entry.weekly) {
+         while (model[m].fire <= now)
+            model[m].fire += APP_SCHEDULE_WEEK;
+      } else {
+         model[m] = model[--model_count];
+      }
+      popped++;
+   }
+   for (unsigned int i = 0; i < model_count; i++)
+      CHECK(model[i].fire > now);
+   return popped;
+}
+
+/**
+ * @brief Random operations on the heap and on the model
+ * @return popped entries
+ */
+static uint32_t test_heap(void)
+{
+   uint32_t seed = 0x2468ACE1U;
+   uint32_t now = TEST_CALENDAR;
+   uint32_t popped = 0;
+
+   app_schedule_init();
+   model_count = 0;
+   for (uint32_t op = 0; op < TEST_OPS; op++) {
+      const uint32_t r = test_random(&seed);
+
+      switch (r % 8U) {
+      case 0:
+      case 1:
+      case 2: {
+         const uint32_t fire = now + (r >> 8) % (3U * APP_SCHEDULE_WEEK);
+         const uint16_t weekly = (r >> 4) & 1U;
+         const uint16_t id = app_schedule_add(fire, weekly);
+
+         if (model_count == APP_SCHEDULE_SIZE) {
+            CHECK(id == 0);
+            break;
+         }
+         CHECK(id != 0 && model_find(id) < 0);
+         model[model_count++] =
+             (app_schedule_entry_t){.fire = fire, .id = id, .weekly = weekly};
+         break;
+      }
+      case 3:
+         if (model_count == 0) {
+            CHECK(app_schedule_remove((uint16_t)(r >> 16)) == -1);
+            break;
+         }
+         const unsigned int m = (r >> 8) % model_count;
+         CHECK(app_schedule_remove(model[m].id) == 0);
+         CHECK(app_schedule_remove(model[m].id) == -1);
+         model[m] = model[--model_count];
+         break;
+      case 4: {
+         /* Saved and loaded as over a reset at the same time */
+         app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+
+         app_schedule_load(entries, app_schedule_save(entries), now);
+         break;
+      }
+      default:
+         now += (r >> 8) % APP_SCHEDULE_DAY;
+         popped += model_pop(now);
+         break;
+      }
+      model_check();
+   }
+   return popped;
+}
+
+/**
+ * @brief Entries missed while the board was off
+ */
+static void test_load(void)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   app_schedule_entry_t entry;
+   const uint32_t now = TEST_CALENDAR;
+
+   app_schedule_init();
+   const uint16_t weekly = app_schedule_add_weekly(now, 3, 6, 30);
+   const uint16_t once = app_schedule_add(now + 3600U, 0);
+   const uint16_t later = app_schedule_add(now + 30U * APP_SCHEDULE_DAY, 0);
+   const unsigned int count = app_schedule_save(entries);
+
+   /* Off for 17 days */
+   const uint32_t on = now + 17U * APP_SCHEDULE_DAY + 5U;
+   app_schedule_load(entries, count, on);
+   CHECK(app_schedule_save(entries) == 2U);
+   CHECK(app_schedule_peek(&entry) == 0 && entry.id == weekly);
+   CHECK(entry.fire > on && entry.fire - on <= APP_SCHEDULE_WEEK);
+   CHECK(entry.fire == app_schedule_time(26, 11, 11, 6, 30, 0));
+   CHECK(app_schedule_remove(once) == -1);
+   CHECK(app_schedule_remove(later) == 0);
+
+   /* Ids of the loaded entries are not given again */
+   const uint16_t id = app_schedule_add(on, 0);
+   CHECK(id != 0 && id != weekly && id != later);
+}
+
+/**
+ * @brief Weekly entries come on their day and time, at most a week ahead
+ */
+static void test_weekly(void)
+{
+   uint32_t seed = 0x0BADF00DU;
+
+   /* Every hour of the week before the first Monday, then at random */
+   for (uint32_t i = 0; i < 100000U; i++) {
+      const uint32_t now =
+          i < 7U * 24U ? i * 3600U
+                       : test_random(&seed) % (100U * 365U * APP_SCHEDULE_DAY);
+      const uint32_t r = test_random(&seed);
+      const uint8_t weekday = (uint8_t)(APP_SCHEDULE_MONDAY + r % 7U);
+      const uint8_t hours = (uint8_t)((r >> 8) % 24U);
+      const uint8_t minutes = (uint8_t)((r >> 16) % 60U);
+      app_schedule_entry_t entry;
+
+      app_schedule_init();
+      CHECK(app_schedule_add_weekly(now, weekday, hours, minutes) != 0);
+      CHECK(app_schedule_peek(&entry) == 0 && entry.weekly);
+      CHECK(entry.fire > now && entry.fire - now <= APP_SCHEDULE_WEEK);
+      CHECK(app_schedule_weekday(entry.fire) == weekday);
+      CHECK(entry.fire % APP_SCHEDULE_DAY == hours * 3600U + minutes * 60U);
+   }
+}
+
+/**
+ * @brief Calendar and weekday of every day against the C library
+ */
+static void test_calendar(void)
+{
+   for (uint32_t day = 0; day < 36525U; day++) {
+      const uint32_t second = (day * 7919U) % APP_SCHEDULE_DAY;
+      const time_t unix_time =
+          (time_t)(TEST_UNIX_2000 + (int64_t)day * APP_SCHEDULE_DAY + second);
+      struct tm tm;
+
+      CHECK(gmtime_r(&unix_time, &tm) != NULL);
+      const uint32_t time = app_schedule_time(
+          (uint8_t)(tm.tm_year - 100), (uint8_t)(tm.tm_mon + 1),
+          (uint8_t)tm.tm_mday, (uint8_t)tm.tm_hour, (uint8_t)tm.tm_min,
+          (uint8_t)tm.tm_sec);
+      CHECK(time == day * APP_SCHEDULE_DAY + second);
+      uint8_t year, month, mday;
+      app_schedule_date(time, &year, &month, &mday);
+      CHECK(year == tm.tm_year - 100 && month == tm.tm_mon + 1 &&
+            mday == tm.tm_mday);
+      CHECK(app_schedule_weekday(time) ==
+            (tm.tm_wday == 0 ? APP_SCHEDULE_SUNDAY : (uint8_t)tm.tm_wday));
+   }
+}
+
+/**
+ * @brief Nothing is posted, app_event_wait() returns with APP_EVENT_REFRESH
+ */
+void app_event_idle(void) { app_event_post(APP_EVENT_REFRESH); }
+
+/**
+ * @brief Sleep until the RTC alarm, take the due entries as the main loop
+ * @param at the alarm has to come at the time
+ * @return entries taken
+ */
+static uint32_t alarm_wakeup(const uint32_t at)
+{
+   uint64_t us;
+
+   CHECK(host_rtc_alarm(&us) == 0);
+   host_clock_set(us);
+   CHECK(APP_RtcNow() == at);
+   CHECK(app_event_wait() == APP_EVENT_ALARM);
+   return APP_ScheduleDue();
+}
+
+/**
+ * @brief Three weeks of the RTC. A start ten days ahead wakes up a week
+ * earlier on the same day, then a weekly start on Wednesday 06:30 is added.
+ */
+static void test_rtc(void)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+
+   host_start(TEST_CALENDAR);
+   (void)app_event_wait();
+   CHECK(app_schedule_add(APP_RtcNow() + 10U * APP_SCHEDULE_DAY + 3600U, 0));
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+   CHECK(alarm_wakeup(app_schedule_time(26, 10, 23, 1, 0, 0)) == 0);
+
+   const uint16_t weekly = app_schedule_add_weekly(APP_RtcNow(), 3, 6, 30);
+   CHECK(weekly != 0);
+   APP_ScheduleStore();
+   APP_ScheduleArm();
+
+   /* Reset, RAM is lost, RTC and its backup registers are kept */
+   host_clock_reset();
+   core_clock_init();
+   app_schedule_init();
+   APP_ScheduleRestore(APP_RtcNow());
+   CHECK(app_schedule_save(entries) == 2U);
+
+   CHECK(alarm_wakeup(app_schedule_time(26, 10, 28, 6, 30, 0)) == 1U);
+   CHECK(alarm_wakeup(app_schedule_time(26, 10, 30, 1, 0, 0)) == 1U);
+   CHECK(alarm_wakeup(app_schedule_time(26, 11, 4, 6, 30, 0)) == 1U);
+   CHECK(alarm_wakeup(app_schedule_time(26, 11, 11, 6, 30, 0)) == 1U);
+   CHECK(app_schedule_save(entries) == 1U && entries[0].id == weekly);
+}
+
+/**
+ * @brief The seed sets only a calendar behind it. Setting the calendar back
+ * keeps the weekly start at its time of the week and the one shot start at
+ * its delay, weekly starts are added and removed at run time.
+ */
+static void test_rtc_set(void)
+{
+   app_schedule_entry_t entries[APP_SCHEDULE_SIZE];
+   const uint32_t later = app_schedule_time(26, 11, 1, 12, 0, 0);
+   const uint32_t back = app_schedule_time(26, 9, 7, 23, 59, 58);
+
+   host_start(TEST_CALENDAR);
+   (void)app_event_wait();
+   app_schedule_init();
+   APP_ScheduleStore();
+   CHECK(APP_RtcSeed(0) == 0 && APP_RtcNow() == TEST_CALENDAR);
+   CHECK(APP_RtcSeed(TEST_CALENDAR - 1U) == 0);
+   CHECK(APP_RtcSeed(later) == 1 && APP_RtcNow() == later);
+   CHECK(APP_RtcSeed(later) == 0);
+
+   CHECK(APP_ScheduleAddWeekly(0, 6, 30) == 0);
+   CHECK(APP_ScheduleAddWeekly(8, 6, 30) == 0);
+   CHECK(APP_ScheduleAddWeekly(3, 24, 0) == 0);
+   CHECK(APP_ScheduleAddWeekly(3, 6, 60) == 0);
+   const uint16_t weekly = APP_ScheduleAddWeekly(3, 6, 30);
+   const uint16_t sunday = APP_ScheduleAddWeekly(APP_SCHEDULE_SUNDAY, 9, 0);
+   CHECK(weekly != 0 && sunday != 0);
+   CHECK(app_schedule_add(APP_RtcNow() + 3600U, 0) != 0);
+   APP_ScheduleStore();
+   CHECK(APP_ScheduleRemove(sunday) == 0);
+   CHECK(APP_ScheduleRemove(sunday) == -1);
+
+   /* Monday 2026-09-07, the starts keep their delay and time of the week */
+   APP_RtcSet(back);
+   CHECK(APP_RtcNow() == back);
+   CHECK(app_schedule_weekday(back) == APP_SCHEDULE_MONDAY);
+   CHECK(app_schedule_save(entries) == 2U);
+   CHECK(alarm_wakeup(back + 3600U) == 1U);
+   CHECK(alarm_wakeup(app_schedule_time(26, 9, 9, 6, 30, 0)) == 1U);
+
+   /* Stored by the removal and the set, kept over reset */
+   host_clock_reset();
+   core_clock_init();
+   app_schedule_init();
+   APP_ScheduleRestore(APP_RtcNow());
+   CHECK(app_schedule_save(entries) == 1U && entries[0].id == weekly);
+   CHECK(alarm_wakeup(app_schedule_time(26, 9, 16, 6, 30, 0)) == 1U);
+
+   /* Set forth onto the second of the start, it waits for the next week */
+   APP_RtcSet(app_schedule_time(26, 9, 30, 6, 30, 0));
+   CHECK(alarm_wakeup(app_schedule_time(26, 10, 7, 6, 30, 0)) == 1U);
+}
+
+int main(void)
+{
+   test_watchdog(60);
+   test_calendar();
+   test_weekly();
+   test_load();
+   const uint32_t popped = test_heap();
+   test_rtc();
+   test_rtc_set();
+   printf("schedule: %u operations, %u entries fired, 3 weeks of RTC\n",
+          TEST_OPS, popped);
+   return EXIT_SUCCESS;
+}
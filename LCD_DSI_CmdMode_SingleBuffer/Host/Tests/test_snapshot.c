@@ -0,0 +1,132 @@
+/*
+ * test_snapshot.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "core_snapshot.h"
+#include "test.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*
+ * Torture test of the seqlock snapshot of core_snapshot.c. M4 is a thread
+ * publishing snapshots as fast as it can, every word of a snapshot is derived
+ * from its number. M7 reads at the same time and checks that every copy it
+ * gets is whole and never older than the previous one.
+ */
+
+#define TEST_NS (1000000000ULL) /* how long the threads run */
+
+static atomic_uint writer_done;
+
+/**
+ * @brief Snapshot number n, its words tell a torn copy
+ */
+static void snapshot_make(core_snapshot_t *const snapshot, const uint32_t n)
+{
+   snapshot->heater = (int32_t)n;
+   snapshot->temperature = (int32_t)(n * 2654435761U);
+   snapshot->faults = ~n;
+   snapshot->uptime_ms = n ^ 0x5A5A5A5AU;
+}
+
+/**
+ * @brief Check the snapshot is whole
+ * @return its number
+ */
+static uint32_t snapshot_check(const core_snapshot_t *const snapshot)
+{
+   const uint32_t n = (uint32_t)snapshot->heater;
+   core_snapshot_t expected;
+
+   snapshot_make(&expected, n);
+   CHECK(snapshot->temperature == expected.temperature);
+   CHECK(snapshot->faults == expected.faults);
+   CHECK(snapshot->uptime_ms == expected.uptime_ms);
+   return n;
+}
+
+/**
+ * @brief M4 publishes snapshots 1, 2, 3 ... until the time is up
+ */
+static void *m4_run(void *const arg)
+{
+   uint32_t *const written = arg;
+   const uint64_t end = test_ns() + TEST_NS;
+   core_snapshot_t snapshot;
+   uint32_t n = 1;
+
+   do {
+      /* The clock is read once in a while, so the writes are dense */
+      for (uint32_t i = 0; i < 1000U; i++, n++) {
+         snapshot_make(&snapshot, n);
+         core_snapshot_write(&snapshot);
+      }
+   } while (test_ns() < end);
+   *written = n - 1U;
+   atomic_store(&writer_done, 1U);
+   return NULL;
+}
+
+int main(void)
+{
+   core_snapshot_t snapshot;
+   uint32_t written = 0;
+   uint32_t reads = 0, busy = 0, last = 0;
+   pthread_t thread;
+
+   /* A single thread reads back what it wrote */
+   core_snapshot_init();
+   CHECK(core_snapshot_read(&snapshot) == 0);
+   CHECK(snapshot.heater == 0 && snapshot.faults == 0);
+   snapshot_make(&snapshot, 0);
+   core_snapshot_write(&snapshot);
+   CHECK(core_snapshot_read(&snapshot) == 0 && snapshot_check(&snapshot) == 0);
+
+   CHECK(pthread_create(&thread, NULL, m4_run, &written) == 0);
+   while (!atomic_load(&writer_done)) {
+      if (core_snapshot_read(&snapshot) != 0) {
+         busy++;
+         continue;
+      }
+      const uint32_t n = snapshot_check(&snapshot);
+      CHECK(n >= last);
+      last = n;
+      reads++;
+   }
+   CHECK(pthread_join(thread, NULL) == 0);
+
+   /* The last snapshot is the one read after the writer stopped */
+   CHECK(core_snapshot_read(&snapshot) == 0);
+   CHECK(snapshot_check(&snapshot) == written);
+
+   printf("snapshot: %u written, %u whole reads, %u reads gave up, none torn\n",
+          written, reads, busy);
+   return EXIT_SUCCESS;
+}
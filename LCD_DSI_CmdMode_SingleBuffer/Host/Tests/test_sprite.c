@@ -0,0 +1,272 @@
+/*
+ * test_sprite.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_sprite.h"
+#include "test.h"
+#include <string.h>
+
+/*
+ * Test of the sprite cache of app_sprite.c. A pool of four sprites evicts the
+ * least recently used ones, a sprite too big for the empty pool is refused
+ * and the slots run out before a pool of tiny sprites. Then random sprites of
+ * random sizes are got from a small pool against a model of the LRU order:
+ * each eviction drops the sprites used longest ago, the sprites placed into
+ * the gaps never overlap each other nor leave the pool, and a hit gives the
+ * pixels drawn on the miss.
+ */
+
+#define TEST_POOL (16384U)
+#define TEST_GUARD (256U)  /* bytes around the pool, never written */
+#define TEST_KEYS (48U)    /* sprites of the random test */
+#define TEST_STEPS (200000U)
+
+static uint8_t arena[TEST_GUARD + TEST_POOL + TEST_GUARD]
+    __attribute__((aligned(32)));
+static uint8_t *const pool = arena + TEST_GUARD;
+static uint32_t seed = 0x5B1DU;
+
+/* Sprite of the model */
+typedef struct {
+   uint64_t key;
+   uint32_t width;
+   uint32_t height;
+   uint32_t *pixels; /* NULL while not in the cache */
+   uint32_t used;    /* step of the last get */
+} model_t;
+
+static model_t model[TEST_KEYS];
+
+/**
+ * @brief Get the sprite, check the counters
+ * @return 1 if it was created
+ */
+static uint32_t get(const uint64_t key, const uint32_t width,
+                    const uint32_t height, uint32_t **const pixels)
+{
+   const app_sprite_stats_t before = *app_sprite_stats();
+   uint32_t created;
+
+   *pixels = app_sprite_get(key, width, height, &created);
+   const app_sprite_stats_t *const after = app_sprite_stats();
+   CHECK(after->hits + after->misses + after->too_big ==
+         before.hits + before.misses + before.too_big + 1U);
+   CHECK(after->misses - before.misses == created);
+   CHECK(after->too_big - before.too_big == (*pixels == NULL));
+   if (!created)
+      CHECK(after->evictions == before.evictions);
+   return created;
+}
+
+/**
+ * @brief Four sprites fill the pool, the least recently used go first
+ */
+static void test_lru(void)
+{
+   const uint32_t size = 4U * 32U * 32U;
+   uint32_t *pixels[7];
+   uint32_t *again;
+
+   app_sprite_init(pool, 4U * size);
+   const app_sprite_stats_t start = *app_sprite_stats();
+   for (uint64_t key = 1; key <= 4U; key++)
+      CHECK(get(key, 32, 32, &pixels[key]) == 1);
+   CHECK(app_sprite_stats()->used == 4U * size);
+
+   /* 1 and 3 are used again, 2 is the least recently used */
+   CHECK(get(1, 32, 32, &again) == 0 && again == pixels[1]);
+   CHECK(get(3, 32, 32, &again) == 0 && again == pixels[3]);
+   CHECK(get(5, 32, 32, &pixels[5]) == 1 && pixels[5] == pixels[2]);
+   CHECK(app_sprite_stats()->evictions == start.evictions + 1U);
+   /* Then 4, which was got before 1 and 3 again */
+   CHECK(get(2, 32, 32, &again) == 1 && again == pixels[4]);
+   CHECK(get(1, 32, 32, &again) == 0 && again == pixels[1]);
+   CHECK(get(3, 32, 32, &again) == 0 && again == pixels[3]);
+   CHECK(app_sprite_stats()->evictions == start.evictions + 2U);
+
+   /* The same key of another size is another sprite. 5 and 2 leave two
+      gaps apart, 1 goes too and its gap and the gap of 5 fit it. */
+   CHECK(get(1, 64, 32, &pixels[6]) == 1 && pixels[6] == pixels[1]);
+   CHECK(app_sprite_stats()->evictions == start.evictions + 5U);
+   CHECK(get(3, 32, 32, &again) == 0 && again == pixels[3]);
+   CHECK(app_sprite_stats()->used == 3U * size);
+
+   CHECK(app_sprite_stats()->hits == start.hits + 5U);
+   CHECK(app_sprite_stats()->misses == start.misses + 7U);
+}
+
+/**
+ * @brief Too big sprites are refused and the cache is left alone, the whole
+ *        pool fits, tiny sprites run out of the slots first
+ */
+static void test_limits(void)
+{
+   uint32_t *pixels;
+   uint32_t *first;
+
+   app_sprite_init(pool, TEST_POOL);
+   app_sprite_stats_t start = *app_sprite_stats();
+   CHECK(get(1, 1, 1, &first) == 1);
+   CHECK(get(2, TEST_POOL / 4U + 1U, 1, &pixels) == 0 && pixels == NULL);
+   CHECK(get(3, 0, 10, &pixels) == 0 && pixels == NULL);
+   CHECK(app_sprite_stats()->too_big == start.too_big + 2U);
+   CHECK(get(1, 1, 1, &pixels) == 0 && pixels == first);
+
+   CHECK(get(4, TEST_POOL / 4U, 1, &pixels) == 1 && pixels == (void *)pool);
+   CHECK(app_sprite_stats()->evictions == start.evictions + 1U);
+   CHECK(app_sprite_stats()->used == TEST_POOL);
+
+   /* A pixel takes a whole allocation of 32 bytes */
+   app_sprite_init(pool, TEST_POOL);
+   start = *app_sprite_stats();
+   for (uint64_t key = 0; key < APP_SPRITE_MAX; key++) {
+      CHECK(get(key, 1, 1, &pixels) == 1);
+      CHECK(pixels == (void *)(pool + 32U * key));
+   }
+   CHECK(app_sprite_stats()->used == 32U * APP_SPRITE_MAX);
+   CHECK(get(APP_SPRITE_MAX, 1, 1, &pixels) == 1 && pixels == (void *)pool);
+   CHECK(app_sprite_stats()->evictions == start.evictions + 1U);
+   CHECK(get(0, 1, 1, &pixels) == 1);
+   CHECK(pixels == (void *)(pool + 32U));
+   CHECK(app_sprite_stats()->used == 32U * APP_SPRITE_MAX);
+}
+
+/**
+ * @brief Bytes of the sprite in the pool
+ */
+static uint32_t model_size(const model_t *const m)
+{
+   return (4U * m->width * m->height + 31U) & ~31U;
+}
+
+/**
+ * @brief Fill the pixels by the key and the index
+ */
+static void model_draw(const model_t *const m)
+{
+   for (uint32_t i = 0; i < m->width * m->height; i++)
+      m->pixels[i] = (uint32_t)m->key * 2654435761U + i;
+}
+
+/**
+ * @brief Check the pixels drawn by model_draw
+ */
+static void model_check(const model_t *const m)
+{
+   for (uint32_t i = 0; i < m->width * m->height; i++)
+      CHECK(m->pixels[i] == (uint32_t)m->key * 2654435761U + i);
+}
+
+/**
+ * @brief Drop the least recently used sprite of the model
+ */
+static void model_evict(void)
+{
+   model_t *lru = NULL;
+
+   for (uint32_t i = 0; i < TEST_KEYS; i++)
+      if (model[i].pixels != NULL && (lru == NULL || model[i].used < lru->used))
+         lru = &model[i];
+   CHECK(lru != NULL);
+   lru->pixels = NULL;
+}
+
+/**
+ * @brief Random sprites against the model of the LRU order
+ */
+static void test_model(void)
+{
+   app_sprite_init(pool, TEST_POOL);
+   for (uint32_t i = 0; i < TEST_KEYS; i++) {
+      /* Two sizes of some keys, sprites up to a fifth of the pool */
+      model[i].key = 1000U + i % (TEST_KEYS - 8U);
+      model[i].width = 1U + test_random(&seed) % 64U;
+      model[i].height = 1U + test_random(&seed) % 16U;
+      model[i].pixels = NULL;
+   }
+
+   for (uint32_t step = 1; step <= TEST_STEPS; step++) {
+      model_t *const m = &model[test_random(&seed) % TEST_KEYS];
+      const uint32_t evictions = app_sprite_stats()->evictions;
+      uint32_t *pixels;
+
+      const uint32_t created = get(m->key, m->width, m->height, &pixels);
+      CHECK(pixels != NULL);
+      CHECK(created == (m->pixels == NULL));
+      if (!created) {
+         CHECK(pixels == m->pixels);
+         model_check(m);
+         m->used = step;
+         continue;
+      }
+
+      /* The evicted sprites were used longest ago */
+      for (uint32_t e = evictions; e != app_sprite_stats()->evictions; e++)
+         model_evict();
+      m->pixels = pixels;
+      m->used = step;
+
+      const uint8_t *const start = (const uint8_t *)pixels;
+      const uint8_t *const end = start + model_size(m);
+      uint32_t used = 0, count = 0;
+      CHECK(start >= pool && end <= pool + TEST_POOL);
+      CHECK((uintptr_t)start % 32U == 0);
+      for (uint32_t i = 0; i < TEST_KEYS; i++) {
+         const model_t *const other = &model[i];
+         const uint8_t *const at = (const uint8_t *)other->pixels;
+
+         if (at == NULL)
+            continue;
+         used += model_size(other);
+         count++;
+         if (other != m)
+            CHECK(at + model_size(other) <= start || at >= end);
+      }
+      CHECK(count <= APP_SPRITE_MAX);
+      CHECK(app_sprite_stats()->used == used);
+      model_draw(m);
+   }
+
+   for (uint32_t i = 0; i < TEST_GUARD; i++)
+      CHECK(arena[i] == 0 && arena[TEST_GUARD + TEST_POOL + i] == 0);
+}
+
+int main(void)
+{
+   test_watchdog(60);
+   test_lru();
+   test_limits();
+   test_model();
+
+   const app_sprite_stats_t *const stats = app_sprite_stats();
+   printf("sprite: %u random gets, %u hits, %u misses, %u evictions\n",
+          TEST_STEPS, stats->hits, stats->misses, stats->evictions);
+   return EXIT_SUCCESS;
+}
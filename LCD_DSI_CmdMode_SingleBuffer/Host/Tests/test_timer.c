@@ -0,0 +1,371 @@
+/*
+ * test_timer.c
+ *
+ *  Created on: 17. 10. 2026
+ *      Author: agent
+ *              agent@local
+ *
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "app_timer.h"
+#include "test.h"
+
+/*
+ * Test of the timer wheel of app_timer.c. Timers on the boundaries of all
+ * levels fire at their tick after the cascades, a callback cancels timers
+ * taken with it or moved down by the same cascade, re-arms itself and the
+ * tick wraps. Then a random sequence of starts, cancels and runs, also from
+ * the callbacks, is checked against a model, where every timer fires at its
+ * expiry, or at the next processed tick when it is in the past.
+ */
+
+#define TEST_TIMERS (64U)
+#define TEST_STEPS (1000000U)
+
+typedef struct {
+   app_timer_t timer;
+   int active;   /* the model */
+   uint32_t due; /* tick of the callback by the model */
+   uint32_t fired;
+   uint32_t fired_at;
+} entry_t;
+
+static entry_t entries[TEST_TIMERS];
+static uint32_t tick;      /* now of the running app_timer_run */
+static uint32_t wheel_now; /* next tick processed by the wheel */
+static uint32_t last_due;  /* callbacks come in the order of ticks */
+static uint32_t seed = 0x7133U;
+
+/**
+ * @brief Count the callback and note the tick of app_timer_run
+ */
+static void count_expired(app_timer_t *const timer, void *const arg)
+{
+   entry_t *const entry = arg;
+
+   CHECK(&entry->timer == timer);
+   CHECK(!app_timer_active(timer));
+   entry->fired++;
+   entry->fired_at = tick;
+}
+
+/**
+ * @brief Reset the wheel and the entries
+ * @param now
+ */
+static void reset(const uint32_t now)
+{
+   app_timer_init(now);
+   for (uint32_t i = 0; i < TEST_TIMERS; i++) {
+      entries[i].timer.pprev = NULL;
+      entries[i].active = 0;
+      entries[i].fired = 0;
+   }
+   tick = now;
+   wheel_now = now;
+}
+
+/**
+ * @brief A timer on the boundaries of every level fires at its tick, not one
+ *        tick earlier, also when the ticks go one by one over the boundary
+ */
+static void test_levels(void)
+{
+   static const uint32_t bases[] = {0U, 0x12345U, 0xFFFFFFF0U, 0xBFFFFFC0U};
+
+   for (uint32_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+      for (uint32_t level = 0; level <= APP_TIMER_LEVELS; level++) {
+         for (int32_t offset = -1; offset <= 1; offset++) {
+            const uint32_t delay =
+                (1UL << (level * APP_TIMER_BITS)) + (uint32_t)offset;
+            const uint32_t expires = bases[b] + delay;
+            entry_t *const entry = &entries[0];
+
+            if (delay == 0) {
+               continue;
+            }
+            reset(bases[b]);
+            app_timer_start(&entry->timer, expires, count_expired, entry);
+            if (delay > 3U) {
+               tick = expires - 3U;
+               app_timer_run(tick);
+            }
+            for (tick++; tick != expires; tick++) {
+               app_timer_run(tick);
+               CHECK(entry->fired == 0);
+               CHECK(app_timer_active(&entry->timer));
+            }
+            app_timer_run(tick);
+            CHECK(entry->fired == 1);
+            CHECK(entry->fired_at == expires);
+            CHECK(app_timer_next(&tick) < 0);
+         }
+      }
+   }
+}
+
+/**
+ * @brief Cancel the other timers of the same expiry, taken into the same
+ *        list, and the later timer, which the cascade moved down
+ */
+static void cancel_others(app_timer_t *const timer, void *const arg)
+{
+   count_expired(timer, arg);
+   for (uint32_t i = 0; i < 4U; i++) {
+      app_timer_cancel(&entries[i].timer);
+   }
+}
+
+/**
+ * @brief Timers of one slot of the highest level are moved down together,
+ *        the first callback cancels the others
+ */
+static void test_cancel(void)
+{
+   const uint32_t base = 1000U;
+   const uint32_t expires = base + (3UL << (4U * APP_TIMER_BITS)) + 77U;
+
+   reset(base);
+   for (uint32_t i = 0; i < 3U; i++) {
+      app_timer_start(&entries[i].timer, expires, cancel_others, &entries[i]);
+   }
+   app_timer_start(&entries[3].timer, expires + 1U, cancel_others,
+                   &entries[3]);
+
+   tick = expires;
+   app_timer_run(tick);
+   CHECK(entries[0].fired + entries[1].fired + entries[2].fired == 1);
+   CHECK(entries[3].fired == 0);
+   for (uint32_t i = 0; i < 4U; i++) {
+      CHECK(!app_timer_active(&entries[i].timer));
+   }
+   /* The slots of the cancelled timers are empty */
+   CHECK(app_timer_next(&tick) < 0);
+   tick = expires + (1UL << 30);
+   app_timer_run(tick);
+   CHECK(entries[3].fired == 0);
+}
+
+/**
+ * @brief Restart the timer by its period in the argument
+ */
+static void rearm(app_timer_t *const timer, void *const arg)
+{
+   entry_t *const entry = arg;
+
+   count_expired(timer, arg);
+   if (entry->fired < 10U) {
+      app_timer_start(timer, timer->expires + entry->due, rearm, arg);
+   }
+}
+
+/**
+ * @brief A timer re-armed from its callback fires by its period over the
+ *        wrap, a timer re-armed for the tick, which runs, fires once per
+ *        app_timer_run
+ */
+static void test_rearm(void)
+{
+   const uint32_t base = UINT32_MAX - 2500U;
+   entry_t *const periodic = &entries[0];
+   entry_t *const again = &entries[1];
+
+   reset(base);
+   periodic->due = 1000U;
+   app_timer_start(&periodic->timer, base + 1000U, rearm, periodic);
+   for (tick = base + 1U; tick != base + 20000U; tick++) {
+      const uint32_t fired = periodic->fired;
+
+      app_timer_run(tick);
+      if ((tick - base) % 1000U == 0 && tick - base <= 10000U) {
+         CHECK(periodic->fired == fired + 1U);
+         CHECK(periodic->fired_at == tick);
+      } else {
+         CHECK(periodic->fired == fired);
+      }
+   }
+   CHECK(periodic->fired == 10U);
+   CHECK(!app_timer_active(&periodic->timer));
+
+   again->due = 0;
+   app_timer_start(&again->timer, tick, rearm, again);
+   app_timer_run(tick);
+   CHECK(again->fired == 1);
+   app_timer_run(tick);
+   CHECK(again->fired == 1);
+   app_timer_run(++tick);
+   CHECK(again->fired == 2);
+   CHECK(again->fired_at == tick);
+   app_timer_cancel(&again->timer);
+   CHECK(app_timer_next(&tick) < 0);
+}
+
+/**
+ * @brief Random delay, on every scale up to beyond the range of the wheel,
+ *        often on a boundary of a level
+ * @return uint32_t ticks
+ */
+static uint32_t random_delay(void)
+{
+   const uint32_t r = test_random(&seed);
+
+   if (r % 8U == 0) {
+      const uint32_t level = 1U + (r >> 3) % APP_TIMER_LEVELS;
+      return (1UL << (level * APP_TIMER_BITS)) - 1U + (r >> 6) % 3U;
+   }
+   return test_random(&seed) & ((2UL << (r >> 3) % 31U) - 1U);
+}
+
+/**
+ * @brief Start the timer in the wheel and the model
+ * @param entry
+ * @param expires
+ */
+static void model_expired(app_timer_t *timer, void *arg);
+static void model_start(entry_t *const entry, const uint32_t expires)
+{
+   entry->active = 1;
+   entry->due = (int32_t)(expires - wheel_now) < 0 ? wheel_now : expires;
+   app_timer_start(&entry->timer, expires, model_expired, entry);
+}
+
+/**
+ * @brief Cancel the timer in the wheel and the model
+ * @param entry
+ */
+static void model_cancel(entry_t *const entry)
+{
+   entry->active = 0;
+   app_timer_cancel(&entry->timer);
+}
+
+/**
+ * @brief Start or cancel a random timer, sometimes in the past
+ * @param from the tick, which the delay starts at
+ */
+static void model_action(const uint32_t from)
+{
+   entry_t *const entry = &entries[test_random(&seed) % TEST_TIMERS];
+   const uint32_t r = test_random(&seed) % 8U;
+
+   if (r < 2U) {
+      model_cancel(entry);
+   } else if (r == 2U) {
+      model_start(entry, from - test_random(&seed) % 100U);
+   } else if (r < 6U) {
+      model_start(entry, from + random_delay());
+   }
+}
+
+/**
+ * @brief The callback comes at the tick of the model and in the order of
+ *        the ticks, then it starts or cancels any timer, also itself
+ */
+static void model_expired(app_timer_t *const timer, void *const arg)
+{
+   entry_t *const entry = arg;
+
+   CHECK(&entry->timer == timer);
+   CHECK(entry->active);
+   CHECK(!app_timer_active(timer));
+   CHECK((int32_t)(entry->due - tick) <= 0);
+   CHECK((int32_t)(entry->due - last_due) >= 0);
+   entry->active = 0;
+   last_due = entry->due;
+   wheel_now = entry->due + 1U;
+
+   if (test_random(&seed) % 4U == 0) {
+      model_start(entry, entry->due + random_delay() % 3U);
+   }
+   model_action(wheel_now);
+}
+
+/**
+ * @brief Random starts, cancels and runs over many wraps of the tick
+ */
+static void test_model(void)
+{
+   uint32_t runs = 0;
+
+   reset(UINT32_MAX - 1000U);
+   wheel_now = tick + 1U;
+   last_due = tick;
+
+   for (uint32_t step = 0; step < TEST_STEPS; step++) {
+      if (test_random(&seed) % 2U == 0) {
+         model_action(wheel_now);
+         continue;
+      }
+
+      /* Jumps up to 2^29, so the model keeps the order of the ticks */
+      const uint32_t r = test_random(&seed);
+      tick += r % 4U == 0 ? 0U : test_random(&seed) & ((2UL << r % 29U) - 1U);
+      app_timer_run(tick);
+      if ((int32_t)(tick - wheel_now) >= 0) {
+         wheel_now = tick + 1U;
+      }
+      last_due = tick;
+      runs++;
+
+      uint32_t next;
+      uint32_t first = 0;
+      int active = 0;
+      for (uint32_t i = 0; i < TEST_TIMERS; i++) {
+         const entry_t *const entry = &entries[i];
+
+         CHECK(app_timer_active(&entry->timer) == entry->active);
+         if (!entry->active) {
+            continue;
+         }
+         CHECK((int32_t)(entry->due - tick) > 0);
+         if (!active || (int32_t)(entry->due - first) < 0) {
+            first = entry->due;
+         }
+         active = 1;
+      }
+      if (active) {
+         CHECK(app_timer_next(&next) == 0);
+         CHECK((int32_t)(next - wheel_now) >= 0);
+         CHECK((int32_t)(next - first) <= 0);
+      } else {
+         CHECK(app_timer_next(&next) < 0);
+      }
+   }
+   CHECK(runs > TEST_STEPS / 4U);
+}
+
+int main(void)
+{
+   test_watchdog(60);
+
+   test_levels();
+   test_cancel();
+   test_rearm();
+   test_model();
+
+   printf("timer: levels, cancel, re-arm and %u random steps OK\n",
+          TEST_STEPS);
+   return EXIT_SUCCESS;
+}
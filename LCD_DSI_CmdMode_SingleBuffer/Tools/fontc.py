@@ -0,0 +1,570 @@
+#!/usr/bin/env python3
+#
+# fontc.py
+#
+#  Created on: 16. 10. 2026
+#      Author: agent
+#
+# Copyright (c) 2026 agent
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+"""Font compiler, TTF or BDF into 4 bpp alpha glyph tables of app_font.h.
+
+Every glyph is stored as its bounding box only, 2 pixels per byte with the
+left pixel in the low nibble as DMA2D reads A4. Box width is even, so rows
+are whole bytes. Boxes are placed inside the cell of the glyph advance and
+the line height, so the renderer draws glyphs without clipping.
+
+TrueType outlines are rasterized here, without hinting and without any
+dependency: coverage is exact horizontally and sampled by SUBROWS lines per
+pixel vertically. BDF fonts are bitmaps, --scale N averages N x N pixels of
+a large font into one alpha pixel.
+
+Example, the title font of the toaster:
+  fontc.py Lato-Regular.ttf --name FontLato20 --size 19 --height 20 \\
+      --baseline 16 --advance 17 -o ../Utilities/Fonts/font_lato20.c
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+FIRST = 0x20
+LAST = 0x7E
+SUBROWS = 16
+
+
+class Glyph:
+    """Alpha bitmap of one glyph, 0..255, relative to the pen at baseline."""
+
+    def __init__(self, width, height, left, top, advance, alpha):
+        self.width = width      # pixels
+        self.height = height
+        self.left = left        # box from the pen position, x
+        self.top = top          # box top above the baseline, y up
+        self.advance = advance  # pen move, pixels
+        self.alpha = alpha      # rows of width values
+
+
+# TrueType ------------------------------------------------------------------
+
+
+class TrueType:
+    """Tables needed to rasterize simple and composite glyf outlines."""
+
+    def __init__(self, data):
+        self.data = data
+        self.tables = {}
+        count = struct.unpack_from(">H", data, 4)[0]
+        for i in range(count):
+            tag, _, offset, length = struct.unpack_from(">4sIII", data,
+                                                        12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        if "glyf" not in self.tables:
+            raise ValueError("only TrueType outlines (glyf) are supported")
+
+        head = self.tables["head"][0]
+        self.units = struct.unpack_from(">H", data, head + 18)[0]
+        self.long_loca = struct.unpack_from(">h", data, head + 50)[0] == 1
+        hhea = self.tables["hhea"][0]
+        self.metrics = struct.unpack_from(">H", data, hhea + 34)[0]
+        self.cmap = self._cmap()
+
+    def _u16(self, offset):
+        return struct.unpack_from(">H", self.data, offset)[0]
+
+    def _cmap(self):
+        """Unicode BMP map of format 4 subtable."""
+        base = self.tables["cmap"][0]
+        mapping = {}
+        for i in range(self._u16(base + 2)):
+            platform, encoding, offset = struct.unpack_from(
+                ">HHI", self.data, base + 4 + 8 * i)
+            table = base + offset
+            if (platform, encoding) not in ((3, 1), (0, 3)) or \
+                    self._u16(table) != 4:
+                continue
+            segments = self._u16(table + 6) // 2
+            ends = table + 14
+            starts = ends + 2 * segments + 2
+            deltas = starts + 2 * segments
+            ranges = deltas + 2 * segments
+            for s in range(segments):
+                end = self._u16(ends + 2 * s)
+                start = self._u16(starts + 2 * s)
+                delta = self._u16(deltas + 2 * s)
+                range_offset = self._u16(ranges + 2 * s)
+                for code in range(start, min(end, 0xFFFE) + 1):
+                    if range_offset == 0:
+                        index = (code + delta) & 0xFFFF
+                    else:
+                        at = ranges + 2 * s + range_offset + \
+                            2 * (code - start)
+                        index = self._u16(at)
+                        if index:
+                            index = (index + delta) & 0xFFFF
+                    mapping[code] = index
+            return mapping
+        raise ValueError("no Unicode cmap format 4")
+
+    def name(self, name_id):
+        """String of the name table, e.g. 0 copyright, 13 license."""
+        base = self.tables["name"][0]
+        count, strings = struct.unpack_from(">HH", self.data, base + 2)
+        for i in range(count):
+            platform, _, _, nid, length, offset = struct.unpack_from(
+                ">HHHHHH", self.data, base + 6 + 12 * i)
+            if nid != name_id:
+                continue
+            raw = self.data[base + strings + offset:
+                            base + strings + offset + length]
+            return raw.decode("utf-16-be" if platform in (0, 3)
+                              else "latin-1")
+        return ""
+
+    def advance(self, index):
+        hmtx = self.tables["hmtx"][0]
+        return self._u16(hmtx + 4 * min(index, self.metrics - 1))
+
+    def _glyph_range(self, index):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * index)
+        else:
+            start, end = (2 * v for v in
+                          struct.unpack_from(">HH", self.data,
+                                             loca + 2 * index))
+        glyf = self.tables["glyf"][0]
+        return glyf + start, end - start
+
+    def contours(self, index, depth=0):
+        """Closed contours of the glyph, lists of (x, y, on_curve)."""
+        offset, length = self._glyph_range(index)
+        if length == 0 or depth > 8:
+            return []
+        count = struct.unpack_from(">h", self.data, offset)[0]
+        if count < 0:
+            return self._composite(offset + 10, depth)
+
+        at = offset + 10
+        ends = struct.unpack_from(">%dH" % count, self.data, at)
+        at += 2 * count
+        at += 2 + self._u16(at)  # instructions
+        points = ends[-1] + 1 if count else 0
+
+        flags = []
+        while len(flags) < points:
+            flag = self.data[at]
+            at += 1
+            flags.append(flag)
+            if flag & 8:
+                flags.extend([flag] * self.data[at])
+                at += 1
+
+        def coords(short, same, at):
+            values, value = [], 0
+            for flag in flags:
+                if flag & short:
+                    delta = self.data[at]
+                    at += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack_from(">h", self.data, at)[0]
+                    at += 2
+                values.append(value)
+            return values, at
+
+        xs, at = coords(2, 16, at)
+        ys, at = coords(4, 32, at)
+        result, start = [], 0
+        for end in ends:
+            result.append([(xs[i], ys[i], flags[i] & 1)
+                           for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def _composite(self, at, depth):
+        result = []
+        while True:
+            flags, index = struct.unpack_from(">HH", self.data, at)
+            at += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, at)
+                at += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, at)
+                at += 2
+            if not flags & 2:
+                dx = dy = 0  # point matching is not supported
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from(">h", self.data, at)[0] / 16384
+                at += 2
+            elif flags & 0x40:
+                a, d = (v / 16384 for v in
+                        struct.unpack_from(">hh", self.data, at))
+                at += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384 for v in
+                              struct.unpack_from(">hhhh", self.data, at))
+                at += 8
+            for contour in self.contours(index, depth + 1):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on)
+                               for x, y, on in contour])
+            if not flags & 0x20:
+                return result
+
+
+def flatten(contour, steps=8):
+    """Polygon of the quadratic contour, implied on points are added."""
+    if not contour:
+        return []
+    points = []
+    count = len(contour)
+    for i in range(count):
+        x, y, on = contour[i]
+        nx, ny, non = contour[(i + 1) % count]
+        points.append((x, y, on))
+        if not on and not non:
+            points.append(((x + nx) / 2, (y + ny) / 2, 1))
+    # Start at an on curve point
+    first = next(i for i, p in enumerate(points) if p[2])
+    points = points[first:] + points[:first]
+
+    polygon = [(points[0][0], points[0][1])]
+    i = 1
+    while i <= len(points):
+        x, y, on = points[i % len(points)]
+        if on:
+            polygon.append((x, y))
+            i += 1
+            continue
+        x0, y0 = polygon[-1]
+        x2, y2, _ = points[(i + 1) % len(points)]
+        for s in range(1, steps + 1):
+            t = s / steps
+            polygon.append(((1 - t) ** 2 * x0 + 2 * t * (1 - t) * x +
+                            t * t * x2,
+                            (1 - t) ** 2 * y0 + 2 * t * (1 - t) * y +
+                            t * t * y2))
+        i += 2
+    return polygon
+
+
+def rasterize(polygons, width, height):
+    """Coverage 0..255 of polygons in pixel space, y down, nonzero winding."""
+    cover = [[0.0] * width for _ in range(height)]
+    edges = []
+    for polygon in polygons:
+        for (x0, y0), (x1, y1) in zip(polygon, polygon[1:] + polygon[:1]):
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+
+    for row in range(height * SUBROWS):
+        y = (row + 0.5) / SUBROWS
+        crossings = []
+        for x0, y0, x1, y1 in edges:
+            if (y0 <= y < y1) or (y1 <= y < y0):
+                x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                crossings.append((x, 1 if y1 > y0 else -1))
+        crossings.sort()
+        line = cover[row // SUBROWS]
+        winding = 0
+        for i, (x, direction) in enumerate(crossings[:-1]):
+            winding += direction
+            if winding == 0:
+                continue
+            start = max(x, 0.0)
+            end = min(crossings[i + 1][0], float(width))
+            # Exact horizontal coverage of the span
+            while start < end:
+                pixel = int(start)
+                stop = min(end, pixel + 1.0)
+                line[pixel] += (stop - start) / SUBROWS
+                start = stop
+
+    return [[min(255, int(round(v * 255))) for v in line] for line in cover]
+
+
+def load_ttf(path, size, first, last):
+    font = TrueType(open(path, "rb").read())
+    scale = size / font.units
+    glyphs = {}
+    for code in range(first, last + 1):
+        index = font.cmap.get(code, 0)
+        advance = int(round(font.advance(index) * scale))
+        polygons = [flatten(c) for c in font.contours(index)]
+        polygons = [p for p in polygons if len(p) > 2]
+        if not polygons:
+            glyphs[code] = Glyph(0, 0, 0, 0, advance, [])
+            continue
+        xs = [x * scale for p in polygons for x, _ in p]
+        ys = [y * scale for p in polygons for _, y in p]
+        left, top = math.floor(min(xs)), math.ceil(max(ys))
+        width = math.ceil(max(xs)) - left
+        height = top - math.floor(min(ys))
+        pixels = [[(x * scale - left, top - y * scale) for x, y in p]
+                  for p in polygons]
+        glyphs[code] = Glyph(width, height, left, top, advance,
+                             rasterize(pixels, width, height))
+    # License description repeats the copyright in most fonts
+    notice = font.name(13) or font.name(0)
+    return glyphs, notice
+
+
+# BDF -----------------------------------------------------------------------
+
+
+def load_bdf(path, scale, first, last):
+    glyphs = {}
+    notice = ""
+    lines = iter(open(path, encoding="latin-1").read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "COPYRIGHT":
+            notice = line[len("COPYRIGHT"):].strip().strip('"')
+        if words[0] != "STARTCHAR":
+            continue
+        code, advance, box, rows = None, 0, (0, 0, 0, 0), []
+        for line in lines:
+            words = line.split()
+            if words[0] == "ENCODING":
+                code = int(words[1])
+            elif words[0] == "DWIDTH":
+                advance = int(words[1])
+            elif words[0] == "BBX":
+                box = tuple(int(v) for v in words[1:5])
+            elif words[0] == "BITMAP":
+                for line in lines:
+                    if line.startswith("ENDCHAR"):
+                        break
+                    # Rows are padded to bytes, leftmost pixel is the MSB
+                    digits = line.strip()
+                    rows.append((int(digits or "0", 16), 4 * len(digits)))
+                break
+        if code is None or not first <= code <= last:
+            continue
+
+        width, height, xoff, yoff = box
+        bits = [[(row >> (length - 1 - x)) & 1 if x < length else 0
+                 for x in range(width)] for row, length in rows]
+        glyphs[code] = downsample(bits, width, height, xoff, yoff, advance,
+                                  scale)
+    return glyphs, notice
+
+
+def downsample(bits, width, height, xoff, yoff, advance, scale):
+    """Average scale x scale bits into one alpha pixel."""
+    top = yoff + height
+    # Align the box to the output grid
+    left = math.floor(xoff / scale)
+    up = math.ceil(top / scale)
+    dx = xoff - left * scale
+    dy = up * scale - top
+    out_w = math.ceil((dx + width) / scale)
+    out_h = math.ceil((dy + height) / scale)
+    alpha = []
+    for oy in range(out_h):
+        row = []
+        for ox in range(out_w):
+            total = 0
+            for sy in range(scale):
+                y = oy * scale + sy - dy
+                if not 0 <= y < height:
+                    continue
+                for sx in range(scale):
+                    x = ox * scale + sx - dx
+                    if 0 <= x < width:
+                        total += bits[y][x]
+            row.append(total * 255 // (scale * scale))
+        alpha.append(row)
+    return Glyph(out_w, out_h, left, up, int(round(advance / scale)), alpha)
+
+
+# Layout and output ---------------------------------------------------------
+
+
+def place(code, glyph, advance, height, baseline):
+    """Crop the glyph into its cell, trim empty border, make width even.
+
+    Returns (left, top, width, height, rows of 0..15) in cell coordinates,
+    top is from the top of the line.
+    """
+    if advance is not None:
+        # Fixed advance, the glyph is centered in the cell
+        shift = (advance - glyph.advance) // 2
+    else:
+        advance = glyph.advance
+        shift = 0
+    cell = [[0] * advance for _ in range(height)]
+    for y, row in enumerate(glyph.alpha):
+        cy = baseline - glyph.top + y
+        if not 0 <= cy < height:
+            continue
+        for x, value in enumerate(row):
+            cx = shift + glyph.left + x
+            if 0 <= cx < advance:
+                cell[cy][cx] = max(cell[cy][cx], (value * 15 + 127) // 255)
+
+    used_rows = [y for y in range(height) if any(cell[y])]
+    used_cols = [x for x in range(advance) if any(r[x] for r in cell)]
+    if not used_rows:
+        return 0, 0, 0, 0, [], advance
+    x0, x1 = used_cols[0], used_cols[-1] + 1
+    y0, y1 = used_rows[0], used_rows[-1] + 1
+    if (x1 - x0) % 2:
+        if x1 < advance:
+            x1 += 1
+        elif x0 > 0:
+            x0 -= 1
+        else:
+            # Odd cell filled to both edges, the box cannot be even in it
+            x1 -= 1
+            sys.stderr.write("fontc: '%s' fills its odd cell, the last "
+                             "column is lost\n" % chr(code))
+    rows = [cell[y][x0:x1] for y in range(y0, y1)]
+    return x0, y0, x1 - x0, y1 - y0, rows, advance
+
+
+def write_c(path, name, source, notice, args, placed):
+    table, entries, offset = [], [], 0
+    for code, (left, top, width, height, rows, advance) in placed:
+        entries.append("    {%d, %d, %d, %d, %d, %d}, /* '%s' */" %
+                       (offset, width, height, left, top, advance,
+                        "\\\\" if chr(code) == "\\" else chr(code)))
+        if not rows:
+            continue
+        table.append("    // @%d '%s' (%d x %d)" %
+                     (offset, chr(code), width, height))
+        for row in rows:
+            data = [row[x] | row[x + 1] << 4 for x in range(0, width, 2)]
+            shade = "".join(" .:-=+*#%@"[min(9, v * 10 // 16)] for v in row)
+            table.append("    %s /* |%s| */" %
+                         (" ".join("0x%02X," % b for b in data), shade))
+            offset += len(data)
+        table.append("")
+
+    widest = max(p[5] for _, p in placed)
+    with open(path, "w", encoding="utf-8") as out:
+        out.write("/**\n")
+        out.write(" * This file provides '%s' 4 bpp alpha font, %d px line,\n"
+                  % (name, args.height))
+        out.write(" * compiled by Tools/fontc.py from %s\n" % source)
+        for line in wrap("options: " + " ".join(sys.argv[2:]), 74):
+            out.write(" * %s\n" % line)
+        if notice:
+            out.write(" *\n")
+            for line in wrap(notice, 74):
+                out.write(" * %s\n" % line)
+        out.write(" */\n")
+        out.write('#include "app_font.h"\n\n')
+        out.write("// %d bytes\n" % offset)
+        out.write("static const uint8_t %s_Table[] = {\n" % name)
+        out.write("\n".join(table).rstrip() + "\n};\n\n")
+        out.write("/* offset, width, height, left, top, advance */\n")
+        out.write("static const app_font_glyph_t %s_Glyphs[] = {\n" % name)
+        out.write("\n".join(entries) + "\n};\n\n")
+        out.write("app_font_t %s = {\n" % name)
+        out.write("    {%s_Table, %d, %d}, /* widest advance, line */\n" %
+                  (name, widest, args.height))
+        out.write("    %s_Glyphs,\n" % name)
+        out.write("    0x%02X, /* first */\n" % args.first)
+        out.write("    %d,   /* count */\n" % len(placed))
+        out.write("};\n")
+
+
+def wrap(text, width):
+    lines, line = [], ""
+    for word in text.split():
+        if line and len(line) + 1 + len(word) > width:
+            lines.append(line)
+            line = word
+        else:
+            line = (line + " " + word).strip()
+    if line:
+        lines.append(line)
+    return lines
+
+
+def write_preview(path, text, placed, height):
+    """Gray PGM of the text drawn from the compiled glyphs, golden image."""
+    cells = dict(placed)
+    width = sum(cells[ord(c)][5] for c in text if ord(c) in cells)
+    image = [[0] * width for _ in range(height)]
+    pen = 0
+    for c in text:
+        if ord(c) not in cells:
+            continue
+        left, top, w, h, rows, advance = cells[ord(c)]
+        for y in range(h):
+            for x in range(w):
+                image[top + y][pen + left + x] = rows[y][x] * 17
+        pen += advance
+    with open(path, "wb") as out:
+        out.write(b"P5\n%d %d\n255\n" % (width, height))
+        out.write(bytes(v for row in image for v in row))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="TTF or BDF font")
+    parser.add_argument("-o", "--output", required=True, help="C file")
+    parser.add_argument("--name", required=True, help="app_font_t variable")
+    parser.add_argument("--size", type=float, default=16,
+                        help="TTF em size in pixels")
+    parser.add_argument("--scale", type=int, default=1,
+                        help="BDF pixels averaged into one alpha pixel")
+    parser.add_argument("--height", type=int, required=True,
+                        help="line height in pixels")
+    parser.add_argument("--baseline", type=int, required=True,
+                        help="baseline from the top of the line")
+    parser.add_argument("--advance", type=int,
+                        help="fixed advance, keeps layout of sFONT texts")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=FIRST)
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=LAST)
+    parser.add_argument("--preview", help="PGM image of --text")
+    parser.add_argument("--text", default="~ TOASTER CONTROLLER ~ 0123456789",
+                        help="text of the preview")
+    args = parser.parse_args()
+
+    if args.input.lower().endswith(".bdf"):
+        glyphs, notice = load_bdf(args.input, args.scale, args.first,
+                                  args.last)
+    else:
+        glyphs, notice = load_ttf(args.input, args.size, args.first,
+                                  args.last)
+
+    # Missing characters are drawn as space
+    space = glyphs.get(FIRST)
+    empty = Glyph(0, 0, 0, 0, space.advance if space else 0, [])
+    placed = [(code, place(code, glyphs.get(code, empty), args.advance,
+                           args.height, args.baseline))
+              for code in range(args.first, args.last + 1)]
+    source = args.input.replace("\\", "/").split("/")[-1]
+    write_c(args.output, args.name, source, notice, args, placed)
+    if args.preview:
+        write_preview(args.preview, args.text, placed, args.height)
+
+
+if __name__ == "__main__":
+    main()
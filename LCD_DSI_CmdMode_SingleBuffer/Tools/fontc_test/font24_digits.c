@@ -0,0 +1,133 @@
+/**
+ * This file provides 'FontDigits' 4 bpp alpha font, 12 px line,
+ * compiled by Tools/fontc.py from font24.bdf
+ * options: -o font24_digits.c --name FontDigits --scale 2 --height 12
+ * --baseline 9 --first 0x30 --last 0x39
+ *
+ * Font24 of the STM32 LCD utility
+ */
+#include "app_font.h"
+
+// 240 bytes
+static const uint8_t FontDigits_Table[] = {
+    // @0 '0' (6 x 8)
+    0x40, 0xFF, 0x04, /* | :@@: | */
+    0xF0, 0x00, 0x0F, /* | @  @ | */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0xB4, 0x00, 0x4B, /* |:*  *:| */
+    0xB0, 0x77, 0x0B, /* | *==* | */
+    0x00, 0x77, 0x00, /* |  ==  | */
+
+    // @24 '1' (6 x 8)
+    0x40, 0x77, 0x00, /* | :==  | */
+    0xF7, 0x7B, 0x00, /* |=@*=  | */
+    0x00, 0x77, 0x00, /* |  ==  | */
+    0x00, 0x77, 0x00, /* |  ==  | */
+    0x00, 0x77, 0x00, /* |  ==  | */
+    0x00, 0x77, 0x00, /* |  ==  | */
+    0x74, 0xBB, 0x47, /* |:=**=:| */
+    0x74, 0x77, 0x47, /* |:====:| */
+
+    // @48 '2' (6 x 8)
+    0xB4, 0xFF, 0x07, /* |:*@@= | */
+    0x4F, 0x00, 0x4B, /* |@:  *:| */
+    0x07, 0x00, 0x77, /* |=   ==| */
+    0x00, 0x40, 0x0B, /* |   :* | */
+    0x00, 0xBB, 0x00, /* |  **  | */
+    0xB0, 0x04, 0x00, /* | *:   | */
+    0xBB, 0x77, 0x47, /* |**===:| */
+    0x77, 0x77, 0x47, /* |=====:| */
+
+    // @72 '3' (6 x 8)
+    0x70, 0xFF, 0x04, /* | =@@: | */
+    0x70, 0x40, 0x0F, /* | = :@ | */
+    0x00, 0x40, 0x0B, /* |   :* | */
+    0x00, 0xFF, 0x04, /* |  @@: | */
+    0x00, 0x40, 0x4B, /* |   :*:| */
+    0x00, 0x00, 0x77, /* |    ==| */
+    0xB7, 0x77, 0x4F, /* |=*==@:| */
+    0x70, 0x77, 0x00, /* | ===  | */
+
+    // @96 '4' (6 x 8)
+    0x00, 0xF4, 0x07, /* |  :@= | */
+    0x00, 0xBB, 0x07, /* |  **= | */
+    0x70, 0x77, 0x07, /* | ==== | */
+    0xF0, 0x70, 0x07, /* | @ == | */
+    0x4B, 0x70, 0x07, /* |*: == | */
+    0xFF, 0xFF, 0x7F, /* |@@@@@=| */
+    0x00, 0xB7, 0x4B, /* |  =**:| */
+    0x00, 0x77, 0x47, /* |  ===:| */
+
+    // @120 '5' (6 x 8)
+    0xF7, 0xFF, 0x0F, /* |=@@@@ | */
+    0x77, 0x00, 0x00, /* |==    | */
+    0x77, 0x77, 0x00, /* |====  | */
+    0xF7, 0x77, 0x0F, /* |=@==@ | */
+    0x00, 0x00, 0x77, /* |    ==| */
+    0x00, 0x00, 0x77, /* |    ==| */
+    0x7F, 0x77, 0x0F, /* |@===@ | */
+    0x70, 0x77, 0x00, /* | ===  | */
+
+    // @144 '6' (6 x 8)
+    0x00, 0xF7, 0x7F, /* |  =@@=| */
+    0xB0, 0x0B, 0x00, /* | **   | */
+    0xB4, 0x00, 0x00, /* |:*    | */
+    0xB7, 0xFF, 0x07, /* |=*@@= | */
+    0xB7, 0x00, 0x4B, /* |=*  *:| */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0xF0, 0x77, 0x4F, /* | @==@:| */
+    0x00, 0x77, 0x04, /* |  ==: | */
+
+    // @168 '7' (6 x 8)
+    0xF7, 0xFF, 0x7F, /* |=@@@@=| */
+    0x77, 0x00, 0x7B, /* |==  *=| */
+    0x00, 0x00, 0x0F, /* |    @ | */
+    0x00, 0x70, 0x0B, /* |   =* | */
+    0x00, 0xB0, 0x07, /* |   *= | */
+    0x00, 0xF0, 0x00, /* |   @  | */
+    0x00, 0xB7, 0x00, /* |  =*  | */
+    0x00, 0x44, 0x00, /* |  ::  | */
+
+    // @192 '8' (6 x 8)
+    0xB0, 0xFF, 0x0B, /* | *@@* | */
+    0xB7, 0x00, 0x7B, /* |=*  *=| */
+    0xB4, 0x00, 0x4B, /* |:*  *:| */
+    0x70, 0xFF, 0x07, /* | =@@= | */
+    0xB4, 0x00, 0x4B, /* |:*  *:| */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0xF4, 0x77, 0x4F, /* |:@==@:| */
+    0x40, 0x77, 0x04, /* | :==: | */
+
+    // @216 '9' (6 x 8)
+    0xB0, 0xFF, 0x07, /* | *@@= | */
+    0xB7, 0x00, 0x4B, /* |=*  *:| */
+    0x77, 0x00, 0x77, /* |==  ==| */
+    0xF0, 0x77, 0x7F, /* | @==@=| */
+    0x00, 0x77, 0x77, /* |  ====| */
+    0x00, 0x40, 0x0F, /* |   :@ | */
+    0x74, 0xF7, 0x04, /* |:==@: | */
+    0x74, 0x07, 0x00, /* |:==   | */
+};
+
+/* offset, width, height, left, top, advance */
+static const app_font_glyph_t FontDigits_Glyphs[] = {
+    {0, 6, 8, 1, 1, 8}, /* '0' */
+    {24, 6, 8, 1, 1, 8}, /* '1' */
+    {48, 6, 8, 1, 1, 8}, /* '2' */
+    {72, 6, 8, 1, 1, 8}, /* '3' */
+    {96, 6, 8, 1, 1, 8}, /* '4' */
+    {120, 6, 8, 1, 1, 8}, /* '5' */
+    {144, 6, 8, 1, 1, 8}, /* '6' */
+    {168, 6, 8, 1, 1, 8}, /* '7' */
+    {192, 6, 8, 1, 1, 8}, /* '8' */
+    {216, 6, 8, 1, 1, 8}, /* '9' */
+};
+
+app_font_t FontDigits = {
+    {FontDigits_Table, 8, 12}, /* widest advance, line */
+    FontDigits_Glyphs,
+    0x30, /* first */
+    10,   /* count */
+};
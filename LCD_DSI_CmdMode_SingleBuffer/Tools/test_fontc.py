@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+#
+# test_fontc.py
+#
+#  Created on: 16. 10. 2026
+#      Author: agent
+#
+# Copyright (c) 2026 agent
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+"""Tests of fontc.py, run from anywhere: python3 test_fontc.py [--update]
+
+The 1 bpp Font24 of the LCD utility is written as BDF and compiled back,
+every pixel has to come out in its place at full alpha, but the column
+cut from 'W', which fills its odd cell, with a warning. A TrueType font of
+rectangles, made here, checks the coverage of the rasterizer and composite
+glyphs. The digits of Font24 averaged by --scale 2 are compared with the
+golden file fontc_test/font24_digits.c, --update writes it again after an
+intended change of the output.
+"""
+
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TOOLS = os.path.dirname(os.path.abspath(__file__))
+FONTC = os.path.join(TOOLS, "fontc.py")
+FONT24 = os.path.join(TOOLS, "..", "Utilities", "Fonts", "font24.c")
+GOLDEN = os.path.join(TOOLS, "fontc_test", "font24_digits.c")
+UPDATE = False
+
+FIRST = 0x20
+LAST = 0x7E
+
+
+def font24():
+    """Rows of bits of Font24 cells, 17 x 24, by character."""
+    with open(FONT24, encoding="latin-1") as file:
+        text = file.read()
+    body = text[text.index("Font24_Table"):]
+    body = body[body.index("{") + 1:body.index("};")]
+    data = [int(v, 16) for v in
+            re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"//.*", "", body))]
+    cells = {}
+    for code in range(FIRST, LAST + 1):
+        at = (code - FIRST) * 24 * 3
+        cells[code] = [[(data[at + 3 * y + x // 8] >> (7 - x % 8)) & 1
+                        for x in range(17)] for y in range(24)]
+    return cells
+
+
+def write_bdf(path, cells):
+    """BDF of the cells, baseline 18 pixels from the top as in the table."""
+    with open(path, "w", encoding="latin-1") as out:
+        out.write("STARTFONT 2.1\nFONT Font24\nSIZE 24 75 75\n")
+        out.write("FONTBOUNDINGBOX 17 24 0 -6\n")
+        out.write('COPYRIGHT "Font24 of the STM32 LCD utility"\n')
+        out.write("CHARS %d\n" % len(cells))
+        for code, rows in sorted(cells.items()):
+            out.write("STARTCHAR U+%04X\nENCODING %d\n" % (code, code))
+            out.write("DWIDTH 17 0\nBBX 17 24 0 -6\nBITMAP\n")
+            for row in rows:
+                value = sum(bit << (23 - x) for x, bit in enumerate(row))
+                out.write("%06X\n" % value)
+            out.write("ENDCHAR\n")
+        out.write("ENDFONT\n")
+
+
+def write_ttf(path):
+    """TrueType font of 1000 units per em: '!' is a rectangle, '"' the same
+    rectangle as a composite glyph moved by 100 units."""
+    rect = [(150, 0), (650, 0), (650, 700), (150, 700)]
+    simple = struct.pack(">hhhhhH", 1, 150, 0, 650, 700, 3)
+    simple += struct.pack(">H", 0) + bytes([1] * 4)
+    xs = [x - p for (x, _), p in zip(rect, [0] + [x for x, _ in rect])]
+    ys = [y - p for (_, y), p in zip(rect, [0] + [y for _, y in rect])]
+    simple += struct.pack(">4h", *xs) + struct.pack(">4h", *ys)
+    simple += b"\0" * (-len(simple) % 4)
+    composite = struct.pack(">hhhhhHHhh", -1, 250, 0, 750, 700, 1 | 2, 1,
+                            100, 0)
+    glyf = simple + composite
+    loca = struct.pack(">4I", 0, 0, len(simple), len(glyf))
+
+    head = bytearray(54)
+    struct.pack_into(">H", head, 18, 1000)
+    struct.pack_into(">h", head, 50, 1)
+    hhea = bytearray(36)
+    struct.pack_into(">H", hhea, 34, 3)
+    hmtx = struct.pack(">6H", 500, 0, 800, 150, 900, 250)
+
+    # Format 4, '!' and '"' are glyphs 1 and 2
+    segments = [(0x21, 0x22, (1 - 0x21) & 0xFFFF), (0xFFFF, 0xFFFF, 1)]
+    sub = struct.pack(">7H", 4, 16 + 8 * len(segments), 0, 2 * len(segments),
+                      0, 0, 0)
+    sub += b"".join(struct.pack(">H", end) for _, end, _ in segments)
+    sub += struct.pack(">H", 0)
+    sub += b"".join(struct.pack(">H", start) for start, _, _ in segments)
+    sub += b"".join(struct.pack(">H", delta) for _, _, delta in segments)
+    sub += b"\0\0" * len(segments)
+    cmap = struct.pack(">HHHHI", 0, 1, 3, 1, 12) + sub
+
+    notice = "Rectangles of test_fontc.py".encode("utf-16-be")
+    name = struct.pack(">HHH", 0, 1, 18) + \
+        struct.pack(">6H", 3, 1, 0x409, 13, len(notice), 0) + notice
+
+    tables = [(b"cmap", cmap), (b"glyf", glyf), (b"head", head),
+              (b"hhea", hhea), (b"hmtx", hmtx),
+              (b"loca", loca), (b"name", name)]
+    data = struct.pack(">IHHHH", 0x10000, len(tables), 0, 0, 0)
+    offset = len(data) + 16 * len(tables)
+    directory, body = b"", b""
+    for tag, content in tables:
+        content = bytes(content) + b"\0" * (-len(content) % 4)
+        directory += struct.pack(">4sIII", tag, 0, offset + len(body),
+                                 len(content))
+        body += content
+    with open(path, "wb") as out:
+        out.write(data + directory + body)
+
+
+def read(path, mode="r"):
+    with open(path, mode, encoding=None if "b" in mode else "utf-8") as file:
+        return file.read()
+
+
+def fontc(directory, source, output, *options):
+    """Run the compiler, return the C file and the warnings."""
+    done = subprocess.run([sys.executable, FONTC, source, "-o", output] +
+                          list(options), cwd=directory, check=True,
+                          stderr=subprocess.PIPE, text=True)
+    return read(os.path.join(directory, output)), done.stderr
+
+
+class Compiled:
+    """Glyph table read back from the C file, with checks of its layout."""
+
+    def __init__(self, test, text):
+        body = text[text.index("_Table[] = {"):]
+        body = body[body.index("{") + 1:body.index("};")]
+        body = re.sub(r"//.*|/\*.*?\*/", "", body)
+        data = [int(v, 16) for v in re.findall(r"0x([0-9A-F]{2})", body)]
+        entries = re.findall(r"\{(\d+), (\d+), (\d+), (\d+), (\d+), (\d+)\}",
+                             text)
+        font = re.search(r"\{\w+_Table, (\d+), (\d+)\}.*\n.*\n"
+                         r"\s*0x([0-9A-F]{2}), /\* first \*/\n"
+                         r"\s*(\d+),", text)
+        test.assertIsNotNone(font)
+        self.widest, self.height = int(font.group(1)), int(font.group(2))
+        self.first, count = int(font.group(3), 16), int(font.group(4))
+        test.assertEqual(count, len(entries))
+
+        self.cells = {}
+        offset = 0
+        for i, entry in enumerate(entries):
+            at, width, height, left, top, advance = map(int, entry)
+            # Boxes follow each other, whole bytes, inside the cell
+            test.assertEqual(at, offset)
+            test.assertEqual(width % 2, 0)
+            test.assertLessEqual(left + width, advance)
+            test.assertLessEqual(top + height, self.height)
+            test.assertLessEqual(advance, self.widest)
+            cell = [[0] * advance for _ in range(self.height)]
+            for y in range(height):
+                for x in range(width):
+                    byte = data[at + y * width // 2 + x // 2]
+                    cell[top + y][left + x] = (byte >> (4 * (x % 2))) & 0xF
+            self.cells[self.first + i] = cell
+            offset += width * height // 2
+        test.assertEqual(offset, len(data))
+
+
+class FontcTest(unittest.TestCase):
+
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        self.path = self.directory.name
+        self.cells = font24()
+        write_bdf(os.path.join(self.path, "font24.bdf"), self.cells)
+
+    def tearDown(self):
+        self.directory.cleanup()
+
+    def test_bdf_round_trip(self):
+        text, warnings = fontc(self.path, "font24.bdf", "font24.c", "--name",
+                               "Font", "--height", "24", "--baseline", "18",
+                               "--preview", "preview.pgm", "--text", "Ag~")
+        compiled = Compiled(self, text)
+        self.assertIn("Font24 of the STM32 LCD utility", text)
+        self.assertEqual(compiled.first, FIRST)
+        lost = []
+        for code, rows in self.cells.items():
+            expected = [[15 * bit for bit in row] for row in rows]
+            # Box of a glyph from edge to edge of the odd cell is cut
+            if any(row[0] for row in rows) and any(row[-1] for row in rows):
+                lost.append(code)
+                expected = [row[:-1] + [0] for row in expected]
+            self.assertEqual(compiled.cells[code], expected, "'%c'" % code)
+        self.assertEqual(warnings.splitlines(),
+                         ["fontc: '%c' fills its odd cell, the last column "
+                          "is lost" % code for code in lost])
+
+        # Preview is the text drawn from the compiled cells
+        image = read(os.path.join(self.path, "preview.pgm"), "rb")
+        self.assertTrue(image.startswith(b"P5\n51 24\n255\n"))
+        pixels = image[len(b"P5\n51 24\n255\n"):]
+        for y in range(24):
+            line = [17 * v for c in "Ag~" for v in compiled.cells[ord(c)][y]]
+            self.assertEqual(list(pixels[51 * y:51 * (y + 1)]), line)
+
+    def test_bdf_scale(self):
+        text, _ = fontc(self.path, "font24.bdf", "font12.c", "--name",
+                        "Font", "--scale", "2", "--height", "12",
+                        "--baseline", "9")
+        compiled = Compiled(self, text)
+        for code, rows in self.cells.items():
+            cell = compiled.cells[code]
+            # Advance 8.5 is rounded to even, the 17th column is cropped
+            self.assertEqual(len(cell[0]), 8)
+            for y in range(12):
+                for x in range(8):
+                    total = sum(rows[2 * y + sy][2 * x + sx]
+                                for sy in range(2) for sx in range(2))
+                    self.assertEqual(cell[y][x],
+                                     (total * 255 // 4 * 15 + 127) // 255,
+                                     "'%c' %d, %d" % (code, x, y))
+
+    def test_ttf_coverage(self):
+        write_ttf(os.path.join(self.path, "rect.ttf"))
+        text, _ = fontc(self.path, "rect.ttf", "rect.c", "--name", "Rect",
+                        "--size", "10", "--height", "10", "--baseline", "8",
+                        "--first", "0x20", "--last", "0x23")
+        compiled = Compiled(self, text)
+        self.assertIn("Rectangles of test_fontc.py", text)
+        # 1.5 to 6.5 pixels wide, 7 high on the baseline, edges half covered
+        row = [0, 8, 15, 15, 15, 15, 8, 0]
+        expected = [[0] * 8] + [row] * 7 + [[0] * 8] * 2
+        self.assertEqual(compiled.cells[0x21], expected)
+        # Moved by one pixel, the advance of the composite glyph is its own
+        self.assertEqual(compiled.cells[0x22],
+                         [[0] + r for r in expected])
+        self.assertEqual(compiled.cells[0x20], [[0] * 5] * 10)
+        # Missing character is drawn as space
+        self.assertEqual(compiled.cells[0x23], compiled.cells[0x20])
+
+    def test_golden(self):
+        text, _ = fontc(self.path, "font24.bdf", "font24_digits.c",
+                        "--name", "FontDigits", "--scale", "2", "--height",
+                        "12", "--baseline", "9", "--first", "0x30", "--last",
+                        "0x39")
+        if UPDATE:
+            with open(GOLDEN, "w", encoding="utf-8") as out:
+                out.write(text)
+        self.assertEqual(text, read(GOLDEN))
+
+
+if __name__ == "__main__":
+    if "--update" in sys.argv:
+        sys.argv.remove("--update")
+        UPDATE = True
+    unittest.main()
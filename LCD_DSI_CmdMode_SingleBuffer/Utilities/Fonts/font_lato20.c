@@ -0,0 +1,1522 @@
+/**
+ * This file provides 'FontLato20' 4 bpp alpha font, 20 px line,
+ * compiled by Tools/fontc.py from Lato-Regular.ttf
+ * options: --name FontLato20 --size 19 --height 20 --baseline 16 --advance
+ * 17 -o ../Utilities/Fonts/font_lato20.c
+ *
+ * Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic
+ * (http://www.typoland.com/) with Reserved Font Name "Lato". Licensed under
+ * the SIL Open Font License, Version 1.1 (http://scripts.sil.org/OFL).
+ */
+#include "app_font.h"
+
+// 5920 bytes
+static const uint8_t FontLato20_Table[] = {
+    // @0 '!' (4 x 15)
+    0x95, 0x01, /* |-+  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF8, 0x01, /* |+@  | */
+    0xF7, 0x00, /* |=@  | */
+    0xE6, 0x00, /* |-%  | */
+    0x31, 0x00, /* | .  | */
+    0x00, 0x00, /* |    | */
+    0x31, 0x00, /* | .  | */
+    0xFC, 0x05, /* |#@- | */
+    0xFB, 0x04, /* |*@: | */
+    0x10, 0x00, /* |    | */
+
+    // @30 '"' (6 x 6)
+    0x95, 0x40, 0x19, /* |-+ :+ | */
+    0xE8, 0x60, 0x1F, /* |+% -@ | */
+    0xE8, 0x60, 0x1F, /* |+% -@ | */
+    0xD8, 0x50, 0x1F, /* |+% -@ | */
+    0xC6, 0x40, 0x0E, /* |-# :% | */
+    0x21, 0x00, 0x02, /* | .  . | */
+
+    // @48 '#' (12 x 14)
+    0x00, 0x00, 0x47, 0x20, 0x19, 0x00, /* |    =: .+   | */
+    0x00, 0x10, 0x5F, 0x50, 0x1F, 0x00, /* |    @- -@   | */
+    0x00, 0x40, 0x2F, 0x80, 0x0D, 0x00, /* |   :@. +%   | */
+    0x00, 0x70, 0x0E, 0xB0, 0x0A, 0x00, /* |   =%  **   | */
+    0x70, 0xD9, 0x9E, 0xE9, 0x9C, 0x04, /* | =+%%++%#+: | */
+    0x90, 0xE9, 0x9C, 0xFA, 0x9B, 0x03, /* | ++%#+*@*+. | */
+    0x00, 0xF0, 0x06, 0xF4, 0x02, 0x00, /* |   @- :@.   | */
+    0x00, 0xF3, 0x03, 0xE7, 0x00, 0x00, /* |  .@. =%    | */
+    0x42, 0xF8, 0x44, 0xCB, 0x34, 0x00, /* |.:+@::*#:.  | */
+    0xF6, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, /* |-@@@@@@@@#  | */
+    0x00, 0xAB, 0x00, 0x6F, 0x00, 0x00, /* |  **  @-    | */
+    0x00, 0x7E, 0x30, 0x3F, 0x00, 0x00, /* |  %= .@.    | */
+    0x20, 0x4F, 0x60, 0x0F, 0x00, 0x00, /* | .@: -@     | */
+    0x50, 0x1E, 0x80, 0x0C, 0x00, 0x00, /* | -%  +#     | */
+
+    // @132 '$' (10 x 19)
+    0x00, 0x00, 0x71, 0x00, 0x00, /* |     =    | */
+    0x00, 0x00, 0xC4, 0x00, 0x00, /* |    :#    | */
+    0x00, 0x82, 0xEC, 0x28, 0x00, /* |  .+#%+.  | */
+    0x50, 0xEF, 0xED, 0xFE, 0x06, /* | -@%%%%@- | */
+    0xE1, 0x1B, 0x97, 0x71, 0x04, /* | %* =+ =: | */
+    0xF5, 0x04, 0x88, 0x00, 0x00, /* |-@: ++    | */
+    0xF6, 0x05, 0x79, 0x00, 0x00, /* |-@- +=    | */
+    0xF2, 0x5E, 0x6A, 0x00, 0x00, /* |.@%-*-    | */
+    0x50, 0xFE, 0xBF, 0x04, 0x00, /* | -%@@*:   | */
+    0x00, 0x61, 0xFE, 0xCF, 0x02, /* |   -%@@#. | */
+    0x00, 0x00, 0x4D, 0xF8, 0x0B, /* |    %:+@* | */
+    0x00, 0x00, 0x2E, 0xA0, 0x1F, /* |    %. *@ | */
+    0x00, 0x00, 0x1F, 0x90, 0x0F, /* |    @  +@ | */
+    0x55, 0x10, 0x0F, 0xD1, 0x0B, /* |--  @  %* | */
+    0xFB, 0x7B, 0x6E, 0xFD, 0x03, /* |*@*=%-%@. | */
+    0x70, 0xFD, 0xFF, 0x3B, 0x00, /* | =%@@@*.  | */
+    0x00, 0x50, 0x1C, 0x00, 0x00, /* |   -#     | */
+    0x00, 0x50, 0x0B, 0x00, 0x00, /* |   -*     | */
+    0x00, 0x20, 0x02, 0x00, 0x00, /* |   ..     | */
+
+    // @227 '%' (16 x 15)
+    0x10, 0xB7, 0x39, 0x00, 0x00, 0x40, 0x19, 0x00, /* |  =*+.     :+   | */
+    0xB0, 0x6C, 0xE9, 0x02, 0x00, 0xE2, 0x07, 0x00, /* | *#-+%.   .%=   | */
+    0xF2, 0x03, 0xC0, 0x08, 0x00, 0xBC, 0x00, 0x00, /* |.@.  #+   #*    | */
+    0xF5, 0x00, 0x90, 0x0B, 0x90, 0x1E, 0x00, 0x00, /* |-@   +*  +%     | */
+    0xF4, 0x02, 0xA0, 0x09, 0xF5, 0x04, 0x00, 0x00, /* |:@.  *+ -@:     | */
+    0xD0, 0x19, 0xF4, 0x24, 0x8E, 0x00, 0x00, 0x00, /* | %+ :@:.%+      | */
+    0x30, 0xFC, 0x6E, 0xC0, 0x0B, 0x00, 0x00, 0x00, /* | .#@%- #*       | */
+    0x00, 0x10, 0x00, 0xE9, 0x22, 0x98, 0x05, 0x00, /* |      +%..++-   | */
+    0x00, 0x00, 0x50, 0x4F, 0xE2, 0x8A, 0x8E, 0x00, /* |     -@:.%*+%+  | */
+    0x00, 0x00, 0xE2, 0x08, 0xC9, 0x00, 0xF5, 0x01, /* |    .%+ +#  -@  | */
+    0x00, 0x00, 0xBC, 0x00, 0x8B, 0x00, 0xF1, 0x03, /* |    #*  *+   @. | */
+    0x00, 0x80, 0x2E, 0x00, 0x9B, 0x00, 0xF2, 0x03, /* |   +%.  *+  .@. | */
+    0x00, 0xF5, 0x04, 0x00, 0xE6, 0x02, 0xD9, 0x00, /* |  -@:   -%. +%  | */
+    0x20, 0x8E, 0x00, 0x00, 0x90, 0xFF, 0x3D, 0x00, /* | .%+     +@@%.  | */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, /* |           .    | */
+
+    // @347 '&' (14 x 15)
+    0x00, 0x00, 0xA6, 0x8B, 0x02, 0x00, 0x00, /* |    -**+.     | */
+    0x00, 0xA0, 0xAF, 0xE9, 0x2E, 0x00, 0x00, /* |   *@*+%%.    | */
+    0x00, 0xF3, 0x08, 0x20, 0x9E, 0x00, 0x00, /* |  .@+  .%+    | */
+    0x00, 0xF6, 0x03, 0x00, 0x24, 0x00, 0x00, /* |  -@.   :.    | */
+    0x00, 0xF4, 0x06, 0x00, 0x00, 0x00, 0x00, /* |  :@-         | */
+    0x00, 0xD0, 0x1D, 0x00, 0x00, 0x00, 0x00, /* |   %%         | */
+    0x00, 0x90, 0xCF, 0x01, 0x00, 0x00, 0x00, /* |   +@#        | */
+    0x10, 0xEC, 0xF7, 0x1C, 0x00, 0xBA, 0x00, /* |  #%=@#   **  | */
+    0xA0, 0x2E, 0x50, 0xCF, 0x01, 0x9D, 0x00, /* | *%. -@#  %+  | */
+    0xF2, 0x09, 0x00, 0xF5, 0x4C, 0x4F, 0x00, /* |.@+   -@#:@:  | */
+    0xF3, 0x08, 0x00, 0x50, 0xFF, 0x0C, 0x00, /* |.@+    -@@#   | */
+    0xF1, 0x0C, 0x00, 0x00, 0xFB, 0x1C, 0x00, /* | @#     *@#   | */
+    0x80, 0xBF, 0x45, 0xD6, 0x8E, 0xCF, 0x01, /* | +@*-:-%%+@#  | */
+    0x00, 0xE7, 0xFF, 0x9E, 0x02, 0xE5, 0x1B, /* |  =%@@%+. -%* | */
+    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, /* |    ..        | */
+
+    // @452 ''' (2 x 6)
+    0x95, /* |-+| */
+    0xE8, /* |+%| */
+    0xE8, /* |+%| */
+    0xD8, /* |+%| */
+    0xC6, /* |-#| */
+    0x21, /* | .| */
+
+    // @458 '(' (4 x 18)
+    0x00, 0x54, /* |  :-| */
+    0x00, 0xBD, /* |  %*| */
+    0x50, 0x3F, /* | -@.| */
+    0xC0, 0x0C, /* | ## | */
+    0xF2, 0x07, /* |.@= | */
+    0xF5, 0x02, /* |-@. | */
+    0xE8, 0x00, /* |+%  | */
+    0xCA, 0x00, /* |*#  | */
+    0xBB, 0x00, /* |**  | */
+    0xBB, 0x00, /* |**  | */
+    0xCA, 0x00, /* |*#  | */
+    0xE8, 0x00, /* |+%  | */
+    0xF6, 0x02, /* |-@. | */
+    0xF2, 0x06, /* |.@- | */
+    0xC0, 0x0C, /* | ## | */
+    0x60, 0x3F, /* | -@.| */
+    0x00, 0xAD, /* |  %*| */
+    0x00, 0x64, /* |  :-| */
+
+    // @494 ')' (6 x 18)
+    0x81, 0x00, 0x00, /* | +    | */
+    0xF2, 0x06, 0x00, /* |.@-   | */
+    0xA0, 0x0D, 0x00, /* | *%   | */
+    0x30, 0x5F, 0x00, /* | .@-  | */
+    0x00, 0xAD, 0x00, /* |  %*  | */
+    0x00, 0xE9, 0x00, /* |  +%  | */
+    0x00, 0xF6, 0x02, /* |  -@. | */
+    0x00, 0xF4, 0x04, /* |  :@: | */
+    0x00, 0xF3, 0x04, /* |  .@: | */
+    0x00, 0xF3, 0x04, /* |  .@: | */
+    0x00, 0xF4, 0x04, /* |  :@: | */
+    0x00, 0xF6, 0x02, /* |  -@. | */
+    0x00, 0xE9, 0x00, /* |  +%  | */
+    0x00, 0xAD, 0x00, /* |  %*  | */
+    0x30, 0x5F, 0x00, /* | .@-  | */
+    0x90, 0x1E, 0x00, /* | +%   | */
+    0xF2, 0x07, 0x00, /* |.@=   | */
+    0x81, 0x00, 0x00, /* | +    | */
+
+    // @548 '*' (6 x 7)
+    0x00, 0x13, 0x00, /* |  .   | */
+    0x00, 0x3A, 0x00, /* |  *.  | */
+    0x7C, 0x5A, 0x6B, /* |#=*-*-| */
+    0x80, 0xDF, 0x03, /* | +@%. | */
+    0xD6, 0xBC, 0x2B, /* |-%#**.| */
+    0x16, 0x3A, 0x43, /* |- *..:| */
+    0x00, 0x28, 0x00, /* |  +.  | */
+
+    // @569 '+' (12 x 11)
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, /* |            | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, /* | @@@@@@@@@  | */
+    0x40, 0x44, 0xF6, 0x46, 0x44, 0x00, /* | :::-@-:::  | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, /* |    .@.     | */
+    0x00, 0x00, 0x61, 0x01, 0x00, 0x00, /* |     -      | */
+
+    // @635 ',' (4 x 6)
+    0x20, 0x02, /* | .. | */
+    0xE1, 0x1E, /* | %% | */
+    0xC0, 0x2F, /* | #@.| */
+    0x10, 0x0D, /* |  % | */
+    0xA0, 0x05, /* | *- | */
+    0x50, 0x00, /* | -  | */
+
+    // @647 '-' (6 x 2)
+    0x70, 0x77, 0x47, /* | ====:| */
+    0xF1, 0xFF, 0xAF, /* | @@@@*| */
+
+    // @653 '.' (4 x 4)
+    0x20, 0x02, /* | .. | */
+    0xE1, 0x2F, /* | %@.| */
+    0xE1, 0x1E, /* | %% | */
+    0x10, 0x01, /* |    | */
+
+    // @661 '/' (8 x 15)
+    0x00, 0x00, 0x40, 0x1E, /* |     :% | */
+    0x00, 0x00, 0xB0, 0x09, /* |     *+ | */
+    0x00, 0x00, 0xF2, 0x03, /* |    .@. | */
+    0x00, 0x00, 0xC8, 0x00, /* |    +#  | */
+    0x00, 0x00, 0x6E, 0x00, /* |    %-  | */
+    0x00, 0x50, 0x1E, 0x00, /* |   -%   | */
+    0x00, 0xB0, 0x09, 0x00, /* |   *+   | */
+    0x00, 0xF2, 0x03, 0x00, /* |  .@.   | */
+    0x00, 0xC8, 0x00, 0x00, /* |  +#    | */
+    0x10, 0x6E, 0x00, 0x00, /* |  %-    | */
+    0x50, 0x1E, 0x00, 0x00, /* | -%     | */
+    0xC0, 0x09, 0x00, 0x00, /* | #+     | */
+    0xF3, 0x03, 0x00, 0x00, /* |.@.     | */
+    0xC9, 0x00, 0x00, 0x00, /* |+#      | */
+    0x5C, 0x00, 0x00, 0x00, /* |#-      | */
+
+    // @721 '0' (12 x 15)
+    0x00, 0x50, 0xBA, 0x5A, 0x00, 0x00, /* |   -***-    | */
+    0x00, 0xF9, 0xAD, 0xFD, 0x09, 0x00, /* |  +@%*%@+   | */
+    0x60, 0x9F, 0x00, 0x90, 0x6F, 0x00, /* | -@+   +@-  | */
+    0xD0, 0x1E, 0x00, 0x00, 0xDE, 0x00, /* | %%     %%  | */
+    0xF2, 0x09, 0x00, 0x00, 0xF9, 0x02, /* |.@+     +@. | */
+    0xF5, 0x06, 0x00, 0x00, 0xF6, 0x05, /* |-@-     -@- | */
+    0xF6, 0x05, 0x00, 0x00, 0xF5, 0x06, /* |-@-     -@- | */
+    0xF6, 0x05, 0x00, 0x00, 0xF5, 0x07, /* |-@-     -@= | */
+    0xF6, 0x06, 0x00, 0x00, 0xF5, 0x06, /* |-@-     -@- | */
+    0xF3, 0x08, 0x00, 0x00, 0xF8, 0x04, /* |.@+     +@: | */
+    0xE0, 0x0C, 0x00, 0x00, 0xEC, 0x01, /* | %#     #%  | */
+    0x90, 0x4F, 0x00, 0x40, 0x9F, 0x00, /* | +@:   :@+  | */
+    0x10, 0xED, 0x57, 0xE7, 0x1D, 0x00, /* |  %%=-=%%   | */
+    0x00, 0xA2, 0xFF, 0xAF, 0x02, 0x00, /* |  .*@@@*.   | */
+    0x00, 0x00, 0x21, 0x01, 0x00, 0x00, /* |     .      | */
+
+    // @811 '1' (8 x 14)
+    0x00, 0x40, 0x39, 0x00, /* |   :+.  | */
+    0x00, 0xF6, 0x5F, 0x00, /* |  -@@-  | */
+    0x80, 0xEF, 0x5F, 0x00, /* | +@%@-  | */
+    0xFA, 0x59, 0x5F, 0x00, /* |*@+-@-  | */
+    0x78, 0x50, 0x5F, 0x00, /* |+= -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x00, 0x50, 0x5F, 0x00, /* |   -@-  | */
+    0x51, 0x85, 0x8F, 0x55, /* | --+@+--| */
+    0xF4, 0xFF, 0xFF, 0xFF, /* |:@@@@@@@| */
+
+    // @867 '2' (10 x 14)
+    0x00, 0x94, 0xBB, 0x16, 0x00, /* |  :+**-   | */
+    0x80, 0xDF, 0xCA, 0xCF, 0x01, /* | +@%*#@#  | */
+    0xF4, 0x0A, 0x00, 0xF7, 0x07, /* |:@*   =@= | */
+    0xF9, 0x01, 0x00, 0xF0, 0x0B, /* |+@     @* | */
+    0x31, 0x00, 0x00, 0xE0, 0x0B, /* | .     %* | */
+    0x00, 0x00, 0x00, 0xF3, 0x08, /* |      .@+ | */
+    0x00, 0x00, 0x00, 0xEB, 0x02, /* |      *%. | */
+    0x00, 0x00, 0x90, 0x5F, 0x00, /* |     +@-  | */
+    0x00, 0x00, 0xF8, 0x06, 0x00, /* |    +@-   | */
+    0x00, 0x80, 0x7F, 0x00, 0x00, /* |   +@=    | */
+    0x00, 0xF8, 0x07, 0x00, 0x00, /* |  +@=     | */
+    0x80, 0x7F, 0x00, 0x00, 0x00, /* | +@=      | */
+    0xF8, 0x9D, 0x99, 0x99, 0x09, /* |+@%++++++ | */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, /* |@@@@@@@@@ | */
+
+    // @937 '3' (10 x 15)
+    0x00, 0x93, 0xBB, 0x18, 0x00, /* |  .+**+   | */
+    0x50, 0xEF, 0xCB, 0xEF, 0x02, /* | -@%*#@%. | */
+    0xE2, 0x1C, 0x00, 0xF5, 0x0A, /* |.%#   -@* | */
+    0xF7, 0x04, 0x00, 0xD0, 0x0D, /* |=@:    %% | */
+    0x31, 0x00, 0x00, 0xD0, 0x0C, /* | .     %# | */
+    0x00, 0x00, 0x00, 0xF5, 0x06, /* |      -@- | */
+    0x00, 0x00, 0xC9, 0x6E, 0x00, /* |    +#%-  | */
+    0x00, 0x00, 0xCA, 0xBF, 0x02, /* |    *#@*. | */
+    0x00, 0x00, 0x00, 0xE3, 0x0C, /* |      .%# | */
+    0x00, 0x00, 0x00, 0x90, 0x2F, /* |       +@.| */
+    0x88, 0x00, 0x00, 0x90, 0x2F, /* |++     +@.| */
+    0xF9, 0x04, 0x00, 0xE1, 0x0E, /* |+@:    %% | */
+    0xE2, 0x7E, 0x65, 0xFD, 0x05, /* |.%%=--%@- | */
+    0x30, 0xFB, 0xFF, 0x5C, 0x00, /* | .*@@@#-  | */
+    0x00, 0x10, 0x12, 0x00, 0x00, /* |    .     | */
+
+    // @1012 '4' (12 x 14)
+    0x00, 0x00, 0x00, 0x92, 0x05, 0x00, /* |      .+-   | */
+    0x00, 0x00, 0x00, 0xFC, 0x09, 0x00, /* |      #@+   | */
+    0x00, 0x00, 0x90, 0xEE, 0x09, 0x00, /* |     +%%+   | */
+    0x00, 0x00, 0xF5, 0xE5, 0x09, 0x00, /* |    -@-%+   | */
+    0x00, 0x20, 0x9E, 0xE0, 0x09, 0x00, /* |   .%+ %+   | */
+    0x00, 0xC1, 0x0C, 0xE0, 0x09, 0x00, /* |   ##  %+   | */
+    0x00, 0xE9, 0x02, 0xE0, 0x09, 0x00, /* |  +%.  %+   | */
+    0x50, 0x6F, 0x00, 0xE0, 0x09, 0x00, /* | -@-   %+   | */
+    0xE2, 0x0A, 0x00, 0xE0, 0x09, 0x00, /* |.%*    %+   | */
+    0xF8, 0xEE, 0xEE, 0xFE, 0xEF, 0x09, /* |+@%%%%%@@%+ | */
+    0x72, 0x77, 0x77, 0xE7, 0x7B, 0x04, /* |.======%*=: | */
+    0x00, 0x00, 0x00, 0xE0, 0x09, 0x00, /* |       %+   | */
+    0x00, 0x00, 0x00, 0xE0, 0x09, 0x00, /* |       %+   | */
+    0x00, 0x00, 0x00, 0xE0, 0x09, 0x00, /* |       %+   | */
+
+    // @1096 '5' (10 x 15)
+    0x20, 0x99, 0x99, 0x99, 0x03, /* | .++++++. | */
+    0x50, 0xEF, 0xEE, 0xEE, 0x03, /* | -@%%%%%. | */
+    0x80, 0x0E, 0x00, 0x00, 0x00, /* | +%       | */
+    0xA0, 0x0B, 0x00, 0x00, 0x00, /* | **       | */
+    0xD0, 0x09, 0x00, 0x00, 0x00, /* | %+       | */
+    0xF1, 0xAB, 0x9A, 0x04, 0x00, /* | @***+:   | */
+    0xE2, 0xBD, 0xEB, 0x9F, 0x00, /* |.%%**%@+  | */
+    0x00, 0x00, 0x10, 0xFB, 0x04, /* |      *@: | */
+    0x00, 0x00, 0x00, 0xF2, 0x09, /* |      .@+ | */
+    0x00, 0x00, 0x00, 0xF0, 0x0B, /* |       @* | */
+    0x00, 0x00, 0x00, 0xF2, 0x09, /* |      .@+ | */
+    0x11, 0x00, 0x00, 0xF9, 0x04, /* |      +@: | */
+    0xEB, 0x58, 0xB5, 0x9F, 0x00, /* |*%+--*@+  | */
+    0xA2, 0xFE, 0xDF, 0x07, 0x00, /* |.*%@@%=   | */
+    0x00, 0x20, 0x02, 0x00, 0x00, /* |   ..     | */
+
+    // @1171 '6' (10 x 15)
+    0x00, 0x00, 0x70, 0x39, 0x00, /* |     =+.  | */
+    0x00, 0x00, 0xF6, 0x0A, 0x00, /* |    -@*   | */
+    0x00, 0x30, 0xCE, 0x01, 0x00, /* |   .%#    | */
+    0x00, 0xC1, 0x2E, 0x00, 0x00, /* |   #%.    | */
+    0x00, 0xF9, 0x05, 0x00, 0x00, /* |  +@-     | */
+    0x50, 0x8F, 0x54, 0x02, 0x00, /* | -@+:-.   | */
+    0xE1, 0xEF, 0xFE, 0xAF, 0x01, /* | %@%%@@*  | */
+    0xF8, 0x2B, 0x10, 0xF9, 0x09, /* |+@*.  +@+ | */
+    0xED, 0x01, 0x00, 0xC0, 0x1F, /* |%%     #@ | */
+    0xAE, 0x00, 0x00, 0x80, 0x3F, /* |%*     +@.| */
+    0xBD, 0x00, 0x00, 0x90, 0x2F, /* |%*     +@.| */
+    0xF9, 0x02, 0x00, 0xE1, 0x0C, /* |+@.    %# | */
+    0xE2, 0x6D, 0x64, 0xFD, 0x04, /* |.%%-:-%@: | */
+    0x30, 0xFB, 0xFF, 0x3C, 0x00, /* | .*@@@#.  | */
+    0x00, 0x10, 0x12, 0x00, 0x00, /* |    .     | */
+
+    // @1246 '7' (10 x 14)
+    0x99, 0x99, 0x99, 0x99, 0x39, /* |+++++++++.| */
+    0xED, 0xEE, 0xEE, 0xEE, 0x4F, /* |%%%%%%%%@:| */
+    0x00, 0x00, 0x00, 0xC0, 0x0D, /* |       #% | */
+    0x00, 0x00, 0x00, 0xF5, 0x05, /* |      -@- | */
+    0x00, 0x00, 0x00, 0xDD, 0x00, /* |      %%  | */
+    0x00, 0x00, 0x50, 0x5F, 0x00, /* |     -@-  | */
+    0x00, 0x00, 0xD0, 0x0D, 0x00, /* |     %%   | */
+    0x00, 0x00, 0xF6, 0x06, 0x00, /* |    -@-   | */
+    0x00, 0x00, 0xDD, 0x00, 0x00, /* |    %%    | */
+    0x00, 0x60, 0x6F, 0x00, 0x00, /* |   -@-    | */
+    0x00, 0xD0, 0x0D, 0x00, 0x00, /* |   %%     | */
+    0x00, 0xF6, 0x06, 0x00, 0x00, /* |  -@-     | */
+    0x00, 0xDD, 0x00, 0x00, 0x00, /* |  %%      | */
+    0x70, 0x5F, 0x00, 0x00, 0x00, /* | =@-      | */
+
+    // @1316 '8' (12 x 15)
+    0x00, 0x50, 0xBA, 0x5A, 0x00, 0x00, /* |   -***-    | */
+    0x00, 0xFA, 0x8B, 0xFB, 0x0A, 0x00, /* |  *@*+*@*   | */
+    0x50, 0x7F, 0x00, 0x70, 0x5F, 0x00, /* | -@=   =@-  | */
+    0x90, 0x1F, 0x00, 0x10, 0x9F, 0x00, /* | +@     @+  | */
+    0x80, 0x2F, 0x00, 0x20, 0x8F, 0x00, /* | +@.   .@+  | */
+    0x30, 0x9F, 0x00, 0x90, 0x3F, 0x00, /* | .@+   +@.  | */
+    0x00, 0xD5, 0xBD, 0xDD, 0x05, 0x00, /* |  -%%*%%-   | */
+    0x10, 0xFA, 0x9C, 0xFC, 0x1A, 0x00, /* |  *@#+#@*   | */
+    0xA0, 0x4F, 0x00, 0x40, 0xAF, 0x00, /* | *@:   :@*  | */
+    0xF0, 0x0B, 0x00, 0x00, 0xFB, 0x00, /* | @*     *@  | */
+    0xF1, 0x0A, 0x00, 0x00, 0xFA, 0x01, /* | @*     *@  | */
+    0xD0, 0x1E, 0x00, 0x10, 0xDE, 0x00, /* | %%     %%  | */
+    0x60, 0xCF, 0x35, 0xC5, 0x5F, 0x00, /* | -@#-.-#@-  | */
+    0x00, 0xC5, 0xFF, 0xCF, 0x05, 0x00, /* |  -#@@@#-   | */
+    0x00, 0x00, 0x21, 0x01, 0x00, 0x00, /* |     .      | */
+
+    // @1406 '9' (10 x 14)
+    0x00, 0x82, 0xBB, 0x17, 0x00, /* |  .+**=   | */
+    0x50, 0xEF, 0xBA, 0xEF, 0x02, /* | -@%**@%. | */
+    0xE2, 0x1C, 0x00, 0xE3, 0x0C, /* |.%#   .%# | */
+    0xF7, 0x04, 0x00, 0x80, 0x2F, /* |=@:    +@.| */
+    0xF9, 0x02, 0x00, 0x60, 0x3F, /* |+@.    -@.| */
+    0xF7, 0x04, 0x00, 0x90, 0x3F, /* |=@:    +@.| */
+    0xF2, 0x2D, 0x00, 0xF6, 0x0E, /* |.@%.  -@% | */
+    0x50, 0xFE, 0xEE, 0xFE, 0x07, /* | -%@%%%@= | */
+    0x00, 0x51, 0x46, 0xDD, 0x00, /* |   --:%%  | */
+    0x00, 0x00, 0xA0, 0x3F, 0x00, /* |     *@.  | */
+    0x00, 0x00, 0xF6, 0x07, 0x00, /* |    -@=   | */
+    0x00, 0x30, 0xCF, 0x00, 0x00, /* |   .@#    | */
+    0x00, 0xD1, 0x2E, 0x00, 0x00, /* |   %%.    | */
+    0x00, 0xFB, 0x06, 0x00, 0x00, /* |  *@-     | */
+
+    // @1476 ':' (4 x 11)
+    0x51, 0x00, /* | -  | */
+    0xFB, 0x07, /* |*@= | */
+    0xF8, 0x05, /* |+@- | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x30, 0x00, /* | .  | */
+    0xFA, 0x07, /* |*@= | */
+    0xF9, 0x06, /* |+@- | */
+    0x20, 0x00, /* | .  | */
+
+    // @1498 ';' (4 x 13)
+    0x51, 0x00, /* | -  | */
+    0xFB, 0x07, /* |*@= | */
+    0xF8, 0x05, /* |+@- | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x00, 0x00, /* |    | */
+    0x31, 0x00, /* | .  | */
+    0xF9, 0x06, /* |+@- | */
+    0xF7, 0x08, /* |=@+ | */
+    0xA0, 0x04, /* | *: | */
+    0xB4, 0x00, /* |:*  | */
+    0x14, 0x00, /* |:   | */
+
+    // @1524 '<' (8 x 9)
+    0x00, 0x00, 0x00, 0x40, /* |       :| */
+    0x00, 0x00, 0x60, 0xBD, /* |     -%*| */
+    0x00, 0x50, 0xFD, 0x29, /* |   -%@+.| */
+    0x50, 0xFC, 0x29, 0x00, /* | -#@+.  | */
+    0xF8, 0x3D, 0x00, 0x00, /* |+@%.    | */
+    0x81, 0xDE, 0x06, 0x00, /* | +%%-   | */
+    0x00, 0x81, 0xDF, 0x06, /* |   +@%- | */
+    0x00, 0x00, 0x92, 0xAF, /* |    .+@*| */
+    0x00, 0x00, 0x00, 0x72, /* |      .=| */
+
+    // @1560 '=' (10 x 5)
+    0x95, 0x99, 0x99, 0x99, 0x05, /* |-+++++++- | */
+    0x95, 0x99, 0x99, 0x99, 0x05, /* |-+++++++- | */
+    0x00, 0x00, 0x00, 0x00, 0x00, /* |          | */
+    0x74, 0x77, 0x77, 0x77, 0x04, /* |:=======: | */
+    0xC7, 0xCC, 0xCC, 0xCC, 0x07, /* |=#######= | */
+
+    // @1585 '>' (8 x 9)
+    0x04, 0x00, 0x00, 0x00, /* |:       | */
+    0xDB, 0x06, 0x00, 0x00, /* |*%-     | */
+    0x92, 0xDF, 0x05, 0x00, /* |.+@%-   | */
+    0x00, 0x92, 0xCF, 0x05, /* |  .+@#- | */
+    0x00, 0x00, 0xD2, 0x8F, /* |    .%@+| */
+    0x00, 0x60, 0xED, 0x18, /* |   -%%+ | */
+    0x60, 0xFD, 0x19, 0x00, /* | -%@+   | */
+    0xFA, 0x29, 0x00, 0x00, /* |*@+.    | */
+    0x26, 0x00, 0x00, 0x00, /* |-.      | */
+
+    // @1621 '?' (8 x 15)
+    0x30, 0xB9, 0x6A, 0x00, /* | .+**-  | */
+    0xF6, 0x9C, 0xFC, 0x09, /* |-@#+#@+ | */
+    0x52, 0x00, 0xA0, 0x2F, /* |.-   *@.| */
+    0x00, 0x00, 0x60, 0x3F, /* |     -@.| */
+    0x00, 0x00, 0xA0, 0x1E, /* |     *% | */
+    0x00, 0x00, 0xF8, 0x06, /* |    +@- | */
+    0x00, 0xB0, 0x5E, 0x00, /* |   *%-  | */
+    0x00, 0xF4, 0x05, 0x00, /* |  :@-   | */
+    0x00, 0xF3, 0x01, 0x00, /* |  .@    | */
+    0x00, 0x41, 0x00, 0x00, /* |   :    | */
+    0x00, 0x00, 0x00, 0x00, /* |        | */
+    0x00, 0x31, 0x00, 0x00, /* |   .    | */
+    0x00, 0xFA, 0x06, 0x00, /* |  *@-   | */
+    0x00, 0xFA, 0x06, 0x00, /* |  *@-   | */
+    0x00, 0x10, 0x00, 0x00, /* |        | */
+
+    // @1681 '@' (16 x 16)
+    0x00, 0x00, 0x60, 0xDB, 0xCE, 0x28, 0x00, 0x00, /* |     -*%%#+.    | */
+    0x00, 0x30, 0xCD, 0x47, 0x53, 0xE9, 0x07, 0x00, /* |   .%#=:.-+%=   | */
+    0x00, 0xE4, 0x07, 0x00, 0x00, 0x20, 0x8D, 0x00, /* |  :%=      .%+  | */
+    0x10, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x03, /* |  %=        .@. | */
+    0x80, 0x0C, 0x00, 0xA3, 0xFE, 0x3D, 0xA0, 0x09, /* | +#   .*%@%. *+ | */
+    0xD0, 0x06, 0x40, 0x8F, 0x53, 0x1F, 0x60, 0x0C, /* | %-  :@+.-@  -# | */
+    0xF1, 0x02, 0xE1, 0x07, 0x70, 0x0C, 0x50, 0x0D, /* | @.  %=  =#  -% | */
+    0xF3, 0x01, 0xE6, 0x00, 0xB0, 0x08, 0x70, 0x0C, /* |.@  -%   *+  =# | */
+    0xF2, 0x02, 0xC8, 0x00, 0xF1, 0x05, 0xB0, 0x08, /* |.@. +#   @-  *+ | */
+    0xF0, 0x04, 0xE6, 0x01, 0xFA, 0x05, 0xE6, 0x01, /* | @: -%  *@- -%  | */
+    0xB0, 0x09, 0xD1, 0xEF, 0x69, 0xDF, 0x3D, 0x00, /* | *+  %@%+-@%%.  | */
+    0x40, 0x3F, 0x00, 0x23, 0x00, 0x32, 0x00, 0x00, /* | :@.  ..  ..    | */
+    0x00, 0xD9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, /* |  +%.           | */
+    0x00, 0x90, 0x7E, 0x02, 0x00, 0x41, 0xAA, 0x00, /* |   +%=.    :**  | */
+    0x00, 0x00, 0xB4, 0xEF, 0xDD, 0xDF, 0x18, 0x00, /* |    :*@%%%@%+   | */
+    0x00, 0x00, 0x00, 0x31, 0x34, 0x02, 0x00, 0x00, /* |       .:..     | */
+
+    // @1809 'A' (14 x 14)
+    0x00, 0x00, 0x50, 0x59, 0x00, 0x00, 0x00, /* |     -+-      | */
+    0x00, 0x00, 0xD0, 0xDF, 0x00, 0x00, 0x00, /* |     %@%      | */
+    0x00, 0x00, 0xF5, 0xFC, 0x04, 0x00, 0x00, /* |    -@#@:     | */
+    0x00, 0x00, 0xFB, 0xF3, 0x0A, 0x00, 0x00, /* |    *@.@*     | */
+    0x00, 0x20, 0xAF, 0xB0, 0x1F, 0x00, 0x00, /* |   .@* *@     | */
+    0x00, 0x80, 0x4F, 0x50, 0x7F, 0x00, 0x00, /* |   +@: -@=    | */
+    0x00, 0xD0, 0x0D, 0x00, 0xDE, 0x00, 0x00, /* |   %%   %%    | */
+    0x00, 0xF5, 0x07, 0x00, 0xF8, 0x04, 0x00, /* |  -@=   +@:   | */
+    0x00, 0xFB, 0x13, 0x11, 0xF3, 0x0A, 0x00, /* |  *@.   .@*   | */
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, /* | .@@@@@@@@@   | */
+    0x80, 0x7F, 0x44, 0x44, 0x84, 0x7F, 0x00, /* | +@=:::::+@=  | */
+    0xD0, 0x0E, 0x00, 0x00, 0x10, 0xDE, 0x00, /* | %%       %%  | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xF9, 0x04, /* |-@+       +@: | */
+    0xFB, 0x02, 0x00, 0x00, 0x00, 0xF3, 0x0A, /* |*@.       .@* | */
+
+    // @1907 'B' (12 x 14)
+    0x93, 0x99, 0x99, 0x48, 0x00, 0x00, /* |.++++++:    | */
+    0xF5, 0xCE, 0xDC, 0xFF, 0x1B, 0x00, /* |-@%##%@@*   | */
+    0xF5, 0x07, 0x00, 0xA1, 0x8F, 0x00, /* |-@=    *@+  | */
+    0xF5, 0x07, 0x00, 0x20, 0xBF, 0x00, /* |-@=    .@*  | */
+    0xF5, 0x07, 0x00, 0x10, 0xBF, 0x00, /* |-@=     @*  | */
+    0xF5, 0x07, 0x00, 0x70, 0x5F, 0x00, /* |-@=    =@-  | */
+    0xF5, 0x8B, 0x88, 0xDC, 0x06, 0x00, /* |-@*+++#%-   | */
+    0xF5, 0xCE, 0xCC, 0xEE, 0x19, 0x00, /* |-@%###%%+   | */
+    0xF5, 0x07, 0x00, 0x50, 0xCF, 0x00, /* |-@=    -@#  | */
+    0xF5, 0x07, 0x00, 0x00, 0xFA, 0x03, /* |-@=     *@. | */
+    0xF5, 0x07, 0x00, 0x00, 0xF9, 0x03, /* |-@=     +@. | */
+    0xF5, 0x07, 0x00, 0x10, 0xEE, 0x01, /* |-@=     %%  | */
+    0xF5, 0x7B, 0x77, 0xE9, 0x6F, 0x00, /* |-@*===+%@-  | */
+    0xF5, 0xFF, 0xFF, 0xBE, 0x04, 0x00, /* |-@@@@@%*:   | */
+
+    // @1991 'C' (14 x 15)
+    0x00, 0x00, 0x71, 0xBA, 0x8B, 0x03, 0x00, /* |     =***+.   | */
+    0x00, 0x70, 0xFE, 0xCE, 0xFD, 0x9F, 0x00, /* |   =%@%#%@@+  | */
+    0x00, 0xF8, 0x5D, 0x00, 0x20, 0xC9, 0x00, /* |  +@%-   .+#  | */
+    0x30, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, /* | .@%          | */
+    0xA0, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, /* | *@-          | */
+    0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, /* | %%           | */
+    0xF2, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, /* |.@#           | */
+    0xF2, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, /* |.@*           | */
+    0xF1, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, /* | @%           | */
+    0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, /* | %@.          | */
+    0x70, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, /* | =@+          | */
+    0x10, 0xFD, 0x07, 0x00, 0x00, 0x95, 0x00, /* |  %@=     -+  | */
+    0x00, 0xD3, 0xDF, 0x78, 0xB8, 0xCF, 0x01, /* |  .%@%+=+*@#  | */
+    0x00, 0x10, 0xE8, 0xFF, 0xDF, 0x07, 0x00, /* |    +%@@@%=   | */
+    0x00, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, /* |      ..      | */
+
+    // @2096 'D' (14 x 14)
+    0x93, 0x99, 0x99, 0x69, 0x02, 0x00, 0x00, /* |.++++++-.     | */
+    0xF5, 0xDE, 0xDD, 0xFE, 0x9F, 0x01, 0x00, /* |-@%%%%%@@+    | */
+    0xF5, 0x08, 0x00, 0x20, 0xFA, 0x0C, 0x00, /* |-@+    .*@#   | */
+    0xF5, 0x08, 0x00, 0x00, 0x90, 0x8F, 0x00, /* |-@+      +@+  | */
+    0xF5, 0x08, 0x00, 0x00, 0x10, 0xEE, 0x01, /* |-@+       %%  | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xF9, 0x04, /* |-@+       +@: | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xF7, 0x06, /* |-@+       =@- | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xF7, 0x07, /* |-@+       =@= | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x05, /* |-@+       +@- | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, 0xFC, 0x02, /* |-@+       #@. | */
+    0xF5, 0x08, 0x00, 0x00, 0x50, 0xBF, 0x00, /* |-@+      -@*  | */
+    0xF5, 0x08, 0x00, 0x00, 0xE4, 0x3E, 0x00, /* |-@+     :%%.  | */
+    0xF5, 0x8B, 0x88, 0xC8, 0xEF, 0x04, 0x00, /* |-@*++++#@%:   | */
+    0xF5, 0xFF, 0xFF, 0xCF, 0x17, 0x00, 0x00, /* |-@@@@@@#=     | */
+
+    // @2194 'E' (10 x 14)
+    0x93, 0x99, 0x99, 0x99, 0x09, /* |.++++++++ | */
+    0xF5, 0xDE, 0xDD, 0xDD, 0x1D, /* |-@%%%%%%% | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x8C, 0x88, 0x78, 0x00, /* |-@#++++=  | */
+    0xF5, 0xDE, 0xDD, 0xAD, 0x00, /* |-@%%%%%*  | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x8B, 0x88, 0x88, 0x08, /* |-@*++++++ | */
+    0xF5, 0xFF, 0xFF, 0xFF, 0x1F, /* |-@@@@@@@@ | */
+
+    // @2264 'F' (10 x 14)
+    0x93, 0x99, 0x99, 0x99, 0x09, /* |.++++++++ | */
+    0xF5, 0xDE, 0xDD, 0xDD, 0x1D, /* |-@%%%%%%% | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x6A, 0x66, 0x66, 0x01, /* |-@*-----  | */
+    0xF5, 0xFF, 0xFF, 0xFF, 0x01, /* |-@@@@@@@  | */
+    0xF5, 0x29, 0x22, 0x22, 0x00, /* |-@+.....  | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+    0xF5, 0x08, 0x00, 0x00, 0x00, /* |-@+       | */
+
+    // @2334 'G' (14 x 15)
+    0x00, 0x00, 0x71, 0xBA, 0x9B, 0x05, 0x00, /* |     =***+-   | */
+    0x00, 0x70, 0xFF, 0xDE, 0xFD, 0xDF, 0x03, /* |   =@@%%%@@%. | */
+    0x00, 0xF8, 0x4D, 0x00, 0x10, 0xE7, 0x05, /* |  +@%:    =%- | */
+    0x40, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, /* | :@%          | */
+    0xA0, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, /* | *@:          | */
+    0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, /* | %%           | */
+    0xF2, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, /* |.@#           | */
+    0xF2, 0x0B, 0x00, 0x00, 0x83, 0x88, 0x06, /* |.@*     .+++- | */
+    0xF1, 0x0D, 0x00, 0x00, 0xD5, 0xFD, 0x0C, /* | @%     -%%@# | */
+    0xC0, 0x2F, 0x00, 0x00, 0x00, 0xE0, 0x0C, /* | #@.       %# | */
+    0x60, 0x9F, 0x00, 0x00, 0x00, 0xE0, 0x0C, /* | -@+       %# | */
+    0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x0C, /* |  #@=      %# | */
+    0x00, 0xC2, 0xCF, 0x57, 0x86, 0xFD, 0x0A, /* |  .#@#=--+%@* | */
+    0x00, 0x10, 0xD7, 0xFF, 0xFF, 0x6C, 0x00, /* |    =%@@@@#-  | */
+    0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, /* |       ..     | */
+
+    // @2439 'H' (12 x 14)
+    0x93, 0x05, 0x00, 0x00, 0x20, 0x69, /* |.+-      .+-| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x8C, 0x88, 0x88, 0x98, 0xAF, /* |-@#+++++++@*| */
+    0xF5, 0xCE, 0xCC, 0xCC, 0xDC, 0xAF, /* |-@%######%@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+    0xF5, 0x08, 0x00, 0x00, 0x20, 0xAF, /* |-@+      .@*| */
+
+    // @2523 'I' (2 x 14)
+    0x89, /* |++| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+    0xDF, /* |@%| */
+
+    // @2537 'J' (8 x 15)
+    0x00, 0x00, 0x91, 0x07, /* |     += | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0C, /* |     @# | */
+    0x00, 0x00, 0xF1, 0x0B, /* |     @* | */
+    0x00, 0x00, 0xF3, 0x0A, /* |    .@* | */
+    0x00, 0x00, 0xF8, 0x06, /* |    +@- | */
+    0x72, 0xA6, 0xDF, 0x01, /* |.=-*@%  | */
+    0xF6, 0xFF, 0x2B, 0x00, /* |-@@@*.  | */
+    0x10, 0x12, 0x00, 0x00, /* |  .     | */
+
+    // @2597 'K' (12 x 14)
+    0x91, 0x06, 0x00, 0x00, 0x81, 0x19, /* | +-      ++ | */
+    0xF2, 0x0A, 0x00, 0x00, 0xFB, 0x06, /* |.@*     *@- | */
+    0xF2, 0x0A, 0x00, 0x90, 0x7F, 0x00, /* |.@*    +@=  | */
+    0xF2, 0x0A, 0x00, 0xF7, 0x09, 0x00, /* |.@*   =@+   | */
+    0xF2, 0x0A, 0x60, 0xAF, 0x00, 0x00, /* |.@*  -@*    | */
+    0xF2, 0x0A, 0xF4, 0x1C, 0x00, 0x00, /* |.@* :@#     | */
+    0xF2, 0xAD, 0xCE, 0x01, 0x00, 0x00, /* |.@%*%#      | */
+    0xF2, 0xBE, 0xFE, 0x04, 0x00, 0x00, /* |.@%*%@:     | */
+    0xF2, 0x0A, 0xE3, 0x2E, 0x00, 0x00, /* |.@* .%%.    | */
+    0xF2, 0x0A, 0x50, 0xDF, 0x01, 0x00, /* |.@*  -@%    | */
+    0xF2, 0x0A, 0x00, 0xF6, 0x0B, 0x00, /* |.@*   -@*   | */
+    0xF2, 0x0A, 0x00, 0x80, 0x9F, 0x00, /* |.@*    +@+  | */
+    0xF2, 0x0A, 0x00, 0x00, 0xFA, 0x07, /* |.@*     *@= | */
+    0xF2, 0x0A, 0x00, 0x00, 0xB1, 0x5F, /* |.@*      *@-| */
+
+    // @2681 'L' (10 x 14)
+    0x93, 0x05, 0x00, 0x00, 0x00, /* |.+-       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x07, 0x00, 0x00, 0x00, /* |-@=       | */
+    0xF5, 0x8C, 0x88, 0x88, 0x03, /* |-@#+++++. | */
+    0xF5, 0xFF, 0xFF, 0xFF, 0x06, /* |-@@@@@@@- | */
+
+    // @2751 'M' (16 x 14)
+    0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x92, 0x08, /* |.+-         .++ | */
+    0xF5, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, /* |-@@.        +@# | */
+    0xF5, 0xAF, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x0C, /* |-@@*       .@@# | */
+    0xF5, 0xFC, 0x03, 0x00, 0x00, 0xB0, 0xDE, 0x0C, /* |-@#@.      *%%# | */
+    0xF5, 0xE5, 0x0C, 0x00, 0x00, 0xF4, 0xC7, 0x0C, /* |-@-%#     :@=## | */
+    0xF5, 0x74, 0x5F, 0x00, 0x00, 0xDC, 0xC1, 0x0C, /* |-@:=@-    #% ## | */
+    0xF5, 0x04, 0xDD, 0x00, 0x60, 0x6F, 0xC0, 0x0C, /* |-@: %%   -@- ## | */
+    0xF5, 0x04, 0xF5, 0x07, 0xD1, 0x0C, 0xC0, 0x0C, /* |-@: -@=  %#  ## | */
+    0xF5, 0x04, 0xB0, 0x1E, 0xF7, 0x04, 0xC0, 0x0C, /* |-@:  *% =@:  ## | */
+    0xF5, 0x04, 0x30, 0x9F, 0xBE, 0x00, 0xC0, 0x0C, /* |-@:  .@+%*   ## | */
+    0xF5, 0x04, 0x00, 0xFA, 0x3F, 0x00, 0xC0, 0x0C, /* |-@:   *@@.   ## | */
+    0xF5, 0x04, 0x00, 0xE2, 0x09, 0x00, 0xC0, 0x0C, /* |-@:   .%+    ## | */
+    0xF5, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, /* |-@:          ## | */
+    0xF5, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, /* |-@:          ## | */
+
+    // @2863 'N' (12 x 14)
+    0x93, 0x02, 0x00, 0x00, 0x00, 0x69, /* |.+.       +-| */
+    0xF5, 0x1C, 0x00, 0x00, 0x00, 0xAE, /* |-@#       %*| */
+    0xF5, 0x9F, 0x00, 0x00, 0x00, 0xAE, /* |-@@+      %*| */
+    0xF5, 0xFD, 0x06, 0x00, 0x00, 0xAE, /* |-@%@-     %*| */
+    0xF5, 0xD5, 0x3F, 0x00, 0x00, 0xAE, /* |-@-%@.    %*| */
+    0xF5, 0x34, 0xDF, 0x01, 0x00, 0xAE, /* |-@:.@%    %*| */
+    0xF5, 0x04, 0xF6, 0x0A, 0x00, 0xAE, /* |-@: -@*   %*| */
+    0xF5, 0x04, 0x90, 0x7F, 0x00, 0xAE, /* |-@:  +@=  %*| */
+    0xF5, 0x04, 0x10, 0xFC, 0x04, 0xAE, /* |-@:   #@: %*| */
+    0xF5, 0x04, 0x00, 0xE2, 0x1E, 0xAE, /* |-@:   .%% %*| */
+    0xF5, 0x04, 0x00, 0x50, 0xBF, 0xAE, /* |-@:    -@*%*| */
+    0xF5, 0x04, 0x00, 0x00, 0xF8, 0xAF, /* |-@:     +@@*| */
+    0xF5, 0x04, 0x00, 0x00, 0xC0, 0xAF, /* |-@:      #@*| */
+    0xF5, 0x04, 0x00, 0x00, 0x20, 0xAD, /* |-@:      .%*| */
+
+    // @2947 'O' (16 x 15)
+    0x00, 0x00, 0x72, 0xBA, 0x8B, 0x03, 0x00, 0x00, /* |    .=***+.     | */
+    0x00, 0x70, 0xFF, 0xCE, 0xFE, 0x9F, 0x00, 0x00, /* |   =@@%#%@@+    | */
+    0x00, 0xF8, 0x4C, 0x00, 0x30, 0xFB, 0x0B, 0x00, /* |  +@#:   .*@*   | */
+    0x30, 0xDF, 0x01, 0x00, 0x00, 0xB0, 0x6F, 0x00, /* | .@%       *@-  | */
+    0xA0, 0x4F, 0x00, 0x00, 0x00, 0x20, 0xDF, 0x00, /* | *@:       .@%  | */
+    0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, /* | %%         #@. | */
+    0xF1, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04, /* | @#         +@: | */
+    0xF2, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04, /* |.@*         +@: | */
+    0xF1, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x03, /* | @%         *@. | */
+    0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, /* | #@.        %%  | */
+    0x60, 0x9F, 0x00, 0x00, 0x00, 0x70, 0x9F, 0x00, /* | -@+       =@+  | */
+    0x00, 0xFC, 0x07, 0x00, 0x00, 0xF5, 0x1E, 0x00, /* |  #@=     -@%   | */
+    0x00, 0xC2, 0xDF, 0x78, 0xC8, 0xEF, 0x03, 0x00, /* |  .#@%+=+#@%.   | */
+    0x00, 0x10, 0xD7, 0xFF, 0xDF, 0x18, 0x00, 0x00, /* |    =%@@@%+     | */
+    0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x00, /* |       .        | */
+
+    // @3067 'P' (10 x 14)
+    0x91, 0x99, 0x99, 0x27, 0x00, /* | +++++=.  | */
+    0xF2, 0xCE, 0xDC, 0xFF, 0x09, /* |.@%##%@@+ | */
+    0xF2, 0x0A, 0x00, 0xB2, 0x7F, /* |.@*   .*@=| */
+    0xF2, 0x0A, 0x00, 0x20, 0xCF, /* |.@*    .@#| */
+    0xF2, 0x0A, 0x00, 0x00, 0xEE, /* |.@*     %%| */
+    0xF2, 0x0A, 0x00, 0x10, 0xDF, /* |.@*     @%| */
+    0xF2, 0x0A, 0x00, 0x90, 0x8F, /* |.@*    +@+| */
+    0xF2, 0x8D, 0x98, 0xFD, 0x1B, /* |.@%+++%@* | */
+    0xF2, 0xEF, 0xDE, 0x6B, 0x00, /* |.@@%%%*-  | */
+    0xF2, 0x0A, 0x00, 0x00, 0x00, /* |.@*       | */
+    0xF2, 0x0A, 0x00, 0x00, 0x00, /* |.@*       | */
+    0xF2, 0x0A, 0x00, 0x00, 0x00, /* |.@*       | */
+    0xF2, 0x0A, 0x00, 0x00, 0x00, /* |.@*       | */
+    0xF2, 0x0A, 0x00, 0x00, 0x00, /* |.@*       | */
+
+    // @3137 'Q' (16 x 17)
+    0x00, 0x00, 0x72, 0xBA, 0x8B, 0x03, 0x00, 0x00, /* |    .=***+.     | */
+    0x00, 0x70, 0xFF, 0xCE, 0xFE, 0x9F, 0x00, 0x00, /* |   =@@%#%@@+    | */
+    0x00, 0xF8, 0x4C, 0x00, 0x30, 0xFB, 0x0B, 0x00, /* |  +@#:   .*@*   | */
+    0x30, 0xDF, 0x01, 0x00, 0x00, 0xB0, 0x6F, 0x00, /* | .@%       *@-  | */
+    0xA0, 0x4F, 0x00, 0x00, 0x00, 0x20, 0xDF, 0x00, /* | *@:       .@%  | */
+    0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, /* | %%         #@. | */
+    0xF1, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04, /* | @#         +@: | */
+    0xF2, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04, /* |.@*         +@: | */
+    0xF1, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x03, /* | @%         *@. | */
+    0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, /* | #@.        %%  | */
+    0x60, 0x9F, 0x00, 0x00, 0x00, 0x70, 0x9F, 0x00, /* | -@+       =@+  | */
+    0x00, 0xFC, 0x07, 0x00, 0x00, 0xF5, 0x1E, 0x00, /* |  #@=     -@%   | */
+    0x00, 0xC2, 0xDF, 0x78, 0xC8, 0xEF, 0x03, 0x00, /* |  .#@%+=+#@%.   | */
+    0x00, 0x10, 0xD7, 0xFF, 0xEF, 0xCF, 0x01, 0x00, /* |    =%@@@%@#    | */
+    0x00, 0x00, 0x00, 0x21, 0x01, 0xF6, 0x1B, 0x00, /* |       .  -@*   | */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0x00, /* |           =@*  | */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x07, /* |            =#= | */
+
+    // @3273 'R' (12 x 14)
+    0x91, 0x99, 0x99, 0x27, 0x00, 0x00, /* | +++++=.    | */
+    0xF2, 0xCE, 0xEC, 0xFF, 0x08, 0x00, /* |.@%##%@@+   | */
+    0xF2, 0x0A, 0x00, 0xC2, 0x5F, 0x00, /* |.@*   .#@-  | */
+    0xF2, 0x0A, 0x00, 0x40, 0x9F, 0x00, /* |.@*    :@+  | */
+    0xF2, 0x0A, 0x00, 0x20, 0xAF, 0x00, /* |.@*    .@*  | */
+    0xF2, 0x0A, 0x00, 0x60, 0x7F, 0x00, /* |.@*    -@=  | */
+    0xF2, 0x0A, 0x20, 0xE6, 0x1C, 0x00, /* |.@*  .-%#   | */
+    0xF2, 0xFF, 0xFF, 0x9E, 0x01, 0x00, /* |.@@@@@%+    | */
+    0xF2, 0x5C, 0xF6, 0x1C, 0x00, 0x00, /* |.@#--@#     | */
+    0xF2, 0x0A, 0x70, 0x9F, 0x00, 0x00, /* |.@*  =@+    | */
+    0xF2, 0x0A, 0x00, 0xFB, 0x05, 0x00, /* |.@*   *@-   | */
+    0xF2, 0x0A, 0x00, 0xE1, 0x2E, 0x00, /* |.@*    %%.  | */
+    0xF2, 0x0A, 0x00, 0x40, 0xCF, 0x00, /* |.@*    :@#  | */
+    0xF2, 0x0A, 0x00, 0x00, 0xF8, 0x08, /* |.@*     +@+ | */
+
+    // @3357 'S' (10 x 15)
+    0x00, 0x60, 0xBA, 0x5A, 0x00, /* |   -***-  | */
+    0x10, 0xFC, 0xBD, 0xFE, 0x0C, /* |  #@%*%@# | */
+    0x80, 0x6F, 0x00, 0x60, 0x08, /* | +@-   -+ | */
+    0xC0, 0x0E, 0x00, 0x00, 0x00, /* | #%       | */
+    0xC0, 0x1E, 0x00, 0x00, 0x00, /* | #%       | */
+    0x80, 0xCF, 0x04, 0x00, 0x00, /* | +@#:     | */
+    0x10, 0xFB, 0xDF, 0x28, 0x00, /* |  *@@%+.  | */
+    0x00, 0x50, 0xEA, 0xFF, 0x06, /* |   -*%@@- | */
+    0x00, 0x00, 0x00, 0xE6, 0x2F, /* |      -%@.| */
+    0x00, 0x00, 0x00, 0x70, 0x5F, /* |       =@-| */
+    0x00, 0x00, 0x00, 0x60, 0x5F, /* |       -@-| */
+    0xA1, 0x03, 0x00, 0xB0, 0x1F, /* | *.    *@ | */
+    0xF3, 0x9F, 0x76, 0xFC, 0x08, /* |.@@+-=#@+ | */
+    0x30, 0xFB, 0xFF, 0x6D, 0x00, /* | .*@@@%-  | */
+    0x00, 0x00, 0x22, 0x00, 0x00, /* |    ..    | */
+
+    // @3432 'T' (12 x 14)
+    0x97, 0x99, 0x99, 0x99, 0x99, 0x09, /* |=++++++++++ | */
+    0xEA, 0xEE, 0xFE, 0xEF, 0xEE, 0x0D, /* |*%%%%@@%%%% | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+    0x00, 0x00, 0xF5, 0x08, 0x00, 0x00, /* |    -@+     | */
+
+    // @3516 'U' (12 x 15)
+    0x95, 0x03, 0x00, 0x00, 0x40, 0x39, /* |-+.      :+.| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF7, 0x05, 0x00, 0x00, 0x70, 0x5F, /* |=@-      =@-| */
+    0xF6, 0x06, 0x00, 0x00, 0x80, 0x5F, /* |-@-      +@-| */
+    0xF3, 0x0B, 0x00, 0x00, 0xC0, 0x1F, /* |.@*      #@ | */
+    0xC0, 0x6F, 0x00, 0x00, 0xF7, 0x0A, /* | #@-    =@* | */
+    0x20, 0xFE, 0x7B, 0xC8, 0xDF, 0x01, /* | .%@*=+#@%  | */
+    0x00, 0xA2, 0xFF, 0xEF, 0x19, 0x00, /* |  .*@@@%+   | */
+    0x00, 0x00, 0x20, 0x02, 0x00, 0x00, /* |     ..     | */
+
+    // @3606 'V' (14 x 14)
+    0x98, 0x01, 0x00, 0x00, 0x00, 0x92, 0x07, /* |++        .+= | */
+    0xF7, 0x07, 0x00, 0x00, 0x00, 0xF8, 0x06, /* |=@=       +@- | */
+    0xF1, 0x0D, 0x00, 0x00, 0x00, 0xEE, 0x01, /* | @%       %%  | */
+    0xA0, 0x4F, 0x00, 0x00, 0x50, 0x8F, 0x00, /* | *@:     -@+  | */
+    0x40, 0xAF, 0x00, 0x00, 0xB0, 0x2F, 0x00, /* | :@*     *@.  | */
+    0x00, 0xFD, 0x01, 0x00, 0xF2, 0x0B, 0x00, /* |  %@    .@*   | */
+    0x00, 0xF6, 0x07, 0x00, 0xF8, 0x05, 0x00, /* |  -@=   +@-   | */
+    0x00, 0xE1, 0x0D, 0x00, 0xEE, 0x00, 0x00, /* |   %%   %%    | */
+    0x00, 0x90, 0x4F, 0x50, 0x8F, 0x00, 0x00, /* |   +@: -@+    | */
+    0x00, 0x30, 0xAF, 0xB0, 0x2F, 0x00, 0x00, /* |   .@* *@.    | */
+    0x00, 0x00, 0xFC, 0xF3, 0x0B, 0x00, 0x00, /* |    #@.@*     | */
+    0x00, 0x00, 0xF6, 0xFC, 0x05, 0x00, 0x00, /* |    -@#@-     | */
+    0x00, 0x00, 0xE1, 0xDF, 0x00, 0x00, 0x00, /* |     %@%      | */
+    0x00, 0x00, 0x90, 0x7F, 0x00, 0x00, 0x00, /* |     +@=      | */
+
+    // @3704 'W' (16 x 14)
+    0x29, 0x00, 0x00, 0x10, 0x59, 0x00, 0x00, 0x00, /* |+.      +-      | */
+    0x7F, 0x00, 0x00, 0x60, 0xDF, 0x00, 0x00, 0x10, /* |@=     -@%      | */
+    0xCF, 0x00, 0x00, 0xB0, 0xFF, 0x03, 0x00, 0x50, /* |@#     *@@.    -| */
+    0xFD, 0x01, 0x00, 0xF1, 0xFA, 0x08, 0x00, 0x90, /* |%@     @*@+    +| */
+    0xF9, 0x06, 0x00, 0xF6, 0xD3, 0x0D, 0x00, 0xE0, /* |+@-   -@.%%    %| */
+    0xF4, 0x0A, 0x00, 0xDB, 0x80, 0x3F, 0x00, 0xF3, /* |:@*   *% +@.  .@| */
+    0xE0, 0x0E, 0x10, 0x8F, 0x30, 0x8F, 0x00, 0xF8, /* | %%   @+ .@+  +@| */
+    0xA0, 0x4F, 0x60, 0x3F, 0x00, 0xDD, 0x00, 0xEC, /* | *@: -@.  %%  #%| */
+    0x50, 0x9F, 0xB0, 0x0D, 0x00, 0xF8, 0x23, 0xAF, /* | -@+ *%   +@..@*| */
+    0x10, 0xDF, 0xF2, 0x08, 0x00, 0xF3, 0x68, 0x6F, /* |  @%.@+   .@+-@-| */
+    0x00, 0xFB, 0xF9, 0x03, 0x00, 0xD0, 0xBD, 0x1F, /* |  *@+@.    %%*@ | */
+    0x00, 0xF6, 0xDE, 0x00, 0x00, 0x80, 0xEF, 0x0B, /* |  -@%%     +@%* | */
+    0x00, 0xF1, 0x8F, 0x00, 0x00, 0x30, 0xFF, 0x07, /* |   @@+     .@@= | */
+    0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x02, /* |   #@.      %@. | */
+
+    // @3816 'X' (12 x 14)
+    0x94, 0x06, 0x00, 0x00, 0x20, 0x79, /* |:+-      .+=| */
+    0xD1, 0x3F, 0x00, 0x00, 0xC0, 0x3F, /* | %@.     #@.| */
+    0x40, 0xCF, 0x00, 0x00, 0xF7, 0x07, /* | :@#    =@= | */
+    0x00, 0xF8, 0x07, 0x30, 0xBF, 0x00, /* |  +@=  .@*  | */
+    0x00, 0xD1, 0x2F, 0xC0, 0x2E, 0x00, /* |   %@. #%.  | */
+    0x00, 0x30, 0xCF, 0xF8, 0x06, 0x00, /* |   .@#+@-   | */
+    0x00, 0x00, 0xF8, 0xAF, 0x00, 0x00, /* |    +@@*    | */
+    0x00, 0x00, 0xF8, 0xCF, 0x00, 0x00, /* |    +@@#    | */
+    0x00, 0x30, 0xCF, 0xF9, 0x07, 0x00, /* |   .@#+@=   | */
+    0x00, 0xC0, 0x2E, 0xD1, 0x2E, 0x00, /* |   #%. %%.  | */
+    0x00, 0xF8, 0x07, 0x40, 0xBF, 0x00, /* |  +@=  :@*  | */
+    0x30, 0xCF, 0x00, 0x00, 0xFA, 0x06, /* | .@#    *@- | */
+    0xD0, 0x2E, 0x00, 0x00, 0xE1, 0x2E, /* | %%.     %%.| */
+    0xF8, 0x07, 0x00, 0x00, 0x60, 0xBF, /* |+@=      -@*| */
+
+    // @3900 'Y' (12 x 14)
+    0x97, 0x02, 0x00, 0x00, 0x20, 0x79, /* |=+.      .+=| */
+    0xF4, 0x0B, 0x00, 0x00, 0xB0, 0x3F, /* |:@*      *@.| */
+    0xA0, 0x5F, 0x00, 0x00, 0xF5, 0x09, /* | *@-    -@+ | */
+    0x10, 0xDE, 0x01, 0x10, 0xED, 0x01, /* |  %%    %%  | */
+    0x00, 0xF6, 0x07, 0x80, 0x6F, 0x00, /* |  -@=  +@-  | */
+    0x00, 0xC0, 0x2E, 0xF2, 0x0C, 0x00, /* |   #%..@#   | */
+    0x00, 0x30, 0xAF, 0xFA, 0x03, 0x00, /* |   .@**@.   | */
+    0x00, 0x00, 0xF9, 0x8F, 0x00, 0x00, /* |    +@@+    | */
+    0x00, 0x00, 0xF1, 0x1E, 0x00, 0x00, /* |     @%     | */
+    0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, /* |     %%     | */
+    0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, /* |     %%     | */
+    0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, /* |     %%     | */
+    0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, /* |     %%     | */
+    0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, /* |     %%     | */
+
+    // @3984 'Z' (12 x 14)
+    0x80, 0x99, 0x99, 0x99, 0x99, 0x19, /* | ++++++++++ | */
+    0xB0, 0xDD, 0xDD, 0xDD, 0xFE, 0x1E, /* | *%%%%%%%@% | */
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x05, /* |        *@- | */
+    0x00, 0x00, 0x00, 0x70, 0xAF, 0x00, /* |       =@*  | */
+    0x00, 0x00, 0x00, 0xF3, 0x1D, 0x00, /* |      .@%   | */
+    0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, /* |      #@.   | */
+    0x00, 0x00, 0x90, 0x8F, 0x00, 0x00, /* |     +@+    | */
+    0x00, 0x00, 0xF4, 0x0C, 0x00, 0x00, /* |    :@#     | */
+    0x00, 0x10, 0xEE, 0x02, 0x00, 0x00, /* |    %%.     | */
+    0x00, 0xA0, 0x5F, 0x00, 0x00, 0x00, /* |   *@-      | */
+    0x00, 0xF6, 0x0A, 0x00, 0x00, 0x00, /* |  -@*       | */
+    0x20, 0xDE, 0x01, 0x00, 0x00, 0x00, /* | .%%        | */
+    0xC0, 0xBF, 0x88, 0x88, 0x88, 0x08, /* | #@*+++++++ | */
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, /* |.@@@@@@@@@@ | */
+
+    // @4068 '[' (4 x 18)
+    0x85, 0x78, /* |-++=| */
+    0xEA, 0x68, /* |*%+-| */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xCA, 0x00, /* |*#  | */
+    0xDA, 0x46, /* |*%-:| */
+    0xB7, 0xAB, /* |=***| */
+
+    // @4104 '\' (8 x 15)
+    0xE1, 0x05, 0x00, 0x00, /* | %-     | */
+    0x90, 0x0C, 0x00, 0x00, /* | +#     | */
+    0x30, 0x3F, 0x00, 0x00, /* | .@.    | */
+    0x00, 0x9C, 0x00, 0x00, /* |  #+    | */
+    0x00, 0xE6, 0x01, 0x00, /* |  -%    | */
+    0x00, 0xE1, 0x06, 0x00, /* |   %-   | */
+    0x00, 0x90, 0x0C, 0x00, /* |   +#   | */
+    0x00, 0x30, 0x3F, 0x00, /* |   .@.  | */
+    0x00, 0x00, 0x9C, 0x00, /* |    #+  | */
+    0x00, 0x00, 0xE6, 0x01, /* |    -%  | */
+    0x00, 0x00, 0xE1, 0x06, /* |     %- | */
+    0x00, 0x00, 0x90, 0x0C, /* |     +# | */
+    0x00, 0x00, 0x30, 0x3F, /* |     .@.| */
+    0x00, 0x00, 0x00, 0x9C, /* |      #+| */
+    0x00, 0x00, 0x00, 0xC4, /* |      :#| */
+
+    // @4164 ']' (6 x 18)
+    0x81, 0x88, 0x03, /* | +++. | */
+    0x81, 0xF9, 0x05, /* | ++@- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x00, 0xF1, 0x05, /* |   @- | */
+    0x50, 0xF6, 0x05, /* | --@- | */
+    0xB2, 0xBB, 0x04, /* |.***: | */
+
+    // @4218 '^' (10 x 7)
+    0x00, 0x20, 0x29, 0x00, 0x00, /* |   .+.    | */
+    0x00, 0xB0, 0x9F, 0x00, 0x00, /* |   *@+    | */
+    0x00, 0xF4, 0xF9, 0x03, 0x00, /* |  :@+@.   | */
+    0x00, 0xBC, 0xC0, 0x0B, 0x00, /* |  #* #*   | */
+    0x60, 0x3F, 0x40, 0x4F, 0x00, /* | -@. :@:  | */
+    0xD1, 0x0A, 0x00, 0xCA, 0x00, /* | %*   *#  | */
+    0x83, 0x02, 0x00, 0x82, 0x02, /* |.+.   .+. | */
+
+    // @4253 '_' (8 x 2)
+    0x77, 0x77, 0x77, 0x37, /* |=======.| */
+    0xAA, 0xAA, 0xAA, 0x5A, /* |*******-| */
+
+    // @4261 '`' (4 x 3)
+    0xB3, 0x08, /* |.*+ | */
+    0x70, 0x4F, /* | =@:| */
+    0x00, 0xC8, /* |  +#| */
+
+    // @4267 'a' (10 x 11)
+    0x00, 0x82, 0xCB, 0x18, 0x00, /* |  .+*#+   | */
+    0x50, 0xDF, 0xA9, 0xCF, 0x00, /* | -@%+*@#  | */
+    0x30, 0x07, 0x00, 0xF7, 0x04, /* | .=   =@: | */
+    0x00, 0x00, 0x00, 0xF3, 0x07, /* |      .@= | */
+    0x00, 0x00, 0x53, 0xF8, 0x07, /* |    .-+@= | */
+    0x10, 0xE9, 0xBE, 0xFB, 0x07, /* |  +%%**@= | */
+    0xC0, 0x4D, 0x00, 0xF3, 0x07, /* | #%:  .@= | */
+    0xF2, 0x08, 0x00, 0xF4, 0x07, /* |.@+   :@= | */
+    0xE0, 0x2C, 0x51, 0xFD, 0x07, /* | %#. -%@= | */
+    0x50, 0xFE, 0xBF, 0xD2, 0x07, /* | -%@@*.%= | */
+    0x00, 0x20, 0x01, 0x00, 0x00, /* |   .      | */
+
+    // @4322 'b' (10 x 15)
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x52, 0xBA, 0x18, 0x00, /* |+@.-**+   | */
+    0xF8, 0xDB, 0xA9, 0xDF, 0x01, /* |+@*%+*@%  | */
+    0xF8, 0x09, 0x00, 0xF6, 0x08, /* |+@+   -@+ | */
+    0xF8, 0x02, 0x00, 0xE0, 0x0C, /* |+@.    %# | */
+    0xF8, 0x02, 0x00, 0xD0, 0x0E, /* |+@.    %% | */
+    0xF8, 0x02, 0x00, 0xC0, 0x0E, /* |+@.    #% | */
+    0xF8, 0x02, 0x00, 0xE0, 0x0C, /* |+@.    %# | */
+    0xF8, 0x03, 0x00, 0xF5, 0x08, /* |+@.   -@+ | */
+    0xF8, 0x5C, 0x63, 0xDE, 0x01, /* |+@#-.-%%  | */
+    0xE8, 0xD4, 0xFF, 0x2B, 0x00, /* |+%:%@@*.  | */
+    0x00, 0x00, 0x12, 0x00, 0x00, /* |    .     | */
+
+    // @4397 'c' (10 x 11)
+    0x00, 0x71, 0xBB, 0x39, 0x00, /* |   =**+.  | */
+    0x20, 0xFD, 0x8A, 0xFC, 0x03, /* | .%@*+#@. | */
+    0xA0, 0x4F, 0x00, 0x30, 0x00, /* | *@:   .  | */
+    0xF1, 0x0A, 0x00, 0x00, 0x00, /* | @*       | */
+    0xF4, 0x07, 0x00, 0x00, 0x00, /* |:@=       | */
+    0xF4, 0x07, 0x00, 0x00, 0x00, /* |:@=       | */
+    0xF3, 0x09, 0x00, 0x00, 0x00, /* |.@+       | */
+    0xD0, 0x1E, 0x00, 0x10, 0x00, /* | %%       | */
+    0x50, 0xCF, 0x34, 0xE7, 0x04, /* | -@#:.=%: | */
+    0x00, 0xD5, 0xFF, 0x7E, 0x00, /* |  -%@@%=  | */
+    0x00, 0x00, 0x22, 0x00, 0x00, /* |    ..    | */
+
+    // @4452 'd' (10 x 15)
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x82, 0xBC, 0x86, 0x3F, /* |  .+#*-+@.| */
+    0x20, 0xEE, 0x89, 0xEC, 0x3F, /* | .%%++#%@.| */
+    0xB0, 0x3F, 0x00, 0xB0, 0x3F, /* | *@.   *@.| */
+    0xF2, 0x0A, 0x00, 0x80, 0x3F, /* |.@*    +@.| */
+    0xF4, 0x07, 0x00, 0x80, 0x3F, /* |:@=    +@.| */
+    0xF5, 0x07, 0x00, 0x80, 0x3F, /* |-@=    +@.| */
+    0xF3, 0x08, 0x00, 0x80, 0x3F, /* |.@+    +@.| */
+    0xE1, 0x0C, 0x00, 0xB0, 0x3F, /* | %#    *@.| */
+    0x80, 0xAF, 0x54, 0xDB, 0x3F, /* | +@*:-*%@.| */
+    0x00, 0xF9, 0xEF, 0x47, 0x3F, /* |  +@@%=:@.| */
+    0x00, 0x10, 0x02, 0x00, 0x00, /* |    .     | */
+
+    // @4527 'e' (10 x 11)
+    0x00, 0x71, 0xBB, 0x29, 0x00, /* |   =**+.  | */
+    0x20, 0xED, 0x88, 0xEC, 0x03, /* | .%%++#%. | */
+    0xB0, 0x2E, 0x00, 0xC0, 0x0C, /* | *%.   ## | */
+    0xF2, 0x09, 0x00, 0x60, 0x1F, /* |.@+    -@ | */
+    0xF4, 0xDE, 0xDD, 0xED, 0x3F, /* |:@%%%%%%@.| */
+    0xF4, 0x38, 0x33, 0x33, 0x03, /* |:@+...... | */
+    0xF2, 0x08, 0x00, 0x00, 0x00, /* |.@+       | */
+    0xC0, 0x1E, 0x00, 0x00, 0x01, /* | #%       | */
+    0x40, 0xCF, 0x35, 0xB5, 0x0D, /* | :@#-.-*% | */
+    0x00, 0xC4, 0xFF, 0xBF, 0x03, /* |  :#@@@*. | */
+    0x00, 0x00, 0x21, 0x00, 0x00, /* |     .    | */
+
+    // @4582 'f' (8 x 14)
+    0x00, 0x70, 0xCC, 0x03, /* |   =##. | */
+    0x00, 0xFA, 0x7A, 0x01, /* |  *@*=  | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x30, 0x6F, 0x00, 0x00, /* | .@-    | */
+    0x95, 0xAF, 0x77, 0x01, /* |-+@*==  | */
+    0xC7, 0xEF, 0xCC, 0x02, /* |=#@%##. | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+    0x30, 0x7F, 0x00, 0x00, /* | .@=    | */
+
+    // @4638 'g' (10 x 14)
+    0x00, 0xA4, 0xBC, 0x46, 0x24, /* |  :*#*-::.| */
+    0x60, 0xAF, 0x97, 0xFF, 0x4D, /* | -@*=+@@%:| */
+    0xE0, 0x0B, 0x00, 0xF7, 0x02, /* | %*   =@. | */
+    0xF0, 0x08, 0x00, 0xF4, 0x03, /* | @+   :@. | */
+    0xC0, 0x1D, 0x00, 0xEA, 0x01, /* | #%   *%  | */
+    0x20, 0xED, 0xDB, 0x5E, 0x00, /* | .%%*%%-  | */
+    0x40, 0x5D, 0x56, 0x01, 0x00, /* | :%---    | */
+    0xA0, 0x3D, 0x01, 0x00, 0x00, /* | *%.      | */
+    0x50, 0xFF, 0xFF, 0xBE, 0x04, /* | -@@@@%*: | */
+    0xB1, 0x4A, 0x65, 0xE8, 0x1F, /* | **:--+%@ | */
+    0xF7, 0x00, 0x00, 0x60, 0x2F, /* |=@     -@.| */
+    0xF6, 0x05, 0x00, 0xC1, 0x0C, /* |-@-    ## | */
+    0xA0, 0xDF, 0xCB, 0xCF, 0x02, /* | *@%*#@#. | */
+    0x00, 0x62, 0x67, 0x03, 0x00, /* |  .-=-.   | */
+
+    // @4708 'h' (10 x 14)
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0xF9, 0x61, 0xBB, 0x18, 0x00, /* |+@ -**+   | */
+    0xF9, 0xDB, 0xB9, 0xBF, 0x00, /* |+@*%+*@*  | */
+    0xF9, 0x08, 0x00, 0xF9, 0x03, /* |+@+   +@. | */
+    0xF9, 0x01, 0x00, 0xF5, 0x06, /* |+@    -@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+
+    // @4778 'i' (4 x 14)
+    0xC5, 0x04, /* |-#: | */
+    0xFB, 0x09, /* |*@+ | */
+    0x82, 0x02, /* |.+. | */
+    0x00, 0x00, /* |    | */
+    0x94, 0x03, /* |:+. | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+
+    // @4806 'j' (6 x 18)
+    0x00, 0xC5, 0x04, /* |  -#: | */
+    0x00, 0xFB, 0x09, /* |  *@+ | */
+    0x00, 0x82, 0x02, /* |  .+. | */
+    0x00, 0x00, 0x00, /* |      | */
+    0x00, 0x94, 0x03, /* |  :+. | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF6, 0x04, /* |  -@: | */
+    0x00, 0xF9, 0x03, /* |  +@. | */
+    0xD6, 0xBF, 0x00, /* |-%@*  | */
+    0x73, 0x05, 0x00, /* |.=-   | */
+
+    // @4860 'k' (10 x 14)
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x00, 0x00, /* |+@.       | */
+    0xF8, 0x02, 0x00, 0x97, 0x01, /* |+@.   =+  | */
+    0xF8, 0x02, 0x80, 0x5F, 0x00, /* |+@.  +@-  | */
+    0xF8, 0x02, 0xF7, 0x06, 0x00, /* |+@. =@-   | */
+    0xF8, 0x62, 0x7F, 0x00, 0x00, /* |+@.-@=    | */
+    0xF8, 0xFC, 0x0A, 0x00, 0x00, /* |+@#@*     | */
+    0xF8, 0xC7, 0x2E, 0x00, 0x00, /* |+@=#%.    | */
+    0xF8, 0x22, 0xCE, 0x01, 0x00, /* |+@..%#    | */
+    0xF8, 0x02, 0xF4, 0x0A, 0x00, /* |+@. :@*   | */
+    0xF8, 0x02, 0x70, 0x7F, 0x00, /* |+@.  =@=  | */
+    0xF8, 0x02, 0x00, 0xF9, 0x04, /* |+@.   +@: | */
+
+    // @4930 'l' (4 x 14)
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+    0xF6, 0x04, /* |-@: | */
+
+    // @4958 'm' (14 x 10)
+    0x76, 0x81, 0xAB, 0x02, 0xA5, 0x8B, 0x01, /* |-= +**. -**+  | */
+    0xE9, 0xBC, 0xE9, 0x7C, 0x9E, 0xFA, 0x0C, /* |+%#*+%#=%+*@# | */
+    0xF9, 0x06, 0x30, 0xEF, 0x02, 0x80, 0x4F, /* |+@-  .@%.  +@:| */
+    0xF9, 0x01, 0x00, 0xCF, 0x00, 0x40, 0x6F, /* |+@    @#   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+    0xF9, 0x01, 0x00, 0xBE, 0x00, 0x40, 0x6F, /* |+@    %*   :@-| */
+
+    // @5028 'n' (10 x 10)
+    0x76, 0x60, 0xBB, 0x18, 0x00, /* |-= -**+   | */
+    0xE9, 0xDB, 0xB9, 0xBF, 0x00, /* |+%*%+*@*  | */
+    0xF9, 0x08, 0x00, 0xF9, 0x03, /* |+@+   +@. | */
+    0xF9, 0x01, 0x00, 0xF5, 0x06, /* |+@    -@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+    0xF9, 0x01, 0x00, 0xF4, 0x06, /* |+@    :@- | */
+
+    // @5078 'o' (10 x 11)
+    0x00, 0x71, 0xBB, 0x49, 0x00, /* |   =**+:  | */
+    0x20, 0xFD, 0x9A, 0xFC, 0x08, /* | .%@*+#@+ | */
+    0xB0, 0x3F, 0x00, 0x90, 0x4F, /* | *@.   +@:| */
+    0xF2, 0x0A, 0x00, 0x20, 0xAF, /* |.@*    .@*| */
+    0xF4, 0x07, 0x00, 0x00, 0xCE, /* |:@=     %#| */
+    0xF5, 0x07, 0x00, 0x00, 0xDE, /* |-@=     %%| */
+    0xF3, 0x08, 0x00, 0x10, 0xBF, /* |.@+     @*| */
+    0xD0, 0x1D, 0x00, 0x60, 0x6F, /* | %%    -@-| */
+    0x50, 0xCF, 0x34, 0xE7, 0x1C, /* | -@#:.=%# | */
+    0x00, 0xC4, 0xFF, 0x9F, 0x01, /* |  :#@@@+  | */
+    0x00, 0x00, 0x21, 0x00, 0x00, /* |     .    | */
+
+    // @5133 'p' (10 x 14)
+    0x76, 0x60, 0xCB, 0x18, 0x00, /* |-= -*#+   | */
+    0xE9, 0xCA, 0xB9, 0xDF, 0x01, /* |+%*#+*@%  | */
+    0xF9, 0x08, 0x00, 0xF7, 0x07, /* |+@+   =@= | */
+    0xF9, 0x01, 0x00, 0xF1, 0x0B, /* |+@     @* | */
+    0xF9, 0x01, 0x00, 0xE0, 0x0D, /* |+@     %% | */
+    0xF9, 0x01, 0x00, 0xD0, 0x0D, /* |+@     %% | */
+    0xF9, 0x01, 0x00, 0xF1, 0x0B, /* |+@     @* | */
+    0xF9, 0x02, 0x00, 0xF6, 0x07, /* |+@.   -@= | */
+    0xF9, 0x5C, 0x73, 0xDE, 0x01, /* |+@#-.=%%  | */
+    0xF9, 0xE7, 0xFF, 0x2B, 0x00, /* |+@=%@@*.  | */
+    0xF9, 0x01, 0x12, 0x00, 0x00, /* |+@  .     | */
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0xF9, 0x01, 0x00, 0x00, 0x00, /* |+@        | */
+    0x42, 0x00, 0x00, 0x00, 0x00, /* |.:        | */
+
+    // @5203 'q' (10 x 14)
+    0x00, 0x82, 0xBC, 0x26, 0x29, /* |  .+#*-.+.| */
+    0x20, 0xEE, 0x89, 0xDC, 0x3F, /* | .%%++#%@.| */
+    0xB0, 0x3F, 0x00, 0xB0, 0x3F, /* | *@.   *@.| */
+    0xF2, 0x0A, 0x00, 0x80, 0x3F, /* |.@*    +@.| */
+    0xF4, 0x07, 0x00, 0x80, 0x3F, /* |:@=    +@.| */
+    0xF5, 0x07, 0x00, 0x80, 0x3F, /* |-@=    +@.| */
+    0xF3, 0x08, 0x00, 0x80, 0x3F, /* |.@+    +@.| */
+    0xE1, 0x0C, 0x00, 0xB0, 0x3F, /* | %#    *@.| */
+    0x80, 0xAF, 0x54, 0xEB, 0x3F, /* | +@*:-*%@.| */
+    0x00, 0xF9, 0xEF, 0x87, 0x3F, /* |  +@@%=+@.| */
+    0x00, 0x10, 0x02, 0x80, 0x3F, /* |    .  +@.| */
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x00, 0x00, 0x80, 0x3F, /* |       +@.| */
+    0x00, 0x00, 0x00, 0x20, 0x14, /* |       .: | */
+
+    // @5273 'r' (8 x 10)
+    0x86, 0x60, 0xBB, 0x02, /* |-+ -**. | */
+    0xE9, 0xF7, 0xFD, 0x01, /* |+%=@%@  | */
+    0xF9, 0x2C, 0x00, 0x00, /* |+@#.    | */
+    0xF9, 0x04, 0x00, 0x00, /* |+@:     | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+    0xF9, 0x01, 0x00, 0x00, /* |+@      | */
+
+    // @5313 's' (8 x 11)
+    0x00, 0xB6, 0x9B, 0x03, /* |  -**+. | */
+    0x90, 0x9F, 0xB8, 0x1F, /* | +@++*@ | */
+    0xF1, 0x08, 0x00, 0x01, /* | @+     | */
+    0xF2, 0x1B, 0x00, 0x00, /* |.@*     | */
+    0x90, 0xEF, 0x49, 0x00, /* | +@%+:  | */
+    0x00, 0xA5, 0xFE, 0x0B, /* |  -*%@* | */
+    0x00, 0x00, 0x91, 0x5F, /* |     +@-| */
+    0x00, 0x00, 0x30, 0x6F, /* |     .@-| */
+    0xD2, 0x16, 0xA2, 0x2E, /* |.%- .*%.| */
+    0x91, 0xFE, 0xDF, 0x04, /* | +%@@%: | */
+    0x00, 0x20, 0x01, 0x00, /* |   .    | */
+
+    // @5357 't' (8 x 14)
+    0x00, 0x77, 0x00, 0x00, /* |  ==    | */
+    0x00, 0x9B, 0x00, 0x00, /* |  *+    | */
+    0x00, 0x9D, 0x00, 0x00, /* |  %+    | */
+    0x63, 0xCF, 0x77, 0x03, /* |.-@#==. | */
+    0xC7, 0xEF, 0xCC, 0x05, /* |=#@%##- | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x10, 0x9F, 0x00, 0x00, /* |  @+    | */
+    0x10, 0xAF, 0x00, 0x00, /* |  @*    | */
+    0x00, 0xDE, 0x74, 0x03, /* |  %%:=. | */
+    0x00, 0xF6, 0xEF, 0x05, /* |  -@@%- | */
+    0x00, 0x10, 0x02, 0x00, /* |    .   | */
+
+    // @5413 'u' (10 x 11)
+    0x88, 0x00, 0x00, 0x95, 0x02, /* |++    -+. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xDD, 0x00, 0x00, 0xF8, 0x03, /* |%%    +@. | */
+    0xEB, 0x01, 0x00, 0xFA, 0x03, /* |*%    *@. | */
+    0xF6, 0x3A, 0xA4, 0xFE, 0x03, /* |-@*.:*%@. | */
+    0x90, 0xFF, 0x8E, 0xF4, 0x03, /* | +@@%+:@. | */
+    0x00, 0x21, 0x00, 0x00, 0x00, /* |   .      | */
+
+    // @5468 'v' (10 x 10)
+    0x97, 0x01, 0x00, 0x20, 0x49, /* |=+     .+:| */
+    0xF6, 0x06, 0x00, 0x90, 0x2F, /* |-@-    +@.| */
+    0xE1, 0x0C, 0x00, 0xE1, 0x0A, /* | %#    %* | */
+    0x80, 0x3F, 0x00, 0xF6, 0x04, /* | +@.  -@: | */
+    0x20, 0x9F, 0x00, 0xDC, 0x00, /* | .@+  #%  | */
+    0x00, 0xEB, 0x30, 0x7F, 0x00, /* |  *% .@=  | */
+    0x00, 0xF5, 0x95, 0x1F, 0x00, /* |  -@-+@   | */
+    0x00, 0xE0, 0xEB, 0x0A, 0x00, /* |   %*%*   | */
+    0x00, 0x80, 0xFF, 0x04, 0x00, /* |   +@@:   | */
+    0x00, 0x20, 0xCF, 0x00, 0x00, /* |   .@#    | */
+
+    // @5518 'w' (16 x 10)
+    0x97, 0x00, 0x00, 0x95, 0x01, 0x00, 0x93, 0x03, /* |=+    -+    .+. | */
+    0xF8, 0x03, 0x00, 0xFC, 0x06, 0x00, 0xF9, 0x01, /* |+@.   #@-   +@  | */
+    0xF3, 0x08, 0x20, 0xDF, 0x0B, 0x00, 0xBD, 0x00, /* |.@+  .@%*   %*  | */
+    0xD0, 0x0C, 0x60, 0x6E, 0x1F, 0x30, 0x6F, 0x00, /* | %#  -%-@  .@-  | */
+    0x80, 0x2F, 0xB0, 0x19, 0x6F, 0x70, 0x2F, 0x00, /* | +@. *+ @- =@.  | */
+    0x30, 0x6F, 0xF1, 0x04, 0xBB, 0xC0, 0x0C, 0x00, /* | .@- @: ** ##   | */
+    0x00, 0xBD, 0xE6, 0x00, 0xF6, 0xF2, 0x07, 0x00, /* |  %*-%  -@.@=   | */
+    0x00, 0xE8, 0x9B, 0x00, 0xF1, 0xFA, 0x02, 0x00, /* |  +%*+   @*@.   | */
+    0x00, 0xF4, 0x5F, 0x00, 0xB0, 0xCF, 0x00, 0x00, /* |  :@@-   *@#    | */
+    0x00, 0xE0, 0x0E, 0x00, 0x60, 0x7F, 0x00, 0x00, /* |   %%    -@=    | */
+
+    // @5598 'x' (10 x 10)
+    0x94, 0x05, 0x00, 0x80, 0x09, /* |:+-    ++ | */
+    0xC0, 0x2E, 0x00, 0xF6, 0x05, /* | #%.  -@- | */
+    0x30, 0xBF, 0x20, 0xAE, 0x00, /* | .@* .%*  | */
+    0x00, 0xF7, 0xB6, 0x1D, 0x00, /* |  =@-*%   | */
+    0x00, 0xB0, 0xFF, 0x04, 0x00, /* |   *@@:   | */
+    0x00, 0xA0, 0xFF, 0x04, 0x00, /* |   *@@:   | */
+    0x00, 0xF5, 0xD7, 0x1D, 0x00, /* |  -@=%%   | */
+    0x10, 0xBE, 0x40, 0x9F, 0x00, /* |  %* :@+  | */
+    0xB0, 0x2E, 0x00, 0xF9, 0x04, /* | *%.  +@: | */
+    0xF6, 0x06, 0x00, 0xD1, 0x1D, /* |-@-    %% | */
+
+    // @5648 'y' (10 x 14)
+    0x97, 0x01, 0x00, 0x20, 0x49, /* |=+     .+:| */
+    0xF6, 0x07, 0x00, 0x90, 0x2F, /* |-@=    +@.| */
+    0xE0, 0x0D, 0x00, 0xE1, 0x0A, /* | %%    %* | */
+    0x70, 0x4F, 0x00, 0xF6, 0x03, /* | =@:  -@. | */
+    0x10, 0xBF, 0x00, 0xCC, 0x00, /* |  @*  ##  | */
+    0x00, 0xF9, 0x42, 0x6F, 0x00, /* |  +@.:@-  | */
+    0x00, 0xF3, 0xA9, 0x0E, 0x00, /* |  .@+*%   | */
+    0x00, 0xB0, 0xEE, 0x08, 0x00, /* |   *%%+   | */
+    0x00, 0x50, 0xFF, 0x01, 0x00, /* |   -@@    | */
+    0x00, 0x10, 0xAF, 0x00, 0x00, /* |    @*    | */
+    0x00, 0x60, 0x3F, 0x00, 0x00, /* |   -@.    | */
+    0x00, 0xD0, 0x0C, 0x00, 0x00, /* |   %#     | */
+    0x00, 0xF5, 0x05, 0x00, 0x00, /* |  -@-     | */
+    0x00, 0x42, 0x00, 0x00, 0x00, /* |  .:      | */
+
+    // @5718 'z' (10 x 10)
+    0x90, 0x99, 0x99, 0x99, 0x01, /* | +++++++  | */
+    0xA0, 0xAA, 0xAA, 0xEF, 0x01, /* | *****@%  | */
+    0x00, 0x00, 0x70, 0x5F, 0x00, /* |     =@-  | */
+    0x00, 0x00, 0xF3, 0x08, 0x00, /* |    .@+   | */
+    0x00, 0x10, 0xCD, 0x00, 0x00, /* |    %#    | */
+    0x00, 0xB0, 0x2E, 0x00, 0x00, /* |   *%.    | */
+    0x00, 0xF7, 0x05, 0x00, 0x00, /* |  =@-     | */
+    0x30, 0x8F, 0x00, 0x00, 0x00, /* | .@+      | */
+    0xD1, 0x5E, 0x55, 0x45, 0x00, /* | %%----:  | */
+    0xF5, 0xFF, 0xFF, 0xEF, 0x00, /* |-@@@@@@%  | */
+
+    // @5768 '{' (6 x 18)
+    0x00, 0x72, 0x07, /* |  .== | */
+    0x30, 0xCE, 0x07, /* | .%#= | */
+    0xA0, 0x0D, 0x00, /* | *%   | */
+    0xB0, 0x0B, 0x00, /* | **   | */
+    0xA0, 0x0C, 0x00, /* | *#   | */
+    0x70, 0x0E, 0x00, /* | =%   | */
+    0x50, 0x2F, 0x00, /* | -@.  | */
+    0x50, 0x2F, 0x00, /* | -@.  | */
+    0xD4, 0x09, 0x00, /* |:%+   | */
+    0xE6, 0x07, 0x00, /* |-%=   | */
+    0x60, 0x1F, 0x00, /* | -@   | */
+    0x50, 0x2F, 0x00, /* | -@.  | */
+    0x70, 0x0F, 0x00, /* | =@   | */
+    0xA0, 0x0C, 0x00, /* | *#   | */
+    0xB0, 0x0B, 0x00, /* | **   | */
+    0xA0, 0x0C, 0x00, /* | *#   | */
+    0x40, 0x9F, 0x04, /* | :@+: | */
+    0x00, 0xA4, 0x0A, /* |  :** | */
+
+    // @5822 '|' (2 x 19)
+    0x47, /* |=:| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x7C, /* |#=| */
+    0x23, /* |..| */
+
+    // @5841 '}' (6 x 18)
+    0x81, 0x16, 0x00, /* | +-   | */
+    0x91, 0xCD, 0x00, /* | +%#  | */
+    0x00, 0xF3, 0x05, /* |  .@- | */
+    0x00, 0xF0, 0x07, /* |   @= | */
+    0x00, 0xF2, 0x06, /* |  .@- | */
+    0x00, 0xF4, 0x03, /* |  :@. | */
+    0x00, 0xF6, 0x00, /* |  -@  | */
+    0x00, 0xF6, 0x01, /* |  -@  | */
+    0x00, 0xD1, 0x2A, /* |   %*.| */
+    0x00, 0xA0, 0x3C, /* |   *#.| */
+    0x00, 0xF6, 0x01, /* |  -@  | */
+    0x00, 0xF6, 0x00, /* |  -@  | */
+    0x00, 0xF4, 0x02, /* |  :@. | */
+    0x00, 0xF2, 0x05, /* |  .@- | */
+    0x00, 0xF0, 0x07, /* |   @= | */
+    0x00, 0xF2, 0x06, /* |  .@- | */
+    0x61, 0xEC, 0x01, /* | -#%  | */
+    0xB2, 0x29, 0x00, /* |.*+.  | */
+
+    // @5895 '~' (10 x 5)
+    0x00, 0x00, 0x00, 0x20, 0x04, /* |       .: | */
+    0x80, 0xBC, 0x05, 0xA0, 0x0C, /* | +#*-  *# | */
+    0xF8, 0xBA, 0xEF, 0xFD, 0x06, /* |+@**@%%@- | */
+    0x9D, 0x00, 0x72, 0x58, 0x00, /* |%+  .=+-  | */
+    0x01, 0x00, 0x00, 0x00, 0x00, /* |          | */
+};
+
+/* offset, width, height, left, top, advance */
+static const app_font_glyph_t FontLato20_Glyphs[] = {
+    {0, 0, 0, 0, 0, 17}, /* ' ' */
+    {0, 4, 15, 7, 2, 17}, /* '!' */
+    {30, 6, 6, 5, 2, 17}, /* '"' */
+    {48, 12, 14, 3, 2, 17}, /* '#' */
+    {132, 10, 19, 4, 0, 17}, /* '$' */
+    {227, 16, 15, 1, 2, 17}, /* '%' */
+    {347, 14, 15, 2, 2, 17}, /* '&' */
+    {452, 2, 6, 7, 2, 17}, /* ''' */
+    {458, 4, 18, 6, 1, 17}, /* '(' */
+    {494, 6, 18, 5, 1, 17}, /* ')' */
+    {548, 6, 7, 5, 1, 17}, /* '*' */
+    {569, 12, 11, 3, 4, 17}, /* '+' */
+    {635, 4, 6, 6, 13, 17}, /* ',' */
+    {647, 6, 2, 5, 9, 17}, /* '-' */
+    {653, 4, 4, 6, 13, 17}, /* '.' */
+    {661, 8, 15, 5, 2, 17}, /* '/' */
+    {721, 12, 15, 3, 2, 17}, /* '0' */
+    {811, 8, 14, 5, 2, 17}, /* '1' */
+    {867, 10, 14, 4, 2, 17}, /* '2' */
+    {937, 10, 15, 4, 2, 17}, /* '3' */
+    {1012, 12, 14, 3, 2, 17}, /* '4' */
+    {1096, 10, 15, 4, 2, 17}, /* '5' */
+    {1171, 10, 15, 4, 2, 17}, /* '6' */
+    {1246, 10, 14, 4, 2, 17}, /* '7' */
+    {1316, 12, 15, 3, 2, 17}, /* '8' */
+    {1406, 10, 14, 4, 2, 17}, /* '9' */
+    {1476, 4, 11, 7, 6, 17}, /* ':' */
+    {1498, 4, 13, 7, 6, 17}, /* ';' */
+    {1524, 8, 9, 4, 5, 17}, /* '<' */
+    {1560, 10, 5, 4, 7, 17}, /* '=' */
+    {1585, 8, 9, 5, 5, 17}, /* '>' */
+    {1621, 8, 15, 4, 2, 17}, /* '?' */
+    {1681, 16, 16, 0, 3, 17}, /* '@' */
+    {1809, 14, 14, 2, 2, 17}, /* 'A' */
+    {1907, 12, 14, 3, 2, 17}, /* 'B' */
+    {1991, 14, 15, 2, 2, 17}, /* 'C' */
+    {2096, 14, 14, 2, 2, 17}, /* 'D' */
+    {2194, 10, 14, 4, 2, 17}, /* 'E' */
+    {2264, 10, 14, 4, 2, 17}, /* 'F' */
+    {2334, 14, 15, 1, 2, 17}, /* 'G' */
+    {2439, 12, 14, 2, 2, 17}, /* 'H' */
+    {2523, 2, 14, 7, 2, 17}, /* 'I' */
+    {2537, 8, 15, 4, 2, 17}, /* 'J' */
+    {2597, 12, 14, 3, 2, 17}, /* 'K' */
+    {2681, 10, 14, 4, 2, 17}, /* 'L' */
+    {2751, 16, 14, 1, 2, 17}, /* 'M' */
+    {2863, 12, 14, 2, 2, 17}, /* 'N' */
+    {2947, 16, 15, 1, 2, 17}, /* 'O' */
+    {3067, 10, 14, 3, 2, 17}, /* 'P' */
+    {3137, 16, 17, 1, 2, 17}, /* 'Q' */
+    {3273, 12, 14, 3, 2, 17}, /* 'R' */
+    {3357, 10, 15, 3, 2, 17}, /* 'S' */
+    {3432, 12, 14, 3, 2, 17}, /* 'T' */
+    {3516, 12, 15, 2, 2, 17}, /* 'U' */
+    {3606, 14, 14, 2, 2, 17}, /* 'V' */
+    {3704, 16, 14, 0, 2, 17}, /* 'W' */
+    {3816, 12, 14, 2, 2, 17}, /* 'X' */
+    {3900, 12, 14, 2, 2, 17}, /* 'Y' */
+    {3984, 12, 14, 2, 2, 17}, /* 'Z' */
+    {4068, 4, 18, 6, 1, 17}, /* '[' */
+    {4104, 8, 15, 4, 2, 17}, /* '\\' */
+    {4164, 6, 18, 5, 1, 17}, /* ']' */
+    {4218, 10, 7, 4, 2, 17}, /* '^' */
+    {4253, 8, 2, 5, 17, 17}, /* '_' */
+    {4261, 4, 3, 5, 2, 17}, /* '`' */
+    {4267, 10, 11, 3, 6, 17}, /* 'a' */
+    {4322, 10, 15, 4, 2, 17}, /* 'b' */
+    {4397, 10, 11, 4, 6, 17}, /* 'c' */
+    {4452, 10, 15, 3, 2, 17}, /* 'd' */
+    {4527, 10, 11, 3, 6, 17}, /* 'e' */
+    {4582, 8, 14, 5, 2, 17}, /* 'f' */
+    {4638, 10, 14, 3, 6, 17}, /* 'g' */
+    {4708, 10, 14, 4, 2, 17}, /* 'h' */
+    {4778, 4, 14, 7, 2, 17}, /* 'i' */
+    {4806, 6, 18, 5, 2, 17}, /* 'j' */
+    {4860, 10, 14, 4, 2, 17}, /* 'k' */
+    {4930, 4, 14, 7, 2, 17}, /* 'l' */
+    {4958, 14, 10, 1, 6, 17}, /* 'm' */
+    {5028, 10, 10, 4, 6, 17}, /* 'n' */
+    {5078, 10, 11, 3, 6, 17}, /* 'o' */
+    {5133, 10, 14, 4, 6, 17}, /* 'p' */
+    {5203, 10, 14, 3, 6, 17}, /* 'q' */
+    {5273, 8, 10, 5, 6, 17}, /* 'r' */
+    {5313, 8, 11, 4, 6, 17}, /* 's' */
+    {5357, 8, 14, 5, 3, 17}, /* 't' */
+    {5413, 10, 11, 4, 6, 17}, /* 'u' */
+    {5468, 10, 10, 3, 6, 17}, /* 'v' */
+    {5518, 16, 10, 1, 6, 17}, /* 'w' */
+    {5598, 10, 10, 3, 6, 17}, /* 'x' */
+    {5648, 10, 14, 3, 6, 17}, /* 'y' */
+    {5718, 10, 10, 4, 6, 17}, /* 'z' */
+    {5768, 6, 18, 5, 1, 17}, /* '{' */
+    {5822, 2, 19, 7, 1, 17}, /* '|' */
+    {5841, 6, 18, 5, 1, 17}, /* '}' */
+    {5895, 10, 5, 4, 8, 17}, /* '~' */
+};
+
+app_font_t FontLato20 = {
+    {FontLato20_Table, 17, 20}, /* widest advance, line */
+    FontLato20_Glyphs,
+    0x20, /* first */
+    95,   /* count */
+};